@@ -11,6 +11,22 @@ int main(int argc, char** argv) {
     benchmark::RegisterBenchmark(p_name.c_str(), &BM_ParseBenchmark, query.second);
     std::string t_name = query.first + "-tokenize";
     benchmark::RegisterBenchmark(t_name.c_str(), &BM_TokenizeBenchmark, query.second);
+
+    // Compare the flex scanner with the hand-written lexer.
+    std::string tf_name = query.first + "-tokenize-flex";
+    benchmark::RegisterBenchmark(tf_name.c_str(), &BM_ContextTokenizeBenchmark, query.second, hsql::kLexerFlex);
+    std::string ts_name = query.first + "-tokenize-simd";
+    benchmark::RegisterBenchmark(ts_name.c_str(), &BM_ContextTokenizeBenchmark, query.second, hsql::kLexerSimd);
+    std::string tc_name = query.first + "-tokenize-scalar";
+    benchmark::RegisterBenchmark(tc_name.c_str(), &BM_ContextTokenizeBenchmark, query.second, hsql::kLexerScalar);
+    std::string tt_name = query.first + "-tokenize-stream";
+    benchmark::RegisterBenchmark(tt_name.c_str(), &BM_TokenStreamBenchmark, query.second);
+    std::string fp_name = query.first + "-fingerprint";
+    benchmark::RegisterBenchmark(fp_name.c_str(), &BM_FingerprintBenchmark, query.second);
+    std::string pc_name = query.first + "-parse-cached";
+    benchmark::RegisterBenchmark(pc_name.c_str(), &BM_ParseCacheBenchmark, query.second);
+    std::string ps_name = query.first + "-parse-simd";
+    benchmark::RegisterBenchmark(ps_name.c_str(), &BM_ContextParseBenchmark, query.second, hsql::kLexerSimd);
   }
 
   // Create parse and tokenize benchmarks for all queries in sql_queries array.
@@ -19,6 +35,9 @@ int main(int argc, char** argv) {
     std::string p_name = getQueryName(i) + "-parse";
     benchmark::RegisterBenchmark(p_name.c_str(), &BM_ParseBenchmark, query.second);
 
+    std::string c_name = getQueryName(i) + "-parse-context";
+    benchmark::RegisterBenchmark(c_name.c_str(), &BM_ContextParseBenchmark, query.second, hsql::kLexerFlex);
+
     std::string t_name = getQueryName(i) + "-tokenize";
     benchmark::RegisterBenchmark(t_name.c_str(), &BM_TokenizeBenchmark, query.second);
   }
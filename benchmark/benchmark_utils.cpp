@@ -3,6 +3,7 @@
 #include <fstream>
 #include <iostream>
 
+#include "ParseCache.h"
 #include "SQLParser.h"
 
 size_t getNumTokens(const std::string& query) {
@@ -36,6 +37,73 @@ void BM_ParseBenchmark(benchmark::State& st, const std::string& query) {
   }
 }
 
+// Parses the query with a reused ParserContext, which keeps the lexer and the result alive.
+void BM_ContextParseBenchmark(benchmark::State& st, const std::string& query, hsql::LexerType lexer) {
+  st.counters["num_tokens"] = getNumTokens(query);
+  st.counters["num_chars"] = query.size();
+
+  hsql::ParserContext context;
+  context.setLexer(lexer);
+  while (st.KeepRunning()) {
+    const hsql::SQLParserResult& result = context.parse(query);
+    if (!result.isValid()) {
+      std::cout << query << std::endl;
+      std::cout << result.errorMsg() << std::endl;
+      st.SkipWithError("Parsing failed!");
+    }
+  }
+}
+
+// Tokenizes the query with a reused ParserContext and the given lexer.
+void BM_ContextTokenizeBenchmark(benchmark::State& st, const std::string& query, hsql::LexerType lexer) {
+  st.counters["num_tokens"] = getNumTokens(query);
+  st.counters["num_chars"] = query.size();
+
+  hsql::ParserContext context;
+  context.setLexer(lexer);
+  std::vector<int16_t> tokens;
+  while (st.KeepRunning()) {
+    tokens.clear();
+    context.tokenize(query, &tokens);
+  }
+}
+
+// Tokenizes the query into a reused TokenStream.
+void BM_TokenStreamBenchmark(benchmark::State& st, const std::string& query) {
+  st.counters["num_tokens"] = getNumTokens(query);
+  st.counters["num_chars"] = query.size();
+
+  hsql::ParserContext context;
+  hsql::TokenStream tokens;
+  while (st.KeepRunning()) {
+    context.tokenize(query, &tokens);
+  }
+}
+
+// Computes the fingerprint of the query with a reused ParserContext.
+void BM_FingerprintBenchmark(benchmark::State& st, const std::string& query) {
+  st.counters["num_tokens"] = getNumTokens(query);
+  st.counters["num_chars"] = query.size();
+
+  hsql::ParserContext context;
+  hsql::QueryFingerprint fingerprint;
+  while (st.KeepRunning()) {
+    context.fingerprint(query, &fingerprint);
+  }
+}
+
+// Looks up the query in a ParseCache that already contains it.
+void BM_ParseCacheBenchmark(benchmark::State& st, const std::string& query) {
+  st.counters["num_tokens"] = getNumTokens(query);
+  st.counters["num_chars"] = query.size();
+
+  hsql::ParseCache cache(1 << 24);
+  cache.parse(query);
+  while (st.KeepRunning()) {
+    benchmark::DoNotOptimize(cache.parse(query));
+  }
+}
+
 std::string readFileContents(const std::string& file_path) {
   std::ifstream t(file_path.c_str());
   std::string text((std::istreambuf_iterator<char>(t)),
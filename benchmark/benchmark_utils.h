@@ -3,12 +3,21 @@
 
 #include "benchmark/benchmark.h"
 
+#include "ParserContext.h"
+
 size_t getNumTokens(const std::string& query);
 
 void BM_TokenizeBenchmark(benchmark::State& st, const std::string& query);
 
 void BM_ParseBenchmark(benchmark::State& st, const std::string& query);
 
+void BM_ContextParseBenchmark(benchmark::State& st, const std::string& query, hsql::LexerType lexer);
+
+void BM_ContextTokenizeBenchmark(benchmark::State& st, const std::string& query, hsql::LexerType lexer);
+void BM_TokenStreamBenchmark(benchmark::State& st, const std::string& query);
+void BM_FingerprintBenchmark(benchmark::State& st, const std::string& query);
+void BM_ParseCacheBenchmark(benchmark::State& st, const std::string& query);
+
 std::string readFileContents(const std::string& file_path);
 
 
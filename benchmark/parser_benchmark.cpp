@@ -3,7 +3,15 @@
 #include <sstream>
 #include "benchmark/benchmark.h"
 
+#include "FlatAst.h"
+#include "ParallelParser.h"
+#include "ParseBatch.h"
+#include "PreparedStatementRegistry.h"
+#include "ResultSerializer.h"
 #include "SQLParser.h"
+#include "SQLUnparser.h"
+#include "sql/CompactExpr.h"
+#include "ScriptParser.h"
 #include "parser/bison_parser.h"
 #include "parser/flex_lexer.h"
 
@@ -85,3 +93,425 @@ BENCHMARK(BM_ConditionalTokens)
 
 
 
+
+
+// Builds an INSERT with the given number of parameters and an EXECUTE statement for it.
+static void makePreparedQuery(size_t numParameters, std::string* query, std::string* execute) {
+  std::stringstream queryStream;
+  std::stringstream executeStream;
+  queryStream << "INSERT INTO test VALUES (";
+  executeStream << "EXECUTE ins(";
+  for (size_t i = 0; i < numParameters; ++i) {
+    queryStream << (i == 0 ? "?" : ", ?");
+    executeStream << (i == 0 ? "" : ", ") << i;
+  }
+  queryStream << ");";
+  executeStream << ");";
+  *query = queryStream.str();
+  *execute = executeStream.str();
+}
+
+// Executes a prepared statement by parsing its query again for every EXECUTE.
+static void BM_PreparedReparse(benchmark::State& st) {
+  std::string query, execute;
+  makePreparedQuery(st.range(0), &query, &execute);
+
+  hsql::ParserContext context;
+  hsql::SQLParserResult executeResult;
+  hsql::SQLParserResult queryResult;
+  while (st.KeepRunning()) {
+    executeResult.reset();
+    context.parse(execute, &executeResult);
+    queryResult.reset();
+    context.parse(query, &queryResult);
+  }
+}
+BENCHMARK(BM_PreparedReparse)->RangeMultiplier(1 << 2)->Range(1 << 2, 1 << 10);
+
+// Executes a prepared statement by binding the arguments to the query parsed on PREPARE.
+static void BM_PreparedBind(benchmark::State& st) {
+  std::string query, execute;
+  makePreparedQuery(st.range(0), &query, &execute);
+
+  hsql::PreparedStatementRegistry registry;
+  registry.prepare("ins", query);
+  hsql::ParserContext context;
+  hsql::SQLParserResult executeResult;
+  hsql::BoundStatement bound;
+  while (st.KeepRunning()) {
+    executeResult.reset();
+    context.parse(execute, &executeResult);
+    const hsql::ExecuteStatement* statement = (const hsql::ExecuteStatement*)executeResult.getStatement(0);
+    if (!registry.bind(*statement, &bound)) st.SkipWithError("Binding failed!");
+  }
+}
+BENCHMARK(BM_PreparedBind)->RangeMultiplier(1 << 2)->Range(1 << 2, 1 << 10);
+
+// Benchmark the influence of the number of parameters, e.g. of generated bulk statements.
+static void BM_ParameterCount(benchmark::State& st) {
+  const size_t numParameters = st.range(0);
+  std::string query = "INSERT INTO test VALUES (?";
+  for (size_t i = 1; i < numParameters; ++i) query += ", ?";
+  query += ");";
+
+  st.counters["num_parameters"] = numParameters;
+  st.counters["num_chars"] = query.size();
+  hsql::ParserContext context;
+  hsql::SQLParserResult result;
+  while (st.KeepRunning()) {
+    result.reset();
+    context.parse(query, &result);
+    if (result.parameters().size() != numParameters) st.SkipWithError("Parsing failed!");
+  }
+  st.SetComplexityN(numParameters);
+}
+BENCHMARK(BM_ParameterCount)->RangeMultiplier(1 << 2)->Range(1 << 4, 1 << 17)->Complexity();
+
+// Bulk load of N rows as N single-row INSERT statements.
+static void BM_InsertSingleRows(benchmark::State& st) {
+  const size_t numRows = st.range(0);
+  std::string query;
+  for (size_t i = 0; i < numRows; ++i) {
+    query += "INSERT INTO orders VALUES (" + std::to_string(i) + ", 'customer#" + std::to_string(i) + "', " +
+             std::to_string(i) + ".25, DATE '1996-01-02', NULL);";
+  }
+
+  st.counters["num_rows"] = numRows;
+  st.counters["num_chars"] = query.size();
+  hsql::ParserContext context;
+  context.setLexer(hsql::kLexerSimd);
+  hsql::SQLParserResult result;
+  while (st.KeepRunning()) {
+    result.reset();
+    context.parse(query, &result);
+    if (result.size() != numRows) st.SkipWithError("Parsing failed!");
+  }
+}
+BENCHMARK(BM_InsertSingleRows)->RangeMultiplier(1 << 4)->Range(1 << 4, 1 << 12);
+
+// Bulk load of the same N rows as one multi-row INSERT statement.
+static void BM_InsertMultipleRows(benchmark::State& st) {
+  const size_t numRows = st.range(0);
+  std::string query = "INSERT INTO orders VALUES ";
+  for (size_t i = 0; i < numRows; ++i) {
+    if (i > 0) query += ", ";
+    query += "(" + std::to_string(i) + ", 'customer#" + std::to_string(i) + "', " + std::to_string(i) +
+             ".25, DATE '1996-01-02', NULL)";
+  }
+  query += ";";
+
+  st.counters["num_rows"] = numRows;
+  st.counters["num_chars"] = query.size();
+  hsql::ParserContext context;
+  context.setLexer(hsql::kLexerSimd);
+  hsql::SQLParserResult result;
+  while (st.KeepRunning()) {
+    result.reset();
+    context.parse(query, &result);
+    if (!result.isValid()) st.SkipWithError("Parsing failed!");
+  }
+}
+BENCHMARK(BM_InsertMultipleRows)->RangeMultiplier(1 << 4)->Range(1 << 4, 1 << 12);
+
+// Dump with the given number of INSERT statements.
+static std::string makeScript(size_t numStatements) {
+  std::string script;
+  for (size_t i = 0; i < numStatements; ++i) {
+    script += "INSERT INTO orders VALUES (" + std::to_string(i) + ", 'customer;" + std::to_string(i) + "', " +
+              std::to_string(i) + ".25);\n";
+  }
+  return script;
+}
+
+// Parses the whole dump into a single result.
+static void BM_ScriptWhole(benchmark::State& st) {
+  const std::string script = makeScript(st.range(0));
+  st.counters["num_chars"] = script.size();
+  hsql::ParserContext context;
+  context.setLexer(hsql::kLexerSimd);
+  hsql::SQLParserResult result;
+  while (st.KeepRunning()) {
+    result.reset();
+    context.parse(script, &result);
+    if (result.size() != static_cast<size_t>(st.range(0))) st.SkipWithError("Parsing failed!");
+  }
+}
+BENCHMARK(BM_ScriptWhole)->RangeMultiplier(1 << 4)->Range(1 << 8, 1 << 16);
+
+// Parses the dump statement by statement with a ScriptParser.
+static void BM_ScriptStreaming(benchmark::State& st) {
+  const std::string script = makeScript(st.range(0));
+  st.counters["num_chars"] = script.size();
+  hsql::SQLParserResult result;
+  result.setUseArena(true);
+  while (st.KeepRunning()) {
+    hsql::ScriptParser parser(script.data(), script.size(), 1 << 16);
+    parser.context().setLexer(hsql::kLexerSimd);
+    int64_t numStatements = 0;
+    while (parser.next(&result)) ++numStatements;
+    if (numStatements != st.range(0)) st.SkipWithError("Parsing failed!");
+  }
+}
+BENCHMARK(BM_ScriptStreaming)->RangeMultiplier(1 << 4)->Range(1 << 8, 1 << 16);
+
+// Parses the dump with a ParallelParser on the given number of threads.
+static void BM_ScriptParallel(benchmark::State& st) {
+  const std::string script = makeScript(st.range(0));
+  st.counters["num_chars"] = script.size();
+  st.counters["num_threads"] = st.range(1);
+  hsql::ParallelParser parser(st.range(1));
+  parser.setLexer(hsql::kLexerSimd);
+  hsql::SQLParserResult result;
+  while (st.KeepRunning()) {
+    result.reset();
+    parser.parse(script, &result);
+    if (result.size() != static_cast<size_t>(st.range(0))) st.SkipWithError("Parsing failed!");
+  }
+}
+BENCHMARK(BM_ScriptParallel)->Ranges({{1 << 16, 1 << 16}, {1, 8}})->UseRealTime();
+
+// Counts the conditions of a chain of AND, which is either flat or a tree of binary nodes.
+static size_t countConditions(const hsql::Expr* expr) {
+  size_t numConditions = 0;
+  std::vector<const hsql::Expr*> stack = {expr};
+  while (!stack.empty()) {
+    expr = stack.back();
+    stack.pop_back();
+    if (expr->isNaryOperator(hsql::kOpAnd)) {
+      stack.insert(stack.end(), expr->exprList->begin(), expr->exprList->end());
+    } else if (expr->type == hsql::kExprOperator && expr->opType == hsql::kOpAnd) {
+      stack.push_back(expr->expr);
+      stack.push_back(expr->expr2);
+    } else {
+      ++numConditions;
+    }
+  }
+  return numConditions;
+}
+
+// Parses a WHERE clause with a long chain of AND and walks its conditions, with binary (0) or
+// flat (1) AND nodes.
+static void BM_ConditionChain(benchmark::State& st) {
+  const size_t numConditions = st.range(0);
+  std::string query = "SELECT * FROM orders WHERE a0 = 0";
+  for (size_t i = 1; i < numConditions; ++i) query += " AND a" + std::to_string(i) + " = 0";
+  query += ";";
+
+  hsql::ParserContext context;
+  context.setFlattenLogicalOperators(st.range(1) != 0);
+  hsql::SQLParserResult result;
+  while (st.KeepRunning()) {
+    result.reset();
+    context.parse(query, &result);
+    const auto* select = static_cast<const hsql::SelectStatement*>(result.getStatement(0));
+    if (countConditions(select->whereClause) != numConditions) st.SkipWithError("Parsing failed!");
+  }
+}
+BENCHMARK(BM_ConditionChain)->Ranges({{1 << 10, 1 << 10}, {0, 1}});
+
+// Sums the integer literals of an expression tree of Expr or CompactExpr nodes.
+static int64_t sumLiterals(const hsql::Expr* expr) {
+  int64_t sum = 0;
+  std::vector<const hsql::Expr*> stack = {expr};
+  while (!stack.empty()) {
+    expr = stack.back();
+    stack.pop_back();
+    if (expr->type == hsql::kExprLiteralInt) sum += expr->ival;
+    if (expr->expr != nullptr) stack.push_back(expr->expr);
+    if (expr->expr2 != nullptr) stack.push_back(expr->expr2);
+  }
+  return sum;
+}
+
+static int64_t sumLiterals(const hsql::CompactExpr* expr) {
+  int64_t sum = 0;
+  std::vector<const hsql::CompactExpr*> stack = {expr};
+  while (!stack.empty()) {
+    expr = stack.back();
+    stack.pop_back();
+    if (expr->type() == hsql::kExprLiteralInt) sum += expr->ival();
+    if (expr->expr() != nullptr) stack.push_back(expr->expr());
+    if (expr->expr2() != nullptr) stack.push_back(expr->expr2());
+  }
+  return sum;
+}
+
+// Walks the WHERE clause of an analytical query as parsed (0) or copied into CompactExpr nodes (1).
+static void BM_ExprTraversal(benchmark::State& st) {
+  const int64_t numConditions = st.range(0);
+  std::string query = "SELECT * FROM lineitem WHERE l_quantity * 2 + 0 > 0";
+  for (int64_t i = 1; i < numConditions; ++i) {
+    query += " AND l_price * " + std::to_string(i) + " - l_discount * 2 > " + std::to_string(i);
+  }
+  query += ";";
+
+  hsql::SQLParserResult result;
+  hsql::SQLParser::parse(query, &result);
+  const hsql::Expr* where = static_cast<const hsql::SelectStatement*>(result.getStatement(0))->whereClause;
+  hsql::Arena arena;
+  const hsql::CompactExpr* compact = hsql::CompactExpr::make(where, &arena);
+  st.counters["compact_bytes"] = arena.bytesUsed();
+
+  const bool useCompact = st.range(1) != 0;
+  while (st.KeepRunning()) {
+    benchmark::DoNotOptimize(useCompact ? sumLiterals(compact) : sumLiterals(where));
+  }
+}
+BENCHMARK(BM_ExprTraversal)->Ranges({{1 << 12, 1 << 12}, {0, 1}});
+
+// Counts the column references of an analytical query, walking its WHERE clause (0) or scanning
+// its FlatAst (1). The time to build the FlatAst is reported as a counter.
+static void BM_FlatAstScan(benchmark::State& st) {
+  const int64_t numConditions = st.range(0);
+  std::string query = "SELECT * FROM lineitem WHERE l_quantity > 0";
+  for (int64_t i = 1; i < numConditions; ++i) {
+    query += " AND l_price * " + std::to_string(i) + " - l_discount * 2 > l_tax";
+  }
+  query += ";";
+
+  hsql::SQLParserResult result;
+  hsql::SQLParser::parse(query, &result);
+  const hsql::Expr* where = static_cast<const hsql::SelectStatement*>(result.getStatement(0))->whereClause;
+  hsql::FlatAst ast;
+  const auto start = std::chrono::steady_clock::now();
+  ast.build(result);
+  st.counters["build_ns"] = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+  const bool useFlat = st.range(1) != 0;
+  std::vector<const hsql::Expr*> stack;
+  while (st.KeepRunning()) {
+    size_t numColumns = 0;
+    if (useFlat) {
+      for (size_t node = 0; node < ast.size(); ++node) numColumns += ast.isExpr(node, hsql::kExprColumnRef);
+    } else {
+      stack.assign(1, where);
+      while (!stack.empty()) {
+        const hsql::Expr* expr = stack.back();
+        stack.pop_back();
+        numColumns += expr->type == hsql::kExprColumnRef;
+        if (expr->expr != nullptr) stack.push_back(expr->expr);
+        if (expr->expr2 != nullptr) stack.push_back(expr->expr2);
+      }
+    }
+    benchmark::DoNotOptimize(numColumns);
+  }
+}
+BENCHMARK(BM_FlatAstScan)->Ranges({{1 << 12, 1 << 12}, {0, 1}});
+
+// Reparses an analytical query (0) or reads its serialized result (1), as a worker with a warm
+// shared parse cache would. Both results are in arena mode.
+static void BM_ResultDeserialize(benchmark::State& st) {
+  const std::string query =
+      "SELECT nation, o_year, SUM(amount) AS sum_profit FROM (SELECT n_name AS nation, "
+      "EXTRACT(YEAR FROM o_orderdate) AS o_year, l_extendedprice * (1 - l_discount) - ps_supplycost * "
+      "l_quantity AS amount FROM part, supplier, lineitem, partsupp, orders, nation WHERE s_suppkey = "
+      "l_suppkey AND ps_suppkey = l_suppkey AND ps_partkey = l_partkey AND p_partkey = l_partkey AND "
+      "o_orderkey = l_orderkey AND s_nationkey = n_nationkey AND p_name LIKE '%green%') AS profit "
+      "GROUP BY nation, o_year ORDER BY nation, o_year DESC;";
+  hsql::SQLParserResult result;
+  hsql::SQLParser::parse(query, &result);
+  std::string data;
+  hsql::ResultSerializer::serialize(result, &data);
+  st.counters["num_bytes"] = data.size();
+
+  const bool deserialize = st.range(0) != 0;
+  result.setUseArena(true);
+  while (st.KeepRunning()) {
+    if (deserialize) {
+      hsql::ResultSerializer::deserialize(data.data(), data.size(), &result);
+    } else {
+      result.reset();
+      hsql::SQLParser::parse(query, &result);
+    }
+    if (!result.isValid()) st.SkipWithError("Parsing failed!");
+  }
+}
+BENCHMARK(BM_ResultDeserialize)->DenseRange(0, 1);
+
+// Parses the TPC-H query (range 0) or writes its statements back as SQL (range 1).
+static void BM_Unparse(benchmark::State& st) {
+  const std::string query =
+      "SELECT nation, o_year, SUM(amount) AS sum_profit FROM (SELECT n_name AS nation, "
+      "EXTRACT(YEAR FROM o_orderdate) AS o_year, l_extendedprice * (1 - l_discount) - ps_supplycost * "
+      "l_quantity AS amount FROM part, supplier, lineitem, partsupp, orders, nation WHERE s_suppkey = "
+      "l_suppkey AND ps_suppkey = l_suppkey AND ps_partkey = l_partkey AND p_partkey = l_partkey AND "
+      "o_orderkey = l_orderkey AND s_nationkey = n_nationkey AND p_name LIKE '%green%') AS profit "
+      "GROUP BY nation, o_year ORDER BY nation, o_year DESC;";
+  hsql::SQLParserResult result;
+  hsql::SQLParser::parse(query, &result);
+  std::string text;
+  hsql::SQLUnparser::unparse(result, &text);
+  st.counters["num_chars"] = text.size();
+
+  const bool unparse = st.range(0) != 0;
+  hsql::SQLParserResult reparsed;
+  while (st.KeepRunning()) {
+    if (unparse) {
+      text.clear();
+      hsql::SQLUnparser::unparse(result, &text);
+    } else {
+      reparsed.reset();
+      hsql::SQLParser::parse(query, &reparsed);
+      if (!reparsed.isValid()) st.SkipWithError("Parsing failed!");
+    }
+  }
+}
+BENCHMARK(BM_Unparse)->DenseRange(0, 1);
+
+// Multi-row INSERT of string literals, every other one with escaped quotes, scanned by flex.
+static void BM_StringLiterals(benchmark::State& st) {
+  const size_t numRows = st.range(0);
+  std::string query = "INSERT INTO reviews VALUES ";
+  for (size_t i = 0; i < numRows; ++i) {
+    if (i > 0) query += ", ";
+    query += "('review " + std::to_string(i) + ": arrived on time, works as described', " +
+             (i % 2 == 0 ? "'customer''s choice')" : "'customer choice')");
+  }
+  query += ";";
+
+  st.counters["num_chars"] = query.size();
+  hsql::ParserContext context;
+  hsql::SQLParserResult result;
+  while (st.KeepRunning()) {
+    result.reset();
+    context.parse(query, &result);
+    if (!result.isValid()) st.SkipWithError("Parsing failed!");
+  }
+}
+BENCHMARK(BM_StringLiterals)->Arg(1 << 10);
+
+// Query log with the given number of short, independent queries.
+static std::vector<std::string> makeQueryLog(size_t numQueries) {
+  std::vector<std::string> queries;
+  for (size_t i = 0; i < numQueries; ++i) {
+    queries.push_back("SELECT name, price FROM orders WHERE customer_id = " + std::to_string(i) +
+                      " AND status = 'shipped' ORDER BY price DESC LIMIT 10;");
+  }
+  return queries;
+}
+
+// Parses the log one query at a time, each into its own result.
+static void BM_QueryLogOneByOne(benchmark::State& st) {
+  const std::vector<std::string> queries = makeQueryLog(st.range(0));
+  while (st.KeepRunning()) {
+    std::vector<hsql::SQLParserResult> results(queries.size());
+    for (size_t i = 0; i < queries.size(); ++i) {
+      hsql::SQLParser::parse(queries[i], &results[i]);
+      if (!results[i].isValid()) st.SkipWithError("Parsing failed!");
+    }
+  }
+}
+BENCHMARK(BM_QueryLogOneByOne)->Arg(1 << 12);
+
+// Parses the log with a ParseBatch on the given number of threads.
+static void BM_QueryLogBatch(benchmark::State& st) {
+  const std::vector<std::string> log = makeQueryLog(st.range(0));
+  const std::vector<std::string_view> queries(log.begin(), log.end());
+  st.counters["num_threads"] = st.range(1);
+  hsql::ParseBatch batch(st.range(1));
+  while (st.KeepRunning()) {
+    batch.parse(queries);
+    if (!batch[queries.size() - 1].isValid()) st.SkipWithError("Parsing failed!");
+  }
+}
+BENCHMARK(BM_QueryLogBatch)->Ranges({{1 << 12, 1 << 12}, {1, 8}})->UseRealTime();
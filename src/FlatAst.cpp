@@ -0,0 +1,559 @@
+#include "FlatAst.h"
+#include <string.h>
+#include <utility>
+
+namespace hsql {
+
+FlatAstVisitor::~FlatAstVisitor() {}
+
+bool FlatAstVisitor::enter(const FlatAst&, FlatNodeId) { return true; }
+
+void FlatAstVisitor::leave(const FlatAst&, FlatNodeId) {}
+
+FlatAst::FlatAst() : numStatements_(0) {}
+
+bool FlatAst::build(const SQLParserResult& result) {
+  clear();
+  if (!result.isValid()) return false;
+
+  for (const SQLStatement* statement : result.getStatements()) {
+    addNode(kFlatStatement, kRoleStatement, kNone, statement);
+  }
+  numStatements_ = result.size();
+
+  // Nodes are expanded in the order they were added, which appends the children of each node
+  // as one consecutive range and stores the tree level by level, without recursion.
+  for (FlatNodeId node = 0; node < kinds_.size(); ++node) appendChildren(node);
+  sources_.clear();
+  return true;
+}
+
+void FlatAst::clear() {
+  kinds_.clear();
+  types_.clear();
+  details_.clear();
+  roles_.clear();
+  flags_.clear();
+  parents_.clear();
+  firstChildren_.clear();
+  numChildren_.clear();
+  names_.clear();
+  qualifiers_.clear();
+  aliases_.clear();
+  texts_.clear();
+  values_.clear();
+  ints_.clear();
+  floats_.clear();
+  chars_.clear();
+  sources_.clear();
+  numStatements_ = 0;
+}
+
+size_t FlatAst::size() const { return kinds_.size(); }
+
+size_t FlatAst::numStatements() const { return numStatements_; }
+
+void FlatAst::accept(FlatAstVisitor* visitor) const {
+  // Each entry is a node and the next of its children to visit.
+  std::vector<std::pair<FlatNodeId, uint32_t>> stack;
+  for (FlatNodeId statement = 0; statement < numStatements_; ++statement) {
+    if (visitor->enter(*this, statement)) {
+      stack.push_back({statement, 0});
+    } else {
+      visitor->leave(*this, statement);
+    }
+
+    while (!stack.empty()) {
+      const FlatNodeId node = stack.back().first;
+      const uint32_t next = stack.back().second++;
+      if (next == numChildren_[node]) {
+        stack.pop_back();
+        visitor->leave(*this, node);
+        continue;
+      }
+      const FlatNodeId child = firstChildren_[node] + next;
+      if (visitor->enter(*this, child)) {
+        stack.push_back({child, 0});
+      } else {
+        visitor->leave(*this, child);
+      }
+    }
+  }
+}
+
+const std::vector<FlatNodeKind>& FlatAst::kinds() const { return kinds_; }
+
+const std::vector<uint8_t>& FlatAst::types() const { return types_; }
+
+const std::vector<uint8_t>& FlatAst::details() const { return details_; }
+
+const std::vector<FlatNodeRole>& FlatAst::roles() const { return roles_; }
+
+const std::vector<uint8_t>& FlatAst::flags() const { return flags_; }
+
+const std::vector<FlatNodeId>& FlatAst::parents() const { return parents_; }
+
+const std::vector<FlatNodeId>& FlatAst::firstChildren() const { return firstChildren_; }
+
+const std::vector<uint32_t>& FlatAst::numChildren() const { return numChildren_; }
+
+const std::vector<uint32_t>& FlatAst::names() const { return names_; }
+
+const std::vector<uint32_t>& FlatAst::qualifiers() const { return qualifiers_; }
+
+const std::vector<uint32_t>& FlatAst::aliases() const { return aliases_; }
+
+const std::vector<uint32_t>& FlatAst::texts() const { return texts_; }
+
+const std::vector<uint32_t>& FlatAst::values() const { return values_; }
+
+const std::vector<int64_t>& FlatAst::ints() const { return ints_; }
+
+const std::vector<double>& FlatAst::floats() const { return floats_; }
+
+const std::vector<char>& FlatAst::chars() const { return chars_; }
+
+FlatNodeId FlatAst::addNode(FlatNodeKind kind, FlatNodeRole role, FlatNodeId parent, const void* ptr, size_t row) {
+  const FlatNodeId node = kinds_.size();
+  kinds_.push_back(kind);
+  types_.push_back(0);
+  details_.push_back(0);
+  roles_.push_back(role);
+  flags_.push_back(0);
+  parents_.push_back(parent);
+  firstChildren_.push_back(kNone);
+  numChildren_.push_back(0);
+  names_.push_back(kNone);
+  qualifiers_.push_back(kNone);
+  aliases_.push_back(kNone);
+  texts_.push_back(kNone);
+  values_.push_back(kNone);
+  sources_.push_back({ptr, row});
+  setFields(node);
+  return node;
+}
+
+void FlatAst::setFields(FlatNodeId node) {
+  const void* ptr = sources_[node].ptr;
+  switch (kinds_[node]) {
+    case kFlatStatement:
+      setStatementFields(node, static_cast<const SQLStatement*>(ptr));
+      break;
+    case kFlatExpr:
+      // Cells of multi-row VALUES lists have no Expr, see appendChildren().
+      if (ptr != nullptr) setExprFields(node, static_cast<const Expr*>(ptr));
+      break;
+    case kFlatTable: {
+      const TableRef* table = static_cast<const TableRef*>(ptr);
+      types_[node] = table->type;
+      names_[node] = addString(table->name);
+      qualifiers_[node] = addString(table->schema);
+      if (table->alias != nullptr) aliases_[node] = addString(table->alias->name);
+      break;
+    }
+    case kFlatJoin:
+      types_[node] = static_cast<const JoinDefinition*>(ptr)->type;
+      break;
+    case kFlatOrder:
+      types_[node] = static_cast<const OrderDescription*>(ptr)->type;
+      break;
+    case kFlatSetOperation: {
+      const SetOperation* setOperation = static_cast<const SetOperation*>(ptr);
+      types_[node] = setOperation->setType;
+      if (setOperation->isAll) flags_[node] |= kFlatAll;
+      break;
+    }
+    case kFlatWith:
+      aliases_[node] = addString(static_cast<const WithDescription*>(ptr)->alias);
+      break;
+    case kFlatUpdate:
+      names_[node] = addString(static_cast<const UpdateClause*>(ptr)->column);
+      break;
+    case kFlatColumn:
+      names_[node] = addString(static_cast<const char*>(ptr));
+      break;
+    case kFlatColumnDefinition: {
+      const ColumnDefinition* column = static_cast<const ColumnDefinition*>(ptr);
+      types_[node] = static_cast<uint8_t>(column->type.data_type);
+      setColumnTypeValues(node, column->type);
+      names_[node] = addString(column->name);
+      if (column->nullable) flags_[node] |= kFlatNullable;
+      break;
+    }
+    case kFlatConstraint:
+      // Constraints of column definitions have no struct, their type is stored as the row.
+      types_[node] = static_cast<uint8_t>(ptr != nullptr ? static_cast<const TableConstraint*>(ptr)->type
+                                                          : static_cast<ConstraintType>(sources_[node].row));
+      break;
+    case kFlatAlterAction: {
+      const AlterAction* action = static_cast<const AlterAction*>(ptr);
+      types_[node] = action->type;
+      if (action->type == DropColumn) {
+        const DropColumnAction* dropColumn = static_cast<const DropColumnAction*>(action);
+        names_[node] = addString(dropColumn->columnName);
+        if (dropColumn->ifExists) flags_[node] |= kFlatIfExists;
+      }
+      break;
+    }
+    case kFlatGroupBy:
+    case kFlatLimit:
+    case kFlatRow:
+      break;
+  }
+}
+
+void FlatAst::setStatementFields(FlatNodeId node, const SQLStatement* statement) {
+  types_[node] = statement->type();
+  switch (statement->type()) {
+    case kStmtSelect:
+      if (static_cast<const SelectStatement*>(statement)->selectDistinct) flags_[node] |= kFlatDistinct;
+      break;
+    case kStmtImport: {
+      const ImportStatement* import = static_cast<const ImportStatement*>(statement);
+      details_[node] = import->type;
+      names_[node] = addString(import->tableName);
+      qualifiers_[node] = addString(import->schema);
+      texts_[node] = addString(import->filePath);
+      break;
+    }
+    case kStmtExport: {
+      const ExportStatement* exportStatement = static_cast<const ExportStatement*>(statement);
+      details_[node] = exportStatement->type;
+      names_[node] = addString(exportStatement->tableName);
+      qualifiers_[node] = addString(exportStatement->schema);
+      texts_[node] = addString(exportStatement->filePath);
+      break;
+    }
+    case kStmtInsert: {
+      const InsertStatement* insert = static_cast<const InsertStatement*>(statement);
+      details_[node] = insert->type;
+      names_[node] = addString(insert->tableName);
+      qualifiers_[node] = addString(insert->schema);
+      break;
+    }
+    case kStmtDelete: {
+      const DeleteStatement* del = static_cast<const DeleteStatement*>(statement);
+      names_[node] = addString(del->tableName);
+      qualifiers_[node] = addString(del->schema);
+      break;
+    }
+    case kStmtCreate: {
+      const CreateStatement* create = static_cast<const CreateStatement*>(statement);
+      details_[node] = create->type;
+      if (create->ifNotExists) flags_[node] |= kFlatIfExists;
+      names_[node] = addString(create->tableName);
+      qualifiers_[node] = addString(create->schema);
+      texts_[node] = addString(create->type == kCreateIndex ? create->indexName : create->filePath);
+      break;
+    }
+    case kStmtDrop: {
+      const DropStatement* drop = static_cast<const DropStatement*>(statement);
+      details_[node] = drop->type;
+      if (drop->ifExists) flags_[node] |= kFlatIfExists;
+      names_[node] = addString(drop->name);
+      qualifiers_[node] = addString(drop->schema);
+      texts_[node] = addString(drop->indexName);
+      break;
+    }
+    case kStmtPrepare: {
+      const PrepareStatement* prepare = static_cast<const PrepareStatement*>(statement);
+      names_[node] = addString(prepare->name);
+      texts_[node] = addString(prepare->query);
+      break;
+    }
+    case kStmtExecute:
+      names_[node] = addString(static_cast<const ExecuteStatement*>(statement)->name);
+      break;
+    case kStmtAlter: {
+      const AlterStatement* alter = static_cast<const AlterStatement*>(statement);
+      if (alter->ifTableExists) flags_[node] |= kFlatIfExists;
+      names_[node] = addString(alter->name);
+      qualifiers_[node] = addString(alter->schema);
+      break;
+    }
+    case kStmtShow: {
+      const ShowStatement* show = static_cast<const ShowStatement*>(statement);
+      details_[node] = show->type;
+      names_[node] = addString(show->name);
+      qualifiers_[node] = addString(show->schema);
+      break;
+    }
+    case kStmtTransaction:
+      details_[node] = static_cast<const TransactionStatement*>(statement)->command;
+      break;
+    case kStmtUpdate:
+    case kStmtError:
+    case kStmtRename:
+      break;
+  }
+}
+
+void FlatAst::setExprFields(FlatNodeId node, const Expr* expr) {
+  types_[node] = expr->type;
+  switch (expr->type) {
+    case kExprLiteralInterval:
+    case kExprExtract:
+      details_[node] = expr->datetimeField;
+      break;
+    case kExprCast:
+      details_[node] = static_cast<uint8_t>(expr->columnType.data_type);
+      break;
+    default:
+      details_[node] = expr->opType;
+      break;
+  }
+  if (expr->distinct) flags_[node] |= kFlatDistinct;
+  if (expr->isBoolLiteral) flags_[node] |= kFlatBoolLiteral;
+  names_[node] = addString(expr->name);
+  qualifiers_[node] = addString(expr->table);
+  aliases_[node] = addString(expr->alias);
+
+  switch (expr->type) {
+    case kExprLiteralFloat:
+      values_[node] = floats_.size();
+      floats_.push_back(expr->fval);
+      break;
+    case kExprLiteralInt:
+    case kExprLiteralInterval:
+    case kExprArrayIndex:
+      values_[node] = ints_.size();
+      ints_.push_back(expr->ival);
+      break;
+    case kExprParameter:
+      values_[node] = ints_.size();
+      ints_.push_back(expr->ival);
+      ints_.push_back(expr->ival2);
+      break;
+    case kExprCast:
+      setColumnTypeValues(node, expr->columnType);
+      break;
+    default:
+      break;
+  }
+}
+
+void FlatAst::setColumnTypeValues(FlatNodeId node, const ColumnType& columnType) {
+  values_[node] = ints_.size();
+  ints_.push_back(columnType.length);
+  ints_.push_back(columnType.precision);
+  ints_.push_back(columnType.scale);
+}
+
+void FlatAst::setCellFields(FlatNodeId node, const ValuesColumn* column, size_t row) {
+  if (column->isNull(row)) {
+    types_[node] = kExprLiteralNull;
+    return;
+  }
+  types_[node] = column->type;
+  switch (column->type) {
+    case kExprLiteralInt:
+      if (column->isBool) flags_[node] |= kFlatBoolLiteral;
+      values_[node] = ints_.size();
+      ints_.push_back(column->intValue(row));
+      break;
+    case kExprLiteralFloat:
+      values_[node] = floats_.size();
+      floats_.push_back(column->floatValue(row));
+      break;
+    case kExprLiteralString:
+    case kExprLiteralDate:
+      names_[node] = addString(column->stringValue(row));
+      break;
+    default:
+      break;
+  }
+}
+
+void FlatAst::appendChildren(FlatNodeId node) {
+  const void* ptr = sources_[node].ptr;
+  firstChildren_[node] = kinds_.size();
+  auto add = [this, node](FlatNodeKind kind, FlatNodeRole role, const void* child) {
+    if (child != nullptr) addNode(kind, role, node, child);
+  };
+  auto addExprs = [&add](FlatNodeRole role, const std::vector<Expr*>* exprs) {
+    if (exprs == nullptr) return;
+    for (const Expr* expr : *exprs) add(kFlatExpr, role, expr);
+  };
+  auto addOrder = [&add](const std::vector<OrderDescription*>* order) {
+    if (order == nullptr) return;
+    for (const OrderDescription* description : *order) add(kFlatOrder, kRoleOrderBy, description);
+  };
+  auto addColumns = [&add](const std::vector<char*>* columns) {
+    if (columns == nullptr) return;
+    for (const char* column : *columns) add(kFlatColumn, kRoleColumn, column);
+  };
+
+  switch (kinds_[node]) {
+    case kFlatStatement: {
+      const SQLStatement* statement = static_cast<const SQLStatement*>(ptr);
+      addExprs(kRoleHint, statement->hints);
+      switch (statement->type()) {
+        case kStmtSelect: {
+          const SelectStatement* select = static_cast<const SelectStatement*>(statement);
+          if (select->withDescriptions != nullptr) {
+            for (const WithDescription* with : *select->withDescriptions) add(kFlatWith, kRoleWith, with);
+          }
+          addExprs(kRoleSelectList, select->selectList);
+          add(kFlatTable, kRoleFrom, select->fromTable);
+          add(kFlatExpr, kRoleWhere, select->whereClause);
+          add(kFlatGroupBy, kRoleGroupBy, select->groupBy);
+          if (select->setOperations != nullptr) {
+            for (const SetOperation* setOperation : *select->setOperations) {
+              add(kFlatSetOperation, kRoleSetOperation, setOperation);
+            }
+          }
+          addOrder(select->order);
+          add(kFlatLimit, kRoleLimit, select->limit);
+          break;
+        }
+        case kStmtInsert: {
+          const InsertStatement* insert = static_cast<const InsertStatement*>(statement);
+          addColumns(insert->columns);
+          addExprs(kRoleValue, insert->values);
+          if (insert->rows != nullptr) {
+            for (size_t row = 0; row < insert->rows->numRows; ++row) {
+              addNode(kFlatRow, kRoleRow, node, insert->rows, row);
+            }
+          }
+          add(kFlatStatement, kRoleSubquery, insert->select);
+          break;
+        }
+        case kStmtUpdate: {
+          const UpdateStatement* update = static_cast<const UpdateStatement*>(statement);
+          add(kFlatTable, kRoleTable, update->table);
+          if (update->updates != nullptr) {
+            for (const UpdateClause* clause : *update->updates) add(kFlatUpdate, kRoleUpdate, clause);
+          }
+          add(kFlatExpr, kRoleWhere, update->where);
+          break;
+        }
+        case kStmtDelete:
+          add(kFlatExpr, kRoleWhere, static_cast<const DeleteStatement*>(statement)->expr);
+          break;
+        case kStmtCreate: {
+          const CreateStatement* create = static_cast<const CreateStatement*>(statement);
+          if (create->columns != nullptr) {
+            for (const ColumnDefinition* column : *create->columns) add(kFlatColumnDefinition, kRoleColumn, column);
+          }
+          if (create->tableConstraints != nullptr) {
+            for (const TableConstraint* constraint : *create->tableConstraints) {
+              add(kFlatConstraint, kRoleConstraint, constraint);
+            }
+          }
+          addColumns(create->indexColumns);
+          addColumns(create->viewColumns);
+          add(kFlatStatement, kRoleSubquery, create->select);
+          break;
+        }
+        case kStmtExecute:
+          addExprs(kRoleValue, static_cast<const ExecuteStatement*>(statement)->parameters);
+          break;
+        case kStmtAlter:
+          add(kFlatAlterAction, kRoleAction, static_cast<const AlterStatement*>(statement)->action);
+          break;
+        case kStmtImport:
+        case kStmtExport:
+        case kStmtDrop:
+        case kStmtPrepare:
+        case kStmtShow:
+        case kStmtTransaction:
+        case kStmtError:
+        case kStmtRename:
+          break;
+      }
+      break;
+    }
+    case kFlatExpr: {
+      const Expr* expr = static_cast<const Expr*>(ptr);
+      if (expr == nullptr) break;
+      add(kFlatExpr, kRoleExpr, expr->expr);
+      add(kFlatExpr, kRoleExpr2, expr->expr2);
+      addExprs(kRoleExprList, expr->exprList);
+      add(kFlatStatement, kRoleSubquery, expr->select);
+      break;
+    }
+    case kFlatTable: {
+      const TableRef* table = static_cast<const TableRef*>(ptr);
+      add(kFlatStatement, kRoleSubquery, table->select);
+      if (table->list != nullptr) {
+        for (const TableRef* entry : *table->list) add(kFlatTable, kRoleFrom, entry);
+      }
+      add(kFlatJoin, kRoleJoin, table->join);
+      break;
+    }
+    case kFlatJoin: {
+      const JoinDefinition* join = static_cast<const JoinDefinition*>(ptr);
+      add(kFlatTable, kRoleJoinLeft, join->left);
+      add(kFlatTable, kRoleJoinRight, join->right);
+      add(kFlatExpr, kRoleJoinCondition, join->condition);
+      break;
+    }
+    case kFlatOrder:
+      add(kFlatExpr, kRoleExpr, static_cast<const OrderDescription*>(ptr)->expr);
+      break;
+    case kFlatGroupBy: {
+      const GroupByDescription* groupBy = static_cast<const GroupByDescription*>(ptr);
+      addExprs(kRoleExprList, groupBy->columns);
+      add(kFlatExpr, kRoleHaving, groupBy->having);
+      break;
+    }
+    case kFlatLimit: {
+      const LimitDescription* limit = static_cast<const LimitDescription*>(ptr);
+      add(kFlatExpr, kRoleLimit, limit->limit);
+      add(kFlatExpr, kRoleOffset, limit->offset);
+      break;
+    }
+    case kFlatSetOperation: {
+      const SetOperation* setOperation = static_cast<const SetOperation*>(ptr);
+      add(kFlatStatement, kRoleSubquery, setOperation->nestedSelectStatement);
+      addOrder(setOperation->resultOrder);
+      add(kFlatLimit, kRoleLimit, setOperation->resultLimit);
+      break;
+    }
+    case kFlatWith:
+      add(kFlatStatement, kRoleSubquery, static_cast<const WithDescription*>(ptr)->select);
+      break;
+    case kFlatUpdate:
+      add(kFlatExpr, kRoleValue, static_cast<const UpdateClause*>(ptr)->value);
+      break;
+    case kFlatRow: {
+      // Cells are literals stored by column. Intervals, parameters and the values of columns
+      // with mixed types are kept as expressions.
+      const ValuesList* rows = static_cast<const ValuesList*>(ptr);
+      const size_t row = sources_[node].row;
+      for (const ValuesColumn& column : rows->columns) {
+        if (column.hasExpressions() && !column.isNull(row)) {
+          add(kFlatExpr, kRoleValue, column.exprValue(row));
+        } else {
+          setCellFields(addNode(kFlatExpr, kRoleValue, node, nullptr), &column, row);
+        }
+      }
+      break;
+    }
+    case kFlatColumnDefinition: {
+      const ColumnDefinition* column = static_cast<const ColumnDefinition*>(ptr);
+      if (column->column_constraints != nullptr) {
+        for (ConstraintType constraint : *column->column_constraints) {
+          addNode(kFlatConstraint, kRoleConstraint, node, nullptr, static_cast<size_t>(constraint));
+        }
+      }
+      break;
+    }
+    case kFlatConstraint:
+      if (ptr != nullptr) addColumns(static_cast<const TableConstraint*>(ptr)->columnNames);
+      break;
+    case kFlatColumn:
+    case kFlatAlterAction:
+      break;
+  }
+  numChildren_[node] = kinds_.size() - firstChildren_[node];
+}
+
+uint32_t FlatAst::addString(const char* string) {
+  if (string == nullptr) return kNone;
+  const uint32_t offset = chars_.size();
+  chars_.insert(chars_.end(), string, string + strlen(string) + 1);
+  return offset;
+}
+
+}  // namespace hsql
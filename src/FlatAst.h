@@ -0,0 +1,223 @@
+#ifndef SQLPARSER_FLAT_AST_H
+#define SQLPARSER_FLAT_AST_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "SQLParserResult.h"
+#include "sql/statements.h"
+
+namespace hsql {
+
+// Index of a node in a FlatAst.
+typedef uint32_t FlatNodeId;
+
+// Kinds of nodes, one for each struct of the AST that is exported.
+enum FlatNodeKind : uint8_t {
+  kFlatStatement,         // type: StatementType
+  kFlatExpr,              // type: ExprType
+  kFlatTable,             // type: TableRefType
+  kFlatJoin,              // type: JoinType
+  kFlatOrder,             // type: OrderType
+  kFlatGroupBy,
+  kFlatLimit,
+  kFlatSetOperation,      // type: SetType
+  kFlatWith,
+  kFlatUpdate,            // UpdateClause
+  kFlatColumn,            // Column name of an INSERT, CREATE INDEX, CREATE VIEW or table constraint
+  kFlatRow,               // Row of a multi-row VALUES list
+  kFlatColumnDefinition,  // type: DataType
+  kFlatConstraint,        // type: ConstraintType
+  kFlatAlterAction        // type: ActionType
+};
+
+// Field of the parent that holds a node.
+enum FlatNodeRole : uint8_t {
+  kRoleStatement,  // Statements of the result, i.e. the roots.
+  kRoleExpr,
+  kRoleExpr2,
+  kRoleExprList,
+  kRoleSubquery,
+  kRoleWith,
+  kRoleSelectList,
+  kRoleFrom,
+  kRoleWhere,
+  kRoleGroupBy,
+  kRoleHaving,
+  kRoleSetOperation,
+  kRoleOrderBy,
+  kRoleLimit,
+  kRoleOffset,
+  kRoleJoin,
+  kRoleJoinLeft,
+  kRoleJoinRight,
+  kRoleJoinCondition,
+  kRoleTable,
+  kRoleColumn,
+  kRoleValue,
+  kRoleUpdate,
+  kRoleRow,
+  kRoleHint,
+  kRoleConstraint,
+  kRoleAction
+};
+
+// Bits of FlatAst::flags().
+enum FlatNodeFlag : uint8_t {
+  kFlatDistinct = 1,     // SELECT DISTINCT, or a function call with DISTINCT.
+  kFlatBoolLiteral = 2,  // Integer literal written as TRUE or FALSE.
+  kFlatAll = 4,          // UNION ALL etc.
+  kFlatIfExists = 8,     // IF EXISTS, or IF NOT EXISTS of CREATE.
+  kFlatNullable = 16     // Column definition that allows NULL.
+};
+
+class FlatAst;
+
+// Read-only visitor, see FlatAst::accept().
+class FlatAstVisitor {
+ public:
+  virtual ~FlatAstVisitor();
+
+  // Called before the children of the node. Returns false to skip them.
+  virtual bool enter(const FlatAst& ast, FlatNodeId node);
+
+  // Called after the children of the node, or after enter() returned false.
+  virtual void leave(const FlatAst& ast, FlatNodeId node);
+};
+
+// Statements of a SQLParserResult as a table of nodes in parallel arrays, for consumers that walk
+// an AST many times or cache it. Nodes refer to each other by index instead of by pointer, so the
+// arrays can be copied or stored as they are. Strings are kept in one pool of characters and
+// numbers in two literal pools.
+//
+// The statements are the nodes 0 to numStatements() - 1. The children of a node are consecutive,
+// from firstChild() to firstChild() + numChildren() - 1, in the order of the fields of the AST
+// struct, and role() tells which field holds a child. All nodes of one level of the tree are stored
+// before the nodes of the next level.
+//
+// Depending on the kind of node, the columns hold:
+//   type()       the enum value of the AST struct, see FlatNodeKind.
+//   detail()     the OperatorType of operators, the DatetimeField of intervals and EXTRACT,
+//                the DataType of CAST, and the type enum of statements that have one:
+//                InsertType, CreateType, DropType, ShowType, ImportType of IMPORT and EXPORT,
+//                TransactionCommand.
+//   name()       name of expressions, tables, column definitions and prepared statements, table of
+//                statements, column of UPDATE, INSERT and other column lists, column of ALTER actions.
+//   qualifier()  table of column references, schema of tables and statements.
+//   alias()      alias of expressions, tables and WITH.
+//   text()       file path of CREATE, IMPORT and EXPORT, index name of CREATE INDEX and DROP INDEX,
+//                query of PREPARE.
+//   value()      index into ints() for integer literals, intervals and array indexes (ival),
+//                parameters (ival, ival2), CAST and column definitions (length, precision, scale);
+//                index into floats() for float literals.
+// Absent strings and values are kNone.
+//
+// All statements are exported with their contents, including their hints.
+class FlatAst {
+ public:
+  static constexpr uint32_t kNone = UINT32_MAX;
+
+  FlatAst();
+
+  // Replaces the contents with the statements of the result. The memory of the arrays is reused.
+  // Returns false and leaves the table empty if the result is invalid.
+  bool build(const SQLParserResult& result);
+
+  // Removes all nodes, but keeps the allocated memory.
+  void clear();
+
+  // Number of nodes.
+  size_t size() const;
+
+  size_t numStatements() const;
+
+  // Walks the statements depth-first.
+  void accept(FlatAstVisitor* visitor) const;
+
+  // Per-node columns.
+  const std::vector<FlatNodeKind>& kinds() const;
+  const std::vector<uint8_t>& types() const;
+  const std::vector<uint8_t>& details() const;
+  const std::vector<FlatNodeRole>& roles() const;
+  const std::vector<uint8_t>& flags() const;
+  const std::vector<FlatNodeId>& parents() const;
+  const std::vector<FlatNodeId>& firstChildren() const;
+  const std::vector<uint32_t>& numChildren() const;
+  const std::vector<uint32_t>& names() const;
+  const std::vector<uint32_t>& qualifiers() const;
+  const std::vector<uint32_t>& aliases() const;
+  const std::vector<uint32_t>& texts() const;
+  const std::vector<uint32_t>& values() const;
+
+  // Pools. A string is the null-terminated sequence at its offset in chars().
+  const std::vector<int64_t>& ints() const;
+  const std::vector<double>& floats() const;
+  const std::vector<char>& chars() const;
+
+  // Convenience accessors for a single node.
+
+  FlatNodeKind kind(FlatNodeId node) const { return kinds_[node]; }
+  uint8_t type(FlatNodeId node) const { return types_[node]; }
+  uint8_t detail(FlatNodeId node) const { return details_[node]; }
+  FlatNodeRole role(FlatNodeId node) const { return roles_[node]; }
+  bool hasFlag(FlatNodeId node, FlatNodeFlag flag) const { return (flags_[node] & flag) != 0; }
+  FlatNodeId parent(FlatNodeId node) const { return parents_[node]; }
+  FlatNodeId firstChild(FlatNodeId node) const { return firstChildren_[node]; }
+  uint32_t numChildren(FlatNodeId node) const { return numChildren_[node]; }
+
+  bool isExpr(FlatNodeId node, ExprType exprType) const { return kind(node) == kFlatExpr && type(node) == exprType; }
+
+  // Returns the string at the offset, or nullptr if it is kNone.
+  const char* string(uint32_t offset) const { return offset != kNone ? chars_.data() + offset : nullptr; }
+  const char* name(FlatNodeId node) const { return string(names_[node]); }
+  const char* qualifier(FlatNodeId node) const { return string(qualifiers_[node]); }
+  const char* alias(FlatNodeId node) const { return string(aliases_[node]); }
+  const char* text(FlatNodeId node) const { return string(texts_[node]); }
+
+  // Returns the i-th integer or the float of the node's value.
+  int64_t intValue(FlatNodeId node, size_t i = 0) const { return ints_[values_[node] + i]; }
+  double floatValue(FlatNodeId node) const { return floats_[values_[node]]; }
+
+ private:
+  // AST struct a node is built from, see appendChildren().
+  struct Source {
+    const void* ptr;
+    size_t row;
+  };
+
+  FlatNodeId addNode(FlatNodeKind kind, FlatNodeRole role, FlatNodeId parent, const void* ptr, size_t row = 0);
+  void setFields(FlatNodeId node);
+  void setStatementFields(FlatNodeId node, const SQLStatement* statement);
+  void setExprFields(FlatNodeId node, const Expr* expr);
+  void setColumnTypeValues(FlatNodeId node, const ColumnType& columnType);
+  void setCellFields(FlatNodeId node, const ValuesColumn* column, size_t row);
+  void appendChildren(FlatNodeId node);
+  uint32_t addString(const char* string);
+
+  std::vector<FlatNodeKind> kinds_;
+  std::vector<uint8_t> types_;
+  std::vector<uint8_t> details_;
+  std::vector<FlatNodeRole> roles_;
+  std::vector<uint8_t> flags_;
+  std::vector<FlatNodeId> parents_;
+  std::vector<FlatNodeId> firstChildren_;
+  std::vector<uint32_t> numChildren_;
+  std::vector<uint32_t> names_;
+  std::vector<uint32_t> qualifiers_;
+  std::vector<uint32_t> aliases_;
+  std::vector<uint32_t> texts_;
+  std::vector<uint32_t> values_;
+
+  std::vector<int64_t> ints_;
+  std::vector<double> floats_;
+  std::vector<char> chars_;
+
+  size_t numStatements_;
+
+  // Only used by build().
+  std::vector<Source> sources_;
+};
+
+}  // namespace hsql
+
+#endif
@@ -0,0 +1,177 @@
+#include "ParallelParser.h"
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "util/LineIndex.h"
+#include "util/StatementSplitter.h"
+
+namespace hsql {
+
+namespace {
+
+// Byte range of a statement in the script.
+struct Slice {
+  size_t begin;
+  size_t end;
+};
+
+// Statements and parameters of a slice in the worker that parsed it.
+struct ParsedSlice {
+  size_t worker;
+  size_t firstStatement;
+  size_t numStatements;
+  size_t firstParameter;
+  size_t numParameters;
+};
+
+struct Worker {
+  // Statements of all slices parsed by the worker, or the error of the slice it stopped at.
+  SQLParserResult result;
+  std::vector<Expr*> parameters;
+  size_t errorSlice = SIZE_MAX;
+};
+
+// Shared state of the workers of one parse.
+struct SliceQueue {
+  const std::string& sql;
+  const std::vector<Slice>& slices;
+  std::vector<ParsedSlice>& parsed;
+  LexerType lexer;
+
+  // Slices are taken in script order.
+  std::atomic<size_t> next;
+  std::atomic<size_t> firstError;
+};
+
+void parseSlices(SliceQueue* queue, size_t workerIndex, Worker* worker) {
+  ParserContext context;
+  context.setLexer(queue->lexer);
+  SQLInputBuffer input;
+
+  size_t i;
+  while ((i = queue->next.fetch_add(1)) < queue->slices.size()) {
+    // The slices behind an invalid one are not needed, and this worker only gets later ones.
+    if (i > queue->firstError.load()) break;
+
+    // Each slice is copied, as the lexer needs the padding behind it.
+    const Slice& slice = queue->slices[i];
+    input.resize(slice.end - slice.begin);
+    memcpy(input.data(), queue->sql.data() + slice.begin, slice.end - slice.begin);
+
+    const size_t numStatements = worker->result.size();
+    context.parse(input, &worker->result);
+    if (!worker->result.isValid()) {
+      worker->errorSlice = i;
+      size_t firstError = queue->firstError.load();
+      while (i < firstError && !queue->firstError.compare_exchange_weak(firstError, i)) {
+      }
+      break;
+    }
+
+    const std::vector<Expr*>& parameters = worker->result.parameters();
+    queue->parsed[i] = {workerIndex, numStatements, worker->result.size() - numStatements, worker->parameters.size(),
+                        parameters.size()};
+    worker->parameters.insert(worker->parameters.end(), parameters.begin(), parameters.end());
+  }
+}
+
+}  // namespace
+
+ParallelParser::ParallelParser(size_t numThreads)
+    : numThreads_(numThreads != 0 ? numThreads : std::max(1u, std::thread::hardware_concurrency())),
+      lexer_(kLexerFlex) {}
+
+bool ParallelParser::parse(const std::string& sql, SQLParserResult* result) {
+  if (numThreads_ == 1) return parseSequentially(sql, result);
+
+  std::vector<Slice> slices;
+  StatementSplitter splitter;
+  size_t position = 0;
+  bool isSplittable = true;
+  while (isSplittable && splitter.scan(sql.data(), &position, sql.size())) {
+    isSplittable = splitter.hasContent() && !splitter.mayStopLexer();
+    slices.push_back({splitter.begin(), position});
+    splitter.reset();
+  }
+  if (isSplittable && splitter.finish()) slices.push_back({splitter.begin(), sql.size()});
+  isSplittable = isSplittable && !splitter.mayStopLexer();
+
+  // Empty statements are syntax errors, which are reported as by a sequential parse. Where the
+  // lexer stops, a sequential parse ends and ignores the statements behind.
+  const size_t numThreads = std::min(numThreads_, slices.size() / kMinStatementsPerThread);
+  if (!isSplittable || numThreads <= 1) return parseSequentially(sql, result);
+
+  std::vector<ParsedSlice> parsed(slices.size());
+  SliceQueue queue{sql, slices, parsed, lexer_, {0}, {slices.size()}};
+  std::vector<Worker> workers(numThreads);
+  std::vector<std::thread> threads;
+  for (size_t w = 0; w < numThreads; ++w) {
+    workers[w].result.setUseArena(result->usesArena());
+    if (w > 0) threads.emplace_back(parseSlices, &queue, w, &workers[w]);
+  }
+  parseSlices(&queue, 0, &workers[0]);
+  for (std::thread& thread : threads) thread.join();
+
+  const size_t firstError = queue.firstError.load();
+  if (firstError < slices.size()) {
+    // Report the error with its location in the script.
+    const Worker& worker =
+        *std::find_if(workers.begin(), workers.end(), [&](const Worker& w) { return w.errorSlice == firstError; });
+    const size_t begin = slices[firstError].begin;
+    const LineIndex lines(sql.data(), begin);
+    const int line = worker.result.errorLine();
+    const int column = worker.result.errorColumn() + (line == 0 ? lines.column(begin) : 0);
+    result->setIsValid(false);
+    result->setErrorDetails(strdup(worker.result.errorMsg()), lines.line(begin) + line, column);
+    return true;
+  }
+
+  std::vector<Expr*> parameters;
+  size_t previousEnd = 0;
+  for (size_t i = 0; i < slices.size(); ++i) {
+    Worker& worker = workers[parsed[i].worker];
+    for (size_t s = 0; s < parsed[i].numStatements; ++s) {
+      // Statements of a sequential parse reach back to the end of the previous statement.
+      SQLStatement* statement = worker.result.getMutableStatement(parsed[i].firstStatement + s);
+      const size_t end = slices[i].begin + statement->stringLength;
+      statement->stringLength = end - previousEnd;
+      previousEnd = end;
+      result->addStatement(statement);
+    }
+
+    // Parameter ids are numbered through the script.
+    for (size_t p = 0; p < parsed[i].numParameters; ++p) {
+      Expr* parameter = worker.parameters[parsed[i].firstParameter + p];
+      parameter->ival = parameters.size();
+      parameter->ival2 = parameters.size();
+      parameters.push_back(parameter);
+    }
+  }
+  result->setParameters(parameters);
+
+  // The statements are owned by the result now.
+  for (Worker& worker : workers) {
+    if (result->usesArena()) {
+      result->arena()->splice(worker.result.releaseArena().get());
+    } else {
+      worker.result.releaseStatements();
+    }
+  }
+  result->setIsValid(true);
+  return true;
+}
+
+bool ParallelParser::parseSequentially(const std::string& sql, SQLParserResult* result) {
+  ParserContext context;
+  context.setLexer(lexer_);
+  return context.parse(sql, result);
+}
+
+void ParallelParser::setLexer(LexerType lexer) { lexer_ = lexer; }
+
+size_t ParallelParser::numThreads() const { return numThreads_; }
+
+}  // namespace hsql
@@ -0,0 +1,46 @@
+#ifndef SQLPARSER_PARALLEL_PARSER_H
+#define SQLPARSER_PARALLEL_PARSER_H
+
+#include <stddef.h>
+#include <string>
+#include "ParserContext.h"
+#include "SQLParserResult.h"
+
+namespace hsql {
+
+// Parses scripts with many statements on multiple threads. A pre-pass splits the script at
+// semicolons outside of string literals, quoted identifiers and comments (see StatementSplitter),
+// the statements are parsed by worker threads that take the next unparsed statement whenever they
+// are done, and the results are merged in script order. The merged result is the same as that
+// of a sequential parse: statement lengths and parameter ids refer to the whole script, and the
+// error of the first invalid statement is reported with its line and column in the script.
+// Short scripts, scripts with empty statements (;;) and scripts in which the lexer may stop before
+// their end (at characters that it does not accept or at unterminated strings) are parsed
+// sequentially.
+class ParallelParser {
+ public:
+  // Scripts need this many statements per thread to be parsed in parallel.
+  static constexpr size_t kMinStatementsPerThread = 16;
+
+  // Uses the given number of threads, or one per core if it is 0.
+  explicit ParallelParser(size_t numThreads = 0);
+
+  // Parses the script into the result, like ParserContext::parse(). In arena mode, the arenas of
+  // the threads are spliced into the arena of the result.
+  bool parse(const std::string& sql, SQLParserResult* result);
+
+  // Selects the lexer of the threads, see ParserContext::setLexer(). kLexerFlex by default.
+  void setLexer(LexerType lexer);
+
+  size_t numThreads() const;
+
+ private:
+  bool parseSequentially(const std::string& sql, SQLParserResult* result);
+
+  size_t numThreads_;
+  LexerType lexer_;
+};
+
+}  // namespace hsql
+
+#endif
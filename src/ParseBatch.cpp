@@ -0,0 +1,78 @@
+#include "ParseBatch.h"
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace hsql {
+
+namespace {
+
+// Workers take this many consecutive queries at a time, so the statements of neighboring
+// queries end up next to each other in the same arena.
+constexpr size_t kQueriesPerTask = 16;
+
+}  // namespace
+
+ParseBatch::ParseBatch(size_t numThreads)
+    : numThreads_(numThreads != 0 ? numThreads : std::max(1u, std::thread::hardware_concurrency())),
+      lexer_(kLexerFlex) {}
+
+ParseBatch::~ParseBatch() { clear(); }
+
+bool ParseBatch::parse(const std::vector<std::string_view>& queries) {
+  clear();
+  results_.resize(queries.size());
+
+  const size_t numThreads = std::max<size_t>(1, std::min(numThreads_, queries.size() / kMinQueriesPerThread));
+  while (workers_.size() < numThreads) workers_.push_back(std::make_unique<Worker>());
+  for (size_t w = 0; w < numThreads; ++w) workers_[w]->context.setLexer(lexer_);
+
+  std::atomic<size_t> next(0);
+  std::atomic<bool> success(true);
+  auto parseQueries = [&](Worker* worker) {
+    size_t begin;
+    while ((begin = next.fetch_add(kQueriesPerTask)) < queries.size()) {
+      const size_t end = std::min(begin + kQueriesPerTask, queries.size());
+      for (size_t i = begin; i < end; ++i) {
+        // The lexer needs the padding behind the query.
+        worker->input.resize(queries[i].size());
+        memcpy(worker->input.data(), queries[i].data(), queries[i].size());
+
+        // All results of a worker share its arena.
+        results_[i].setArena(&worker->arena);
+        if (!worker->context.parse(worker->input, &results_[i])) success = false;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t w = 1; w < numThreads; ++w) threads.emplace_back(parseQueries, workers_[w].get());
+  parseQueries(workers_[0].get());
+  for (std::thread& thread : threads) thread.join();
+  return success.load();
+}
+
+void ParseBatch::clear() {
+  // The statements are owned by the arenas, the results only free their error messages.
+  results_.clear();
+  for (std::unique_ptr<Worker>& worker : workers_) worker->arena.reset();
+}
+
+const SQLParserResult& ParseBatch::operator[](size_t i) const { return results_[i]; }
+
+const std::vector<SQLParserResult>& ParseBatch::results() const { return results_; }
+
+size_t ParseBatch::size() const { return results_.size(); }
+
+void ParseBatch::setLexer(LexerType lexer) { lexer_ = lexer; }
+
+size_t ParseBatch::numThreads() const { return numThreads_; }
+
+size_t ParseBatch::bytesReserved() const {
+  size_t bytes = 0;
+  for (const std::unique_ptr<Worker>& worker : workers_) bytes += worker->arena.bytesReserved();
+  return bytes;
+}
+
+}  // namespace hsql
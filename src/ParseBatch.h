@@ -0,0 +1,70 @@
+#ifndef SQLPARSER_PARSE_BATCH_H
+#define SQLPARSER_PARSE_BATCH_H
+
+#include <stddef.h>
+#include <memory>
+#include <string_view>
+#include <vector>
+#include "ParserContext.h"
+#include "SQLParserResult.h"
+#include "util/Arena.h"
+
+namespace hsql {
+
+// Parses many independent queries, e.g. the entries of a query log, into one result per query.
+// Each worker keeps a ParserContext and allocates the statements of all of its queries from a
+// single arena. Both are kept by the batch and reused by the next call to parse(), so parsing a
+// batch does not create scanners and, once the arenas have grown, barely touches the allocator.
+// The results are stored contiguously in query order and stay valid until the next call to
+// parse() or clear(). Their statements live in the arenas of the batch and must not be released.
+// A batch must not be used by multiple threads at the same time.
+class ParseBatch {
+ public:
+  // Batches need this many queries per thread to be parsed in parallel.
+  static constexpr size_t kMinQueriesPerThread = 64;
+
+  // Uses the given number of threads, or one per core if it is 0.
+  explicit ParseBatch(size_t numThreads = 1);
+  ~ParseBatch();
+
+  ParseBatch(const ParseBatch&) = delete;
+  ParseBatch& operator=(const ParseBatch&) = delete;
+
+  // Replaces the results with those of the given queries. Returns false if the lexer or parser
+  // failed on any query, see ParserContext::parse(). Invalid queries do not stop the batch.
+  // The queries may be slices of a larger buffer, e.g. the lines of a log; they are copied into
+  // the input buffer of their worker and need not stay valid after the call.
+  bool parse(const std::vector<std::string_view>& queries);
+
+  // Releases the results. The memory of the arenas is kept for the next batch.
+  void clear();
+
+  // Result of query i of the last batch.
+  const SQLParserResult& operator[](size_t i) const;
+  const std::vector<SQLParserResult>& results() const;
+  size_t size() const;
+
+  // Selects the lexer of the workers, see ParserContext::setLexer(). kLexerFlex by default.
+  void setLexer(LexerType lexer);
+
+  size_t numThreads() const;
+
+  // Number of bytes reserved by the arenas of the workers.
+  size_t bytesReserved() const;
+
+ private:
+  struct Worker {
+    ParserContext context;
+    SQLInputBuffer input;
+    Arena arena;
+  };
+
+  std::vector<SQLParserResult> results_;
+  std::vector<std::unique_ptr<Worker>> workers_;
+  size_t numThreads_;
+  LexerType lexer_;
+};
+
+}  // namespace hsql
+
+#endif
@@ -0,0 +1,94 @@
+#include "ParseCache.h"
+#include <functional>
+#include "ParserContext.h"
+
+namespace hsql {
+
+namespace {
+
+// Misses are parsed with a context per thread, so that concurrent misses do not serialize.
+ParserContext& threadParserContext() {
+  thread_local ParserContext context;
+  context.setLexer(kLexerSimd);
+  return context;
+}
+
+}  // namespace
+
+ParseCache::ParseCache(size_t memoryBudget) : memoryBudget_(memoryBudget) {}
+
+std::shared_ptr<const SQLParserResult> ParseCache::parse(const std::string& sql) {
+  const uint64_t hash = std::hash<std::string>()(sql);
+  Shard& shard = shards_[hash % kNumShards];
+  {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto found = shard.index.find(hash);
+    if (found != shard.index.end() && found->second->sql == sql) {
+      shard.entries.splice(shard.entries.begin(), shard.entries, found->second);
+      ++shard.hits;
+      return found->second->result;
+    }
+    ++shard.misses;
+  }
+
+  // Parse without holding the lock. If another thread misses on the same query at the
+  // same time, both parse it and the later result replaces the earlier one.
+  std::shared_ptr<SQLParserResult> result = std::make_shared<SQLParserResult>();
+  result->setUseArena(true);
+  threadParserContext().parse(sql, result.get());
+
+  const size_t memoryUsage = sizeof(Entry) + sizeof(SQLParserResult) + sql.size() + result->arena()->bytesReserved();
+  if (memoryUsage <= memoryBudget_ / kNumShards) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    insert(shard, Entry{sql, hash, memoryUsage, result});
+  }
+  return result;
+}
+
+void ParseCache::insert(Shard& shard, Entry entry) {
+  // Replace the result of the same query or of a query with the same hash.
+  auto found = shard.index.find(entry.hash);
+  if (found != shard.index.end()) {
+    shard.memoryUsage -= found->second->memoryUsage;
+    shard.entries.erase(found->second);
+    shard.index.erase(found);
+  }
+
+  shard.memoryUsage += entry.memoryUsage;
+  shard.entries.push_front(std::move(entry));
+  shard.index[shard.entries.front().hash] = shard.entries.begin();
+
+  while (shard.memoryUsage > memoryBudget_ / kNumShards) {
+    const Entry& last = shard.entries.back();
+    shard.memoryUsage -= last.memoryUsage;
+    shard.index.erase(last.hash);
+    shard.entries.pop_back();
+    ++shard.evictions;
+  }
+}
+
+void ParseCache::clear() {
+  for (Shard& shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.entries.clear();
+    shard.index.clear();
+    shard.memoryUsage = 0;
+  }
+}
+
+ParseCacheStatistics ParseCache::statistics() const {
+  ParseCacheStatistics statistics = {0, 0, 0, 0, 0};
+  for (const Shard& shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    statistics.hits += shard.hits;
+    statistics.misses += shard.misses;
+    statistics.evictions += shard.evictions;
+    statistics.size += shard.entries.size();
+    statistics.memoryUsage += shard.memoryUsage;
+  }
+  return statistics;
+}
+
+size_t ParseCache::memoryBudget() const { return memoryBudget_; }
+
+}  // namespace hsql
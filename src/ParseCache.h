@@ -0,0 +1,86 @@
+#ifndef SQLPARSER_PARSE_CACHE_H
+#define SQLPARSER_PARSE_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "SQLParserResult.h"
+
+namespace hsql {
+
+// Counters of a ParseCache.
+struct ParseCacheStatistics {
+  uint64_t hits;
+  uint64_t misses;
+  uint64_t evictions;
+
+  // Number of cached results.
+  size_t size;
+
+  // Estimated memory of the cached results and their query texts in bytes.
+  size_t memoryUsage;
+};
+
+// Thread-safe cache of parse results keyed by the query text, for applications that
+// receive the same statements over and over again. Results are parsed in arena mode,
+// so their memory is known, and shared with the callers as immutable objects.
+// When the memory budget is exceeded, the least recently used results are evicted;
+// results that are still held by callers stay valid until they are released.
+// Invalid queries are cached as well, their results contain the error.
+class ParseCache {
+ public:
+  // The cache is split into shards with separate locks, each gets an equal part of the budget.
+  static constexpr size_t kNumShards = 16;
+
+  explicit ParseCache(size_t memoryBudget);
+
+  ParseCache(const ParseCache&) = delete;
+  ParseCache& operator=(const ParseCache&) = delete;
+
+  // Returns the cached result of the query, parses and caches it on a miss.
+  // Results larger than a shard's budget are returned without being cached.
+  std::shared_ptr<const SQLParserResult> parse(const std::string& sql);
+
+  // Removes all results from the cache. Does not reset the counters.
+  void clear();
+
+  // Returns the sum of the counters of all shards.
+  ParseCacheStatistics statistics() const;
+
+  size_t memoryBudget() const;
+
+ private:
+  struct Entry {
+    std::string sql;
+    uint64_t hash;
+    size_t memoryUsage;
+    std::shared_ptr<const SQLParserResult> result;
+  };
+
+  struct Shard {
+    mutable std::mutex mutex;
+
+    // Most recently used entry first.
+    std::list<Entry> entries;
+    std::unordered_map<uint64_t, std::list<Entry>::iterator> index;
+
+    size_t memoryUsage = 0;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+  };
+
+  // Adds the entry to the shard and evicts entries until it fits into the budget.
+  void insert(Shard& shard, Entry entry);
+
+  const size_t memoryBudget_;
+  Shard shards_[kNumShards];
+};
+
+}  // namespace hsql
+
+#endif
@@ -0,0 +1,173 @@
+#include "ParserContext.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "parser/bison_parser.h"
+#include "parser/flex_lexer.h"
+#include "parser/simd_lexer.h"
+
+// Defined in the user code section of flex_lexer.l.
+void hsql_reset_start_condition(yyscan_t yyscanner);
+
+namespace hsql {
+
+namespace {
+
+SimdLevel simdLevel(LexerType lexer) {
+  static const SimdLevel supported = SimdLexer::detectSimdLevel();
+  return lexer == kLexerSimd ? supported : kSimdNone;
+}
+
+}  // namespace
+
+ParserContext::ParserContext() : scanner_(nullptr), lexer_(kLexerFlex), flattenLogicalOperators_(false) {
+  if (hsql_lex_init(&scanner_)) {
+    // Couldn't initialize the lexer.
+    fprintf(stderr, "SQLParser: Error when initializing lexer!\n");
+    scanner_ = nullptr;
+  }
+}
+
+ParserContext::~ParserContext() {
+  if (scanner_ != nullptr) hsql_lex_destroy(scanner_);
+}
+
+bool ParserContext::parse(const std::string& sql, SQLParserResult* result) {
+  return parse(copyInput(sql), sql.size(), result);
+}
+
+bool ParserContext::parse(SQLInputBuffer& input, SQLParserResult* result) {
+  return parse(input.data(), input.size(), result);
+}
+
+bool ParserContext::parse(char* buffer, size_t length, SQLParserResult* result) {
+  if (scanner_ == nullptr || buffer == nullptr) return false;
+  if (buffer[length] != '\0' || buffer[length + 1] != '\0') {
+    fprintf(stderr, "SQLParser: Input buffer is not terminated by two null bytes!\n");
+    return false;
+  }
+
+  YY_BUFFER_STATE state = nullptr;
+  if (lexer_ == kLexerFlex) {
+    hsql_reset_start_condition(scanner_);
+    state = hsql__scan_buffer(buffer, length + SQLInputBuffer::kPadding, scanner_);
+    if (state == nullptr) return false;
+  }
+
+  // In arena mode, the lexer returns identifiers and literals as slices of a copy of the input
+  // that is kept in the arena instead of allocating each of them. Results without an arena
+  // allocate from the heap, even within an ArenaScope, since they delete their statements.
+  Arena* arena = result->arena();
+  parameters_.clear();
+  ParseState parseState = {
+      buffer, arena != nullptr ? arena->copyString(buffer, length) : nullptr, &parameters_, 0, nullptr, flattenLogicalOperators_};
+  SimdLexer simdLexer(buffer, length, &parseState, simdLevel(lexer_));
+  if (lexer_ != kLexerFlex) parseState.lexer = &simdLexer;
+  hsql_set_extra(&parseState, scanner_);
+
+  // Parse the tokens.
+  // If parsing fails, the result will contain an error object.
+  // In arena mode, all allocations of the lexer and parser are served by the result's arena.
+  ArenaScope arenaScope(arena);
+  int ret = hsql_parse(result, scanner_);
+  bool success = (ret == 0);
+  result->setIsValid(success);
+
+  if (state != nullptr) hsql__delete_buffer(state, scanner_);
+  return true;
+}
+
+const SQLParserResult& ParserContext::parse(const std::string& sql) {
+  result_.reset();
+  parse(sql, &result_);
+  return result_;
+}
+
+bool ParserContext::tokenize(const std::string& sql, std::vector<int16_t>* tokens) {
+  if (scanner_ == nullptr) return false;
+
+  char* buffer = copyInput(sql);
+  ParseState parseState = {buffer, nullptr, nullptr, 0, nullptr, false};
+  hsql_set_extra(&parseState, scanner_);
+  SimdLexer simdLexer(buffer, sql.size(), &parseState, simdLevel(lexer_));
+
+  YY_BUFFER_STATE state = nullptr;
+  if (lexer_ == kLexerFlex) {
+    hsql_reset_start_condition(scanner_);
+    state = hsql__scan_buffer(buffer, sql.size() + SQLInputBuffer::kPadding, scanner_);
+  }
+
+  YYSTYPE yylval;
+  YYLTYPE yylloc = {0, 0};
+
+  // Step through the string until EOF is read.
+  // Note: hsql_lex returns int, but we know that its range is within 16 bit.
+  int16_t token = 0;
+  do {
+    token = lexer_ == kLexerFlex ? hsql_lex(&yylval, &yylloc, scanner_) : simdLexer.next(&yylval, &yylloc);
+    if (token != 0) tokens->push_back(token);
+    if (token == SQL_IDENTIFIER || token == SQL_STRING) {
+      free(yylval.sval);
+    }
+  } while (token != 0);
+
+  if (state != nullptr) hsql__delete_buffer(state, scanner_);
+  return true;
+}
+
+bool ParserContext::tokenize(const std::string& sql, TokenStream* tokens) {
+  tokens->clear();
+  if (sql.size() > UINT32_MAX) return false;
+
+  char* buffer = copyInput(sql);
+  SimdLexer simdLexer(buffer, sql.size(), nullptr, simdLevel(kLexerSimd));
+
+  YYSTYPE yylval;
+  YYLTYPE yylloc = {0, 0};
+  int token;
+  while ((token = simdLexer.next(&yylval, &yylloc)) != 0 && !simdLexer.hasError()) {
+    const size_t offset = simdLexer.tokenOffset();
+    TokenValue value;
+    if (token == SQL_INTVAL) {
+      value.ival = yylval.ival;
+    } else if (token == SQL_FLOATVAL) {
+      value.fval = yylval.fval;
+    } else {
+      value.ival = 0;
+    }
+    tokens->add(token, offset, yylloc.last_offset - offset, value);
+  }
+
+  tokens->setIsComplete(!simdLexer.hasError());
+  return true;
+}
+
+bool ParserContext::fingerprint(const std::string& sql, QueryFingerprint* fingerprint) {
+  fingerprint->reset();
+  if (!tokenize(sql, &tokens_)) return false;
+  fingerprint->compute(sql, tokens_);
+  return true;
+}
+
+char* ParserContext::copyInput(const std::string& sql) {
+  const size_t size = sql.size() + SQLInputBuffer::kPadding;
+  if (buffer_.size() < size) buffer_.resize(size);
+
+  memcpy(buffer_.data(), sql.data(), sql.size());
+  memset(buffer_.data() + sql.size(), '\0', SQLInputBuffer::kPadding);
+  return buffer_.data();
+}
+
+void ParserContext::setLexer(LexerType lexer) { lexer_ = lexer; }
+
+LexerType ParserContext::lexer() const { return lexer_; }
+
+void ParserContext::setFlattenLogicalOperators(bool flatten) { flattenLogicalOperators_ = flatten; }
+
+bool ParserContext::flattensLogicalOperators() const { return flattenLogicalOperators_; }
+
+SQLParserResult& ParserContext::result() { return result_; }
+
+bool ParserContext::isValid() const { return scanner_ != nullptr; }
+
+}  // namespace hsql
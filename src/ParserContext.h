@@ -0,0 +1,107 @@
+#ifndef SQLPARSER_PARSER_CONTEXT_H
+#define SQLPARSER_PARSER_CONTEXT_H
+
+#include <string>
+#include <vector>
+#include "QueryFingerprint.h"
+#include "SQLInputBuffer.h"
+#include "SQLParserResult.h"
+#include "TokenStream.h"
+
+namespace hsql {
+
+// Lexers that can produce the tokens for the parser.
+enum LexerType {
+  kLexerFlex,   // Scanner generated by flex (src/parser/flex_lexer.l)
+  kLexerSimd,   // Hand-written lexer using the best instruction set supported by the CPU
+  kLexerScalar  // Hand-written lexer without SIMD instructions
+};
+
+// Stateful parser that keeps the lexer state, its input buffer and a result
+// alive between parses. Creating the scanner and copying the input into a freshly
+// allocated buffer dominates the parse time of short statements, so callers that
+// parse many queries should keep one context per thread and reuse it.
+// A context must not be used by multiple threads at the same time.
+class ParserContext {
+ public:
+  ParserContext();
+  ~ParserContext();
+
+  ParserContext(const ParserContext&) = delete;
+  ParserContext& operator=(const ParserContext&) = delete;
+
+  // Parses a given SQL string into the result object.
+  // Returns true if the lexer and parser could run without internal errors.
+  // This does NOT mean that the SQL string was valid SQL. To check that
+  // you need to check result->isValid();
+  // In arena mode, the statements are allocated from the arena of the result. Otherwise they
+  // are allocated from the heap, even if an ArenaScope is active on the calling thread.
+  bool parse(const std::string& sql, SQLParserResult* result);
+
+  // Parses the query in the given buffer without copying it.
+  bool parse(SQLInputBuffer& input, SQLParserResult* result);
+
+  // Parses length characters at buffer without copying them. buffer[length] and
+  // buffer[length + 1] have to be null bytes (see SQLInputBuffer::kPadding).
+  // The buffer is temporarily modified during the parse and restored afterwards.
+  // Returns false if the padding is missing.
+  bool parse(char* buffer, size_t length, SQLParserResult* result);
+
+  // Resets the result owned by the context and parses the SQL string into it.
+  // The returned result stays valid until the next call to parse().
+  const SQLParserResult& parse(const std::string& sql);
+
+  // Run tokenization on the given string and store the tokens in the output vector.
+  bool tokenize(const std::string& sql, std::vector<int16_t>* tokens);
+
+  // Replaces the content of the stream with the tokens of the given string, their byte
+  // ranges and the values of numeric literals. Always scans with the hand-written lexer and
+  // does not create identifiers or strings, so the stream is filled without allocations
+  // once its buffers are large enough. Returns false if the string exceeds 4 GiB.
+  bool tokenize(const std::string& sql, TokenStream* tokens);
+
+  // Computes the fingerprint of the given string from its tokens, without parsing it.
+  // Returns false if the string exceeds 4 GiB. Check fingerprint->isValid() for lexer
+  // errors and malformed literals.
+  bool fingerprint(const std::string& sql, QueryFingerprint* fingerprint);
+
+  // Selects the lexer used by parse() and tokenize(). All lexers produce the same tokens,
+  // the hand-written lexer is faster on long statements. kLexerFlex by default.
+  void setLexer(LexerType lexer);
+  LexerType lexer() const;
+
+  // If enabled, chains of AND and OR are parsed into one flat node per chain whose operands are
+  // in Expr::exprList (see Expr::makeOpNary), instead of a tree of binary nodes. Disabled by default.
+  void setFlattenLogicalOperators(bool flatten);
+  bool flattensLogicalOperators() const;
+
+  // Returns the result that is reused by parse(const std::string&),
+  // e.g. to enable arena mode for it.
+  SQLParserResult& result();
+
+  // Returns false if the lexer could not be initialized.
+  bool isValid() const;
+
+ private:
+  // Copies sql into the reused input buffer, followed by the padding.
+  char* copyInput(const std::string& sql);
+
+  void* scanner_;
+  LexerType lexer_;
+  bool flattenLogicalOperators_;
+
+  // Input buffer with the two trailing null bytes flex requires.
+  std::vector<char> buffer_;
+
+  // Parameters collected during a parse.
+  std::vector<Expr*> parameters_;
+
+  // Tokens of the last fingerprinted query.
+  TokenStream tokens_;
+
+  SQLParserResult result_;
+};
+
+}  // namespace hsql
+
+#endif
@@ -0,0 +1,156 @@
+#include "ParserService.h"
+#include <string.h>
+#include <algorithm>
+#include <memory>
+
+namespace hsql {
+
+ParserService::ParserService(size_t numThreads, size_t queueCapacity)
+    : queueCapacity_(queueCapacity),
+      lexer_(kLexerFlex),
+      nextId_(1),
+      numActiveLarge_(0),
+      stopping_(false),
+      statistics_() {
+  if (numThreads == 0) numThreads = std::thread::hardware_concurrency();
+  // One worker is always left for short queries.
+  numThreads = std::max<size_t>(2, numThreads);
+  maxActiveLarge_ = numThreads - 1;
+  for (size_t i = 0; i < numThreads; ++i) threads_.emplace_back(&ParserService::work, this);
+}
+
+ParserService::~ParserService() {
+  std::vector<Request> cancelled;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+    for (auto& entry : requests_) cancelled.push_back(std::move(entry.second));
+    statistics_.cancelled += requests_.size();
+    requests_.clear();
+    smallQueue_.clear();
+    largeQueue_.clear();
+  }
+  workAvailable_.notify_all();
+
+  for (Request& request : cancelled) request.callback(makeError("Parse request was cancelled."));
+  for (std::thread& thread : threads_) thread.join();
+}
+
+ParseRequestId ParserService::submit(std::string sql, Callback callback) {
+  const bool isLarge = sql.size() >= kLargeQuerySize;
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (stopping_ || requests_.size() >= queueCapacity_) {
+    ++statistics_.rejected;
+    return 0;
+  }
+
+  const ParseRequestId id = nextId_++;
+  requests_.emplace(id, Request{std::move(sql), std::move(callback), isLarge});
+  (isLarge ? largeQueue_ : smallQueue_).push_back(id);
+  ++statistics_.submitted;
+  statistics_.peakQueueDepth = std::max(statistics_.peakQueueDepth, requests_.size());
+  workAvailable_.notify_one();
+  return id;
+}
+
+std::future<SQLParserResult> ParserService::submit(std::string sql, ParseRequestId* id) {
+  // std::function has to be copyable, the promise is not.
+  std::shared_ptr<std::promise<SQLParserResult>> promise = std::make_shared<std::promise<SQLParserResult>>();
+  std::future<SQLParserResult> future = promise->get_future();
+  const ParseRequestId submitted =
+      submit(std::move(sql), [promise](SQLParserResult&& result) { promise->set_value(std::move(result)); });
+  if (submitted == 0) promise->set_value(makeError("Parse queue is full."));
+  if (id != nullptr) *id = submitted;
+  return future;
+}
+
+bool ParserService::cancel(ParseRequestId id) {
+  Request request;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto found = requests_.find(id);
+    if (found == requests_.end()) return false;
+    request = std::move(found->second);
+    requests_.erase(found);
+    ++statistics_.cancelled;
+
+    // The queues hold their ids in ascending order.
+    std::deque<ParseRequestId>& queue = request.isLarge ? largeQueue_ : smallQueue_;
+    queue.erase(std::lower_bound(queue.begin(), queue.end(), id));
+  }
+  request.callback(makeError("Parse request was cancelled."));
+  return true;
+}
+
+ParserServiceStatistics ParserService::statistics() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  ParserServiceStatistics statistics = statistics_;
+  statistics.queueDepth = requests_.size();
+  return statistics;
+}
+
+void ParserService::setLexer(LexerType lexer) { lexer_ = lexer; }
+
+size_t ParserService::numThreads() const { return threads_.size(); }
+
+size_t ParserService::queueCapacity() const { return queueCapacity_; }
+
+void ParserService::work() {
+  ParserContext context;
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    ParseRequestId id = 0;
+    while (!stopping_ && (id = nextRequest()) == 0) workAvailable_.wait(lock);
+    if (stopping_) return;
+
+    auto found = requests_.find(id);
+    Request request = std::move(found->second);
+    requests_.erase(found);
+    ++statistics_.numActive;
+    if (request.isLarge) ++numActiveLarge_;
+    lock.unlock();
+
+    context.setLexer(lexer_.load());
+    SQLParserResult result;
+    context.parse(request.sql, &result);
+
+    // The request counts as completed before the callback runs, e.g. before its future is ready.
+    lock.lock();
+    ++statistics_.completed;
+    lock.unlock();
+    request.callback(std::move(result));
+
+    lock.lock();
+    --statistics_.numActive;
+    if (request.isLarge) {
+      // A worker may be waiting for a large request to become available.
+      --numActiveLarge_;
+      if (!largeQueue_.empty()) workAvailable_.notify_one();
+    }
+  }
+}
+
+ParseRequestId ParserService::nextRequest() {
+  if (!smallQueue_.empty()) {
+    const ParseRequestId id = smallQueue_.front();
+    smallQueue_.pop_front();
+    return id;
+  }
+
+  if (numActiveLarge_ >= maxActiveLarge_) return 0;
+  if (!largeQueue_.empty()) {
+    const ParseRequestId id = largeQueue_.front();
+    largeQueue_.pop_front();
+    return id;
+  }
+  return 0;
+}
+
+SQLParserResult ParserService::makeError(const char* message) {
+  SQLParserResult result;
+  result.setIsValid(false);
+  result.setErrorDetails(strdup(message), -1, -1);
+  return result;
+}
+
+}  // namespace hsql
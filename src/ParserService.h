@@ -0,0 +1,119 @@
+#ifndef SQLPARSER_PARSER_SERVICE_H
+#define SQLPARSER_PARSER_SERVICE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "ParserContext.h"
+#include "SQLParserResult.h"
+
+namespace hsql {
+
+// Identifies a submitted request, e.g. to cancel it. 0 if the request was rejected.
+typedef uint64_t ParseRequestId;
+
+struct ParserServiceStatistics {
+  // Requests that wait for a worker, and the highest number since the service was started.
+  size_t queueDepth;
+  size_t peakQueueDepth;
+
+  // Requests that are being parsed.
+  size_t numActive;
+
+  uint64_t submitted;
+  uint64_t completed;
+  uint64_t rejected;
+  uint64_t cancelled;
+};
+
+// Parses queries asynchronously on a pool of worker threads, e.g. for an event-driven server
+// whose I/O threads must not block on a parse. Requests wait in a bounded queue; submitting to a
+// full queue fails immediately instead of blocking the caller. Queued requests can be cancelled.
+//
+// Queries of at least kLargeQuerySize bytes are queued separately and are parsed by all but one
+// worker at most, so a few huge statements cannot delay the short queries that arrive behind them.
+// Short queries are always taken first.
+class ParserService {
+ public:
+  // Called with the result of a request. Runs on a worker thread, or on the thread that cancels
+  // the request. Cancelled requests get an invalid result with an error message.
+  typedef std::function<void(SQLParserResult&& result)> Callback;
+
+  static constexpr size_t kDefaultQueueCapacity = 1024;
+  static constexpr size_t kLargeQuerySize = 64 << 10;
+
+  // Starts the given number of workers, or one per core if it is 0. At least two workers are
+  // started, so that one is left for short queries while another one parses a large query.
+  explicit ParserService(size_t numThreads = 0, size_t queueCapacity = kDefaultQueueCapacity);
+
+  // Cancels all queued requests and waits for the workers to finish the requests they are parsing.
+  ~ParserService();
+
+  ParserService(const ParserService&) = delete;
+  ParserService& operator=(const ParserService&) = delete;
+
+  // Queues the query. Returns 0 without calling the callback if the queue is full.
+  ParseRequestId submit(std::string sql, Callback callback);
+
+  // Queues the query and returns a future for its result. If the queue is full, the future is
+  // ready immediately and holds an invalid result. The id of the request is stored in id, if given.
+  std::future<SQLParserResult> submit(std::string sql, ParseRequestId* id = nullptr);
+
+  // Removes the request from the queue and completes it with an invalid result on the calling
+  // thread. Returns false if it is no longer queued, i.e. it is being parsed or has completed.
+  bool cancel(ParseRequestId id);
+
+  ParserServiceStatistics statistics() const;
+
+  // Selects the lexer of the workers for subsequent requests, see ParserContext::setLexer().
+  void setLexer(LexerType lexer);
+
+  size_t numThreads() const;
+  size_t queueCapacity() const;
+
+ private:
+  struct Request {
+    std::string sql;
+    Callback callback;
+    bool isLarge;
+  };
+
+  void work();
+
+  // Returns the id of the next request a worker may take, or 0. Requires the lock.
+  ParseRequestId nextRequest();
+
+  static SQLParserResult makeError(const char* message);
+
+  const size_t queueCapacity_;
+  std::atomic<LexerType> lexer_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable workAvailable_;
+
+  // Queued requests by id. The queues hold their ids in submission order, cancel() removes them.
+  std::unordered_map<ParseRequestId, Request> requests_;
+  std::deque<ParseRequestId> smallQueue_;
+  std::deque<ParseRequestId> largeQueue_;
+  ParseRequestId nextId_;
+
+  size_t numActiveLarge_;
+  size_t maxActiveLarge_;
+  bool stopping_;
+  ParserServiceStatistics statistics_;
+
+  std::vector<std::thread> threads_;
+};
+
+}  // namespace hsql
+
+#endif
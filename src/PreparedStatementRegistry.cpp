@@ -0,0 +1,65 @@
+#include "PreparedStatementRegistry.h"
+
+namespace hsql {
+
+PreparedQuery::PreparedQuery(const std::string& name, const std::string& query, ParserContext& context)
+    : name_(name), query_(query) {
+  // The statements are never modified, so they can live in a single arena.
+  result_.setUseArena(true);
+  context.parse(query_, &result_);
+}
+
+const std::string& PreparedQuery::name() const { return name_; }
+
+const std::string& PreparedQuery::query() const { return query_; }
+
+const SQLParserResult& PreparedQuery::result() const { return result_; }
+
+size_t PreparedQuery::numParameters() const { return result_.parameters().size(); }
+
+const Expr* BoundStatement::argument(const Expr* parameter) const {
+  if (parameter->type != kExprParameter || parameter->ival < 0 ||
+      static_cast<uint64_t>(parameter->ival) >= arguments.size()) {
+    return nullptr;
+  }
+  return arguments[parameter->ival];
+}
+
+const std::vector<SQLStatement*>& BoundStatement::statements() const { return query->result().getStatements(); }
+
+std::shared_ptr<const PreparedQuery> PreparedStatementRegistry::prepare(const std::string& name,
+                                                                        const std::string& query) {
+  std::shared_ptr<const PreparedQuery> prepared = std::make_shared<const PreparedQuery>(name, query, context_);
+  if (prepared->result().isValid()) queries_[name] = prepared;
+  return prepared;
+}
+
+std::shared_ptr<const PreparedQuery> PreparedStatementRegistry::prepare(const PrepareStatement& statement) {
+  return prepare(statement.name, statement.query);
+}
+
+bool PreparedStatementRegistry::deallocate(const std::string& name) { return queries_.erase(name) > 0; }
+
+std::shared_ptr<const PreparedQuery> PreparedStatementRegistry::find(const std::string& name) const {
+  auto found = queries_.find(name);
+  return found != queries_.end() ? found->second : nullptr;
+}
+
+bool PreparedStatementRegistry::bind(const ExecuteStatement& statement, BoundStatement* bound) const {
+  auto found = queries_.find(statement.name);
+  if (found == queries_.end()) return false;
+
+  const size_t numArguments = statement.parameters != nullptr ? statement.parameters->size() : 0;
+  if (numArguments != found->second->numParameters()) return false;
+
+  bound->query = found->second;
+  bound->arguments.clear();
+  if (statement.parameters != nullptr) {
+    bound->arguments.insert(bound->arguments.end(), statement.parameters->begin(), statement.parameters->end());
+  }
+  return true;
+}
+
+size_t PreparedStatementRegistry::size() const { return queries_.size(); }
+
+}  // namespace hsql
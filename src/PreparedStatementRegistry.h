@@ -0,0 +1,93 @@
+#ifndef SQLPARSER_PREPARED_STATEMENT_REGISTRY_H
+#define SQLPARSER_PREPARED_STATEMENT_REGISTRY_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "ParserContext.h"
+#include "SQLParserResult.h"
+#include "sql/statements.h"
+
+namespace hsql {
+
+// Query of a PREPARE statement, parsed once. The parameters of its statements are
+// numbered in the order of the query (Expr::ival) and listed in result().parameters().
+// A prepared query is immutable and may be shared between threads.
+class PreparedQuery {
+ public:
+  // Parses the query with the given context.
+  PreparedQuery(const std::string& name, const std::string& query, ParserContext& context);
+
+  PreparedQuery(const PreparedQuery&) = delete;
+  PreparedQuery& operator=(const PreparedQuery&) = delete;
+
+  const std::string& name() const;
+  const std::string& query() const;
+
+  // Contains the statements of the query, or the error if it is invalid.
+  const SQLParserResult& result() const;
+
+  size_t numParameters() const;
+
+ private:
+  const std::string name_;
+  const std::string query_;
+  SQLParserResult result_;
+};
+
+// Statements of a prepared query together with the arguments of an EXECUTE statement.
+// Instead of copying the statements, the parameters are resolved through argument().
+// The arguments are owned by the result that contains the EXECUTE statement and are
+// only valid as long as that result.
+struct BoundStatement {
+  std::shared_ptr<const PreparedQuery> query;
+
+  // Argument i is bound to the parameter with ival i.
+  std::vector<const Expr*> arguments;
+
+  // Returns the argument of a kExprParameter expression of the prepared query, or nullptr if
+  // there are too few arguments, e.g. if they were not bound by PreparedStatementRegistry::bind().
+  const Expr* argument(const Expr* parameter) const;
+
+  const std::vector<SQLStatement*>& statements() const;
+};
+
+// Prepared queries by name, e.g. of a client session. PREPARE parses a query once,
+// EXECUTE binds its arguments in O(#parameters) without parsing the query again.
+// A registry must not be used by multiple threads at the same time.
+class PreparedStatementRegistry {
+ public:
+  PreparedStatementRegistry() = default;
+
+  PreparedStatementRegistry(const PreparedStatementRegistry&) = delete;
+  PreparedStatementRegistry& operator=(const PreparedStatementRegistry&) = delete;
+
+  // Parses the query and registers it under the name, replacing a previous query of that name.
+  // If the query is invalid, it is returned, but not registered, and the previous query is kept.
+  std::shared_ptr<const PreparedQuery> prepare(const std::string& name, const std::string& query);
+  std::shared_ptr<const PreparedQuery> prepare(const PrepareStatement& statement);
+
+  // Removes the query, e.g. for DEALLOCATE PREPARE. Returns false if there is none with that name.
+  bool deallocate(const std::string& name);
+
+  // Returns the query registered under the name, or nullptr.
+  std::shared_ptr<const PreparedQuery> find(const std::string& name) const;
+
+  // Binds the arguments of the EXECUTE statement to the parameters of the prepared query.
+  // Returns false if no query is registered under its name or the number of arguments differs.
+  bool bind(const ExecuteStatement& statement, BoundStatement* bound) const;
+
+  // Number of registered queries.
+  size_t size() const;
+
+ private:
+  std::unordered_map<std::string, std::shared_ptr<const PreparedQuery>> queries_;
+
+  // Parses the prepared queries.
+  ParserContext context_;
+};
+
+}  // namespace hsql
+
+#endif
@@ -0,0 +1,359 @@
+#include "QueryFingerprint.h"
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include "parser/bison_parser.h"
+
+namespace hsql {
+
+namespace {
+
+// Returns true for the types whose length or precision follows in parentheses, e.g. VARCHAR(10).
+bool hasTypeModifier(int16_t kind) {
+  return kind == SQL_CHAR || kind == SQL_CHARACTER_VARYING || kind == SQL_VARCHAR || kind == SQL_DECIMAL ||
+         kind == SQL_TIME;
+}
+
+// Returns true for the tokens that can follow an item of an ORDER BY or GROUP BY list.
+bool endsListItem(int16_t kind) {
+  switch (kind) {
+    case ',':
+    case ')':
+    case ';':
+    case SQL_ASC:
+    case SQL_DESC:
+    case SQL_HAVING:
+    case SQL_ORDER:
+    case SQL_LIMIT:
+    case SQL_OFFSET:
+    case SQL_UNION:
+    case SQL_INTERSECT:
+    case SQL_EXCEPT:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Returns true for the tokens that end the ORDER BY and GROUP BY lists of their query.
+bool endsQueryClauses(int16_t kind) {
+  return kind == ';' || kind == SQL_SELECT || kind == SQL_HAVING || kind == SQL_LIMIT || kind == SQL_OFFSET ||
+         kind == SQL_UNION || kind == SQL_INTERSECT || kind == SQL_EXCEPT;
+}
+
+// Returns the unit of a duration keyword, kDatetimeNone for all other tokens.
+// After INTERVAL 'n' only the singular keywords are allowed, see interval_literal in bison_parser.y.
+DatetimeField durationField(int16_t kind, bool allowPlural) {
+  switch (kind) {
+    case SQL_SECOND:
+      return kDatetimeSecond;
+    case SQL_MINUTE:
+      return kDatetimeMinute;
+    case SQL_HOUR:
+      return kDatetimeHour;
+    case SQL_DAY:
+      return kDatetimeDay;
+    case SQL_MONTH:
+      return kDatetimeMonth;
+    case SQL_YEAR:
+      return kDatetimeYear;
+    default:
+      break;
+  }
+  if (!allowPlural) return kDatetimeNone;
+  switch (kind) {
+    case SQL_SECONDS:
+      return kDatetimeSecond;
+    case SQL_MINUTES:
+      return kDatetimeMinute;
+    case SQL_HOURS:
+      return kDatetimeHour;
+    case SQL_DAYS:
+      return kDatetimeDay;
+    case SQL_MONTHS:
+      return kDatetimeMonth;
+    case SQL_YEARS:
+      return kDatetimeYear;
+    default:
+      return kDatetimeNone;
+  }
+}
+
+// Returns the unit of an interval qualifier in a string like '2 days'.
+DatetimeField durationField(const char* unit) {
+  if (strcasecmp(unit, "second") == 0 || strcasecmp(unit, "seconds") == 0) return kDatetimeSecond;
+  if (strcasecmp(unit, "minute") == 0 || strcasecmp(unit, "minutes") == 0) return kDatetimeMinute;
+  if (strcasecmp(unit, "hour") == 0 || strcasecmp(unit, "hours") == 0) return kDatetimeHour;
+  if (strcasecmp(unit, "day") == 0 || strcasecmp(unit, "days") == 0) return kDatetimeDay;
+  if (strcasecmp(unit, "month") == 0 || strcasecmp(unit, "months") == 0) return kDatetimeMonth;
+  if (strcasecmp(unit, "year") == 0 || strcasecmp(unit, "years") == 0) return kDatetimeYear;
+  return kDatetimeNone;
+}
+
+// Stores the unescaped content of the string literal token at offset in value.
+void unescapeString(const std::string& sql, uint32_t offset, uint32_t length, std::string* value) {
+  value->clear();
+  const char* text = sql.data() + offset + 1;
+  const char* end = sql.data() + offset + length - 1;
+  while (text < end) {
+    value->push_back(*text);
+    // Quotes are escaped by doubling them.
+    text += *text == '\'' ? 2 : 1;
+  }
+}
+
+}  // namespace
+
+QueryFingerprint::QueryFingerprint() : hash_(0), textSize_(0), lastKind_(0), isValid_(true) {}
+
+bool QueryFingerprint::isValid() const { return isValid_; }
+
+const std::string& QueryFingerprint::text() const { return text_; }
+
+uint64_t QueryFingerprint::hash() const { return hash_; }
+
+const std::vector<FingerprintLiteral>& QueryFingerprint::literals() const { return literals_; }
+
+void QueryFingerprint::reset() {
+  text_.clear();
+  textSize_ = 0;
+  hash_ = 0;
+  literals_.clear();
+  lastKind_ = 0;
+  isValid_ = true;
+}
+
+void QueryFingerprint::compute(const std::string& sql, const TokenStream& tokens) {
+  reset();
+
+  // Each token is at most as long as in the query, plus a separating space. Only collapsed
+  // IN lists grow by two characters, but they consist of at least three tokens.
+  text_.resize(sql.size() + 2 * tokens.size());
+  if (!tokens.isComplete() || !normalize(sql, tokens)) {
+    text_.clear();
+    literals_.clear();
+    isValid_ = false;
+    return;
+  }
+  text_.resize(textSize_);
+
+  // FNV-1a over 8 byte words, followed by the finalizer of MurmurHash3 to mix the high bits into the low ones.
+  hash_ = 14695981039346656037ULL;
+  size_t position = 0;
+  for (; position + 8 <= textSize_; position += 8) {
+    uint64_t word;
+    memcpy(&word, text_.data() + position, 8);
+    hash_ = (hash_ ^ word) * 1099511628211ULL;
+  }
+  for (; position < textSize_; ++position) {
+    hash_ = (hash_ ^ static_cast<uint8_t>(text_[position])) * 1099511628211ULL;
+  }
+  hash_ ^= hash_ >> 33;
+  hash_ *= 0xff51afd7ed558ccdULL;
+  hash_ ^= hash_ >> 33;
+  hash_ *= 0xc4ceb9fe1a85ec53ULL;
+  hash_ ^= hash_ >> 33;
+}
+
+bool QueryFingerprint::normalize(const std::string& sql, const TokenStream& tokens) {
+  const std::vector<int16_t>& kinds = tokens.kinds();
+  // Parenthesis depths of the ORDER BY and GROUP BY lists that are being read, innermost last.
+  std::vector<size_t> lists;
+  size_t depth = 0;
+  size_t i = 0;
+  while (i < tokens.size()) {
+    // The parser rejects invalid tokens, so their query must not share a key with a valid one.
+    if (kinds[i] == SQL_HSQL_UNDEF) return false;
+
+    // Type modifiers and array indexes are integers in the grammar, not literals.
+    if (kinds[i] == '(' && i > 0 && hasTypeModifier(kinds[i - 1])) {
+      for (; i < tokens.size() && kinds[i] != ')'; ++i) appendToken(sql, tokens, i);
+      ++depth;
+      continue;
+    }
+    if (kinds[i] == '[' && (i == 0 || kinds[i - 1] != SQL_ARRAY) && i + 1 < tokens.size() &&
+        kinds[i + 1] == SQL_INTVAL) {
+      appendToken(sql, tokens, i);
+      appendToken(sql, tokens, i + 1);
+      i += 2;
+      continue;
+    }
+
+    // So are the integers that make up a whole item of an ORDER BY or GROUP BY list: they are the
+    // positions of columns of the select list, e.g. ORDER BY 2.
+    if (kinds[i] == SQL_INTVAL && !lists.empty() && lists.back() == depth &&
+        (kinds[i - 1] == SQL_BY || kinds[i - 1] == ',') && (i + 1 == tokens.size() || endsListItem(kinds[i + 1]))) {
+      appendToken(sql, tokens, i);
+      ++i;
+      continue;
+    }
+
+    const size_t end = literalEnd(tokens, i);
+    if (end > i) {
+      if (!addLiteral(sql, tokens, i, end)) return false;
+      append("?", 1, '?', false);
+      i = end;
+      continue;
+    }
+
+    if (kinds[i] == SQL_IN && i + 1 < tokens.size() && kinds[i + 1] == '(') {
+      // Find the end of the list if it only consists of literals.
+      size_t close = 0;
+      for (size_t j = i + 2; j < tokens.size();) {
+        const size_t literal = literalEnd(tokens, j);
+        if (literal == j || literal == tokens.size()) break;
+        if (kinds[literal] == ')') {
+          close = literal;
+          break;
+        }
+        if (kinds[literal] != ',') break;
+        j = literal + 1;
+      }
+
+      if (close != 0) {
+        for (size_t j = i + 2; j < close;) {
+          const size_t literal = literalEnd(tokens, j);
+          if (!addLiteral(sql, tokens, j, literal)) return false;
+          j = literal + 1;
+        }
+        appendToken(sql, tokens, i);
+        append("(...)", 5, '(', false);
+        lastKind_ = ')';
+        i = close + 1;
+        continue;
+      }
+    }
+
+    if (kinds[i] == '(') {
+      ++depth;
+    } else if (kinds[i] == ')') {
+      if (depth > 0) --depth;
+      while (!lists.empty() && lists.back() > depth) lists.pop_back();
+    } else if (kinds[i] == SQL_BY && i > 0 && (kinds[i - 1] == SQL_ORDER || kinds[i - 1] == SQL_GROUP)) {
+      // ORDER BY replaces the GROUP BY list of the same query.
+      if (!lists.empty() && lists.back() == depth) lists.pop_back();
+      lists.push_back(depth);
+    } else if (endsQueryClauses(kinds[i])) {
+      while (!lists.empty() && lists.back() >= depth) lists.pop_back();
+    }
+    appendToken(sql, tokens, i);
+    ++i;
+  }
+  return true;
+}
+
+size_t QueryFingerprint::literalEnd(const TokenStream& tokens, size_t i) const {
+  const std::vector<int16_t>& kinds = tokens.kinds();
+  const bool hasNext = i + 1 < tokens.size();
+  switch (kinds[i]) {
+    case SQL_INTVAL:
+      // 2 DAYS
+      return hasNext && durationField(kinds[i + 1], true) != kDatetimeNone ? i + 2 : i + 1;
+    case SQL_FLOATVAL:
+    case SQL_STRING:
+    case '?':
+      return i + 1;
+    case SQL_DATE:
+      return hasNext && kinds[i + 1] == SQL_STRING ? i + 2 : i;
+    case SQL_INTERVAL:
+      // INTERVAL '2 days' or INTERVAL '2' DAY
+      if (!hasNext || kinds[i + 1] != SQL_STRING) return i;
+      return i + 2 < tokens.size() && durationField(kinds[i + 2], false) != kDatetimeNone ? i + 3 : i + 2;
+    default:
+      return i;
+  }
+}
+
+bool QueryFingerprint::addLiteral(const std::string& sql, const TokenStream& tokens, size_t begin, size_t end) {
+  const std::vector<int16_t>& kinds = tokens.kinds();
+  const uint32_t offset = tokens.offsets()[begin];
+  literals_.push_back(FingerprintLiteral{kExprLiteralInt, 0, 0.0, std::string(), kDatetimeNone, offset,
+                                         tokens.offsets()[end - 1] + tokens.lengths()[end - 1] - offset});
+  FingerprintLiteral& literal = literals_.back();
+
+  switch (kinds[begin]) {
+    case SQL_INTVAL:
+      literal.ival = tokens.values()[begin].ival;
+      if (end - begin == 2) {
+        literal.type = kExprLiteralInterval;
+        literal.datetimeField = durationField(kinds[begin + 1], true);
+      }
+      return true;
+    case SQL_FLOATVAL:
+      literal.type = kExprLiteralFloat;
+      literal.fval = tokens.values()[begin].fval;
+      return true;
+    case SQL_STRING:
+      literal.type = kExprLiteralString;
+      unescapeString(sql, offset, tokens.lengths()[begin], &literal.sval);
+      return true;
+    case '?':
+      literal.type = kExprParameter;
+      return true;
+    default:
+      break;
+  }
+
+  // DATE or INTERVAL followed by a string. Mirrors the checks of date_literal and interval_literal in bison_parser.y.
+  std::string value;
+  unescapeString(sql, tokens.offsets()[begin + 1], tokens.lengths()[begin + 1], &value);
+  if (kinds[begin] == SQL_DATE) {
+    int day{0}, month{0}, year{0}, chars_parsed{0};
+    if (sscanf(value.c_str(), "%4d-%2d-%2d%n", &day, &month, &year, &chars_parsed) != 3 ||
+        value[chars_parsed] != 0) {
+      return false;
+    }
+    literal.type = kExprLiteralDate;
+    literal.sval = std::move(value);
+    return true;
+  }
+
+  int duration{0}, chars_parsed{0};
+  literal.type = kExprLiteralInterval;
+  if (end - begin == 3) {
+    if (sscanf(value.c_str(), "%d%n", &duration, &chars_parsed) != 1 || value[chars_parsed] != 0) return false;
+    literal.datetimeField = durationField(kinds[begin + 2], false);
+  } else {
+    char unit_string[8];
+    if (sscanf(value.c_str(), "%d %7s%n", &duration, unit_string, &chars_parsed) != 2 || value[chars_parsed] != 0) {
+      return false;
+    }
+    literal.datetimeField = durationField(unit_string);
+    if (literal.datetimeField == kDatetimeNone) return false;
+  }
+  literal.ival = duration;
+  return true;
+}
+
+void QueryFingerprint::appendToken(const std::string& sql, const TokenStream& tokens, size_t i) {
+  const int16_t kind = tokens.kinds()[i];
+  const char* text = sql.data() + tokens.offsets()[i];
+  const size_t length = tokens.lengths()[i];
+  if (kind == SQL_CHARACTER_VARYING) {
+    // The keywords may be separated by any whitespace.
+    append("CHARACTER VARYING", 17, kind, false);
+  } else if (kind == SQL_NOTEQUALS) {
+    // Also matches <>.
+    append("!=", 2, kind, false);
+  } else {
+    // Keywords are upper case, identifiers keep their case.
+    append(text, length, kind, kind != SQL_IDENTIFIER);
+  }
+}
+
+void QueryFingerprint::append(const char* text, size_t length, int16_t kind, bool upperCase) {
+  const bool afterOpening = lastKind_ == '(' || lastKind_ == '[' || lastKind_ == '.';
+  const bool attached = kind == ')' || kind == '[' || kind == ']' || kind == ',' || kind == '.' || kind == ';';
+  const bool functionCall = kind == '(' && lastKind_ == SQL_IDENTIFIER;
+  char* out = &text_[textSize_];
+  if (textSize_ > 0 && !afterOpening && !attached && !functionCall) *out++ = ' ';
+  if (upperCase) {
+    for (size_t c = 0; c < length; ++c) out[c] = text[c] >= 'a' && text[c] <= 'z' ? text[c] - ('a' - 'A') : text[c];
+  } else {
+    memcpy(out, text, length);
+  }
+  textSize_ = out + length - text_.data();
+  lastKind_ = kind;
+}
+
+}  // namespace hsql
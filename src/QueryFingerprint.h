@@ -0,0 +1,100 @@
+#ifndef SQLPARSER_QUERY_FINGERPRINT_H
+#define SQLPARSER_QUERY_FINGERPRINT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "TokenStream.h"
+#include "sql/Expr.h"
+
+namespace hsql {
+
+// Literal that was replaced by a placeholder in a fingerprint.
+struct FingerprintLiteral {
+  // kExprLiteralInt, kExprLiteralFloat, kExprLiteralString, kExprLiteralDate,
+  // kExprLiteralInterval or kExprParameter for the parameters of prepared statements.
+  ExprType type;
+
+  // Value of integers, duration of intervals.
+  int64_t ival;
+
+  // Value of floats.
+  double fval;
+
+  // Unescaped value of strings and dates.
+  std::string sval;
+
+  // Unit of intervals.
+  DatetimeField datetimeField;
+
+  // Byte range of the literal in the query.
+  uint32_t offset;
+  uint32_t length;
+};
+
+// Normalized form of a query that identifies it independently of its literal values,
+// e.g. as the key of a plan cache. It is computed from the tokens of the query
+// without parsing it:
+//  - integer, float, string, date and interval literals are replaced by '?', like the
+//    parameters of prepared statements,
+//  - IN lists that only contain literals are collapsed to 'IN (...)',
+//  - keywords are upper case and tokens are separated by canonical whitespace.
+// Identifiers keep their case, as do type modifiers like VARCHAR(10) and array indexes.
+// Integers that are column positions in ORDER BY and GROUP BY lists are kept as well.
+// The literals are collected in the order of the query.
+class QueryFingerprint {
+ public:
+  QueryFingerprint();
+
+  // Returns false if the query could not be tokenized or contains a malformed date or
+  // interval literal. The text and hash are meaningless then.
+  bool isValid() const;
+
+  // Normalized query text.
+  const std::string& text() const;
+
+  // 64-bit hash of the text.
+  uint64_t hash() const;
+
+  // Literals and parameters in the order of their placeholders.
+  const std::vector<FingerprintLiteral>& literals() const;
+
+  // Computes the fingerprint of sql from its tokens.
+  // Called by ParserContext::fingerprint().
+  void compute(const std::string& sql, const TokenStream& tokens);
+
+  // Removes the text and the literals, but keeps the allocated memory.
+  void reset();
+
+ private:
+  // Appends the normalized tokens to the text and collects the literals.
+  // Returns false if a literal is malformed.
+  bool normalize(const std::string& sql, const TokenStream& tokens);
+
+  // Returns the index after the literal that starts at token i, or i if there is none.
+  size_t literalEnd(const TokenStream& tokens, size_t i) const;
+
+  // Adds the literal of the tokens [begin, end). Returns false if it is malformed.
+  bool addLiteral(const std::string& sql, const TokenStream& tokens, size_t begin, size_t end);
+
+  // Appends the normalized text of token i.
+  void appendToken(const std::string& sql, const TokenStream& tokens, size_t i);
+
+  // Appends text, separated from the previous token according to their kinds.
+  // The text has to be sized to hold it, see compute().
+  void append(const char* text, size_t length, int16_t kind, bool upperCase);
+
+  std::string text_;
+  uint64_t hash_;
+
+  // Length of the text while it is computed.
+  size_t textSize_;
+  std::vector<FingerprintLiteral> literals_;
+  int16_t lastKind_;
+  bool isValid_;
+};
+
+}  // namespace hsql
+
+#endif
@@ -0,0 +1,923 @@
+#include "ResultSerializer.h"
+#include <math.h>
+#include <string.h>
+#include <type_traits>
+#include <vector>
+#include "sql/statements.h"
+
+namespace hsql {
+
+namespace {
+
+constexpr uint32_t kByteOrderMark = 0x01020304;
+
+// Length of absent strings and lists.
+constexpr uint32_t kNull = UINT32_MAX;
+
+// Type byte of absent operands.
+constexpr uint8_t kNullExpr = UINT8_MAX;
+
+// Fields of an Expr that are only written if they are set.
+enum ExprFlag : uint16_t {
+  kHasExpr = 1 << 0,
+  kHasExpr2 = 1 << 1,
+  kHasExprList = 1 << 2,
+  kHasSelect = 1 << 3,
+  kHasFval = 1 << 4,
+  kHasIval = 1 << 5,
+  kHasIval2 = 1 << 6,
+  kHasColumnType = 1 << 7,
+  kIsDistinct = 1 << 8,
+  kIsBoolLiteral = 1 << 9
+};
+
+// Appends the parts of a result in the same order in which Reader reads them. Lists are written
+// as their length, followed by the elements.
+class Writer {
+ public:
+  explicit Writer(std::string* out) : out_(out) {}
+
+  template <typename T>
+  void write(T value) {
+    static_assert(std::is_trivially_copyable<T>::value, "only plain values can be written");
+    out_->append(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  template <typename T>
+  void writeVector(const std::vector<T>& values) {
+    write<uint64_t>(values.size());
+    out_->append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+  }
+
+  // Strings are stored with their terminator, so that the reader can point into the data.
+  void writeString(const char* string) {
+    if (string == nullptr) {
+      write<uint32_t>(kNull);
+      return;
+    }
+    const size_t length = strlen(string);
+    write<uint32_t>(length);
+    out_->append(string, length + 1);
+  }
+
+  void writeStrings(const std::vector<char*>* strings) {
+    write<uint32_t>(strings != nullptr ? strings->size() : kNull);
+    if (strings == nullptr) return;
+    for (const char* string : *strings) writeString(string);
+  }
+
+  void writeColumnType(const ColumnType& columnType) {
+    write<uint8_t>(static_cast<uint8_t>(columnType.data_type));
+    write<int64_t>(columnType.length);
+    write<int64_t>(columnType.precision);
+    write<int64_t>(columnType.scale);
+  }
+
+  void writeExpr(const Expr* expr);
+
+  void writeExprs(const std::vector<Expr*>* exprs) {
+    write<uint32_t>(exprs != nullptr ? exprs->size() : kNull);
+    if (exprs == nullptr) return;
+    for (const Expr* expr : *exprs) writeExpr(expr);
+  }
+
+  void writeOrder(const std::vector<OrderDescription*>* order) {
+    write<uint32_t>(order != nullptr ? order->size() : kNull);
+    if (order == nullptr) return;
+    for (const OrderDescription* description : *order) {
+      write<uint8_t>(description->type);
+      writeExpr(description->expr);
+    }
+  }
+
+  void writeLimit(const LimitDescription* limit) {
+    write<uint8_t>(limit != nullptr);
+    if (limit == nullptr) return;
+    writeExpr(limit->limit);
+    writeExpr(limit->offset);
+  }
+
+  void writeTable(const TableRef* table);
+
+  void writeStatement(const SQLStatement* statement);
+
+  // Absent statements are written as kStmtError.
+  void writeSelect(const SelectStatement* select) {
+    if (select != nullptr) {
+      writeStatement(select);
+    } else {
+      write<uint8_t>(kStmtError);
+    }
+  }
+
+  void writeValues(const ValuesList* rows);
+
+ private:
+  void writeSelectBody(const SelectStatement* select);
+  void writeCreateBody(const CreateStatement* create);
+
+  std::string* out_;
+};
+
+void Writer::writeExpr(const Expr* root) {
+  // Operands are written in pre-order from an explicit stack, so that deep trees do not recurse.
+  std::vector<const Expr*> stack = {root};
+  while (!stack.empty()) {
+    const Expr* expr = stack.back();
+    stack.pop_back();
+    if (expr == nullptr) {
+      write<uint8_t>(kNullExpr);
+      continue;
+    }
+
+    uint16_t flags = 0;
+    if (expr->expr != nullptr) flags |= kHasExpr;
+    if (expr->expr2 != nullptr) flags |= kHasExpr2;
+    if (expr->exprList != nullptr) flags |= kHasExprList;
+    if (expr->select != nullptr) flags |= kHasSelect;
+    // Negative zero compares equal to zero.
+    if (expr->fval != 0 || signbit(expr->fval)) flags |= kHasFval;
+    if (expr->ival != 0) flags |= kHasIval;
+    if (expr->ival2 != 0) flags |= kHasIval2;
+    if (expr->columnType.data_type != DataType::UNKNOWN) flags |= kHasColumnType;
+    if (expr->distinct) flags |= kIsDistinct;
+    if (expr->isBoolLiteral) flags |= kIsBoolLiteral;
+
+    write<uint8_t>(expr->type);
+    write<uint8_t>(expr->opType);
+    write<uint8_t>(expr->datetimeField);
+    write<uint16_t>(flags);
+    writeString(expr->name);
+    writeString(expr->table);
+    writeString(expr->alias);
+    if (flags & kHasFval) write<double>(expr->fval);
+    if (flags & kHasIval) write<int64_t>(expr->ival);
+    if (flags & kHasIval2) write<int64_t>(expr->ival2);
+    if (flags & kHasColumnType) writeColumnType(expr->columnType);
+    if (flags & kHasSelect) writeSelect(expr->select);
+    if (flags & kHasExprList) write<uint32_t>(expr->exprList->size());
+
+    // The operands follow in the order expr, expr2, exprList.
+    if (flags & kHasExprList) stack.insert(stack.end(), expr->exprList->rbegin(), expr->exprList->rend());
+    if (flags & kHasExpr2) stack.push_back(expr->expr2);
+    if (flags & kHasExpr) stack.push_back(expr->expr);
+  }
+}
+
+void Writer::writeTable(const TableRef* table) {
+  write<uint8_t>(table != nullptr);
+  if (table == nullptr) return;
+  write<uint8_t>(table->type);
+  writeString(table->schema);
+  writeString(table->name);
+  write<uint8_t>(table->alias != nullptr);
+  if (table->alias != nullptr) {
+    writeString(table->alias->name);
+    writeStrings(table->alias->columns);
+  }
+  writeSelect(table->select);
+  write<uint32_t>(table->list != nullptr ? table->list->size() : kNull);
+  if (table->list != nullptr) {
+    for (const TableRef* entry : *table->list) writeTable(entry);
+  }
+  write<uint8_t>(table->join != nullptr);
+  if (table->join != nullptr) {
+    write<uint8_t>(table->join->type);
+    writeTable(table->join->left);
+    writeTable(table->join->right);
+    writeExpr(table->join->condition);
+  }
+}
+
+void Writer::writeValues(const ValuesList* rows) {
+  write<uint8_t>(rows != nullptr);
+  if (rows == nullptr) return;
+  write<uint64_t>(rows->numRows);
+  write<uint32_t>(rows->columns.size());
+  for (const ValuesColumn& column : rows->columns) {
+    write<uint8_t>(column.type);
+    write<uint8_t>(column.isBool);
+    write<uint8_t>(column.hasMixedTypes);
+    write<uint64_t>(column.size);
+    writeVector(column.ints);
+    writeVector(column.floats);
+    writeVector(column.offsets);
+    writeVector(column.chars);
+    writeVector(column.nulls);
+    write<uint32_t>(column.exprs.size());
+    for (const Expr* expr : column.exprs) writeExpr(expr);
+  }
+}
+
+void Writer::writeSelectBody(const SelectStatement* select) {
+  writeTable(select->fromTable);
+  write<uint8_t>(select->selectDistinct);
+  writeExprs(select->selectList);
+  writeExpr(select->whereClause);
+  write<uint8_t>(select->groupBy != nullptr);
+  if (select->groupBy != nullptr) {
+    writeExprs(select->groupBy->columns);
+    writeExpr(select->groupBy->having);
+  }
+  write<uint32_t>(select->setOperations != nullptr ? select->setOperations->size() : kNull);
+  if (select->setOperations != nullptr) {
+    for (const SetOperation* setOperation : *select->setOperations) {
+      write<uint8_t>(setOperation->setType);
+      write<uint8_t>(setOperation->isAll);
+      writeSelect(setOperation->nestedSelectStatement);
+      writeOrder(setOperation->resultOrder);
+      writeLimit(setOperation->resultLimit);
+    }
+  }
+  writeOrder(select->order);
+  write<uint32_t>(select->withDescriptions != nullptr ? select->withDescriptions->size() : kNull);
+  if (select->withDescriptions != nullptr) {
+    for (const WithDescription* with : *select->withDescriptions) {
+      writeString(with->alias);
+      writeSelect(with->select);
+    }
+  }
+  writeLimit(select->limit);
+}
+
+void Writer::writeCreateBody(const CreateStatement* create) {
+  write<uint8_t>(create->type);
+  write<uint8_t>(create->ifNotExists);
+  writeString(create->filePath);
+  writeString(create->schema);
+  writeString(create->tableName);
+  writeString(create->indexName);
+  writeStrings(create->indexColumns);
+  write<uint32_t>(create->columns != nullptr ? create->columns->size() : kNull);
+  if (create->columns != nullptr) {
+    for (const ColumnDefinition* column : *create->columns) {
+      writeString(column->name);
+      writeColumnType(column->type);
+      write<uint8_t>(column->nullable);
+      write<uint32_t>(column->column_constraints != nullptr ? column->column_constraints->size() : kNull);
+      if (column->column_constraints != nullptr) {
+        for (ConstraintType constraint : *column->column_constraints) write<uint8_t>(static_cast<uint8_t>(constraint));
+      }
+    }
+  }
+  write<uint32_t>(create->tableConstraints != nullptr ? create->tableConstraints->size() : kNull);
+  if (create->tableConstraints != nullptr) {
+    for (const TableConstraint* constraint : *create->tableConstraints) {
+      write<uint8_t>(static_cast<uint8_t>(constraint->type));
+      writeStrings(constraint->columnNames);
+    }
+  }
+  writeStrings(create->viewColumns);
+  writeSelect(create->select);
+}
+
+void Writer::writeStatement(const SQLStatement* statement) {
+  write<uint8_t>(statement->type());
+  write<uint64_t>(statement->stringLength);
+  writeExprs(statement->hints);
+
+  switch (statement->type()) {
+    case kStmtSelect:
+      writeSelectBody(static_cast<const SelectStatement*>(statement));
+      break;
+    case kStmtImport: {
+      const ImportStatement* import = static_cast<const ImportStatement*>(statement);
+      write<uint8_t>(import->type);
+      writeString(import->filePath);
+      writeString(import->schema);
+      writeString(import->tableName);
+      break;
+    }
+    case kStmtExport: {
+      const ExportStatement* exportStatement = static_cast<const ExportStatement*>(statement);
+      write<uint8_t>(exportStatement->type);
+      writeString(exportStatement->filePath);
+      writeString(exportStatement->schema);
+      writeString(exportStatement->tableName);
+      break;
+    }
+    case kStmtInsert: {
+      const InsertStatement* insert = static_cast<const InsertStatement*>(statement);
+      write<uint8_t>(insert->type);
+      writeString(insert->schema);
+      writeString(insert->tableName);
+      writeStrings(insert->columns);
+      writeExprs(insert->values);
+      writeValues(insert->rows);
+      writeSelect(insert->select);
+      break;
+    }
+    case kStmtUpdate: {
+      const UpdateStatement* update = static_cast<const UpdateStatement*>(statement);
+      writeTable(update->table);
+      write<uint32_t>(update->updates != nullptr ? update->updates->size() : kNull);
+      if (update->updates != nullptr) {
+        for (const UpdateClause* clause : *update->updates) {
+          writeString(clause->column);
+          writeExpr(clause->value);
+        }
+      }
+      writeExpr(update->where);
+      break;
+    }
+    case kStmtDelete: {
+      const DeleteStatement* del = static_cast<const DeleteStatement*>(statement);
+      writeString(del->schema);
+      writeString(del->tableName);
+      writeExpr(del->expr);
+      break;
+    }
+    case kStmtCreate:
+      writeCreateBody(static_cast<const CreateStatement*>(statement));
+      break;
+    case kStmtDrop: {
+      const DropStatement* drop = static_cast<const DropStatement*>(statement);
+      write<uint8_t>(drop->type);
+      write<uint8_t>(drop->ifExists);
+      writeString(drop->schema);
+      writeString(drop->name);
+      writeString(drop->indexName);
+      break;
+    }
+    case kStmtPrepare: {
+      const PrepareStatement* prepare = static_cast<const PrepareStatement*>(statement);
+      writeString(prepare->name);
+      writeString(prepare->query);
+      break;
+    }
+    case kStmtExecute: {
+      const ExecuteStatement* execute = static_cast<const ExecuteStatement*>(statement);
+      writeString(execute->name);
+      writeExprs(execute->parameters);
+      break;
+    }
+    case kStmtAlter: {
+      const AlterStatement* alter = static_cast<const AlterStatement*>(statement);
+      writeString(alter->schema);
+      write<uint8_t>(alter->ifTableExists);
+      writeString(alter->name);
+      write<uint8_t>(alter->action != nullptr);
+      if (alter->action != nullptr) {
+        write<uint8_t>(alter->action->type);
+        if (alter->action->type == DropColumn) {
+          const DropColumnAction* dropColumn = static_cast<const DropColumnAction*>(alter->action);
+          writeString(dropColumn->columnName);
+          write<uint8_t>(dropColumn->ifExists);
+        }
+      }
+      break;
+    }
+    case kStmtShow: {
+      const ShowStatement* show = static_cast<const ShowStatement*>(statement);
+      write<uint8_t>(show->type);
+      writeString(show->schema);
+      writeString(show->name);
+      break;
+    }
+    case kStmtTransaction:
+      write<uint8_t>(static_cast<const TransactionStatement*>(statement)->command);
+      break;
+    case kStmtError:
+    case kStmtRename:
+      break;
+  }
+}
+
+// Returns true if the array of the column's type has one element per row, so that the accessors
+// of the column stay within it, and the arrays of the other types are empty.
+bool isConsistent(const ValuesColumn& column, uint64_t numRows) {
+  if (column.size != numRows || column.nulls.size() < (column.size + 63) / 64) return false;
+
+  size_t numInts = 0, numFloats = 0, numOffsets = 0, numExprs = 0;
+  switch (column.type) {
+    case kExprLiteralNull:
+      break;
+    case kExprLiteralInt:
+      numInts = column.size;
+      break;
+    case kExprLiteralFloat:
+      numFloats = column.size;
+      break;
+    case kExprLiteralString:
+    case kExprLiteralDate:
+      numOffsets = column.size;
+      break;
+    case kExprLiteralInterval:
+    case kExprParameter:
+      numExprs = column.size;
+      break;
+    default:
+      return false;
+  }
+  // Columns with mixed types keep every value as an expression.
+  if (column.hasMixedTypes) {
+    if (column.type == kExprLiteralNull || column.isBool) return false;
+    numInts = numFloats = numOffsets = 0;
+    numExprs = column.size;
+  }
+  if (column.ints.size() != numInts || column.floats.size() != numFloats || column.offsets.size() != numOffsets ||
+      column.exprs.size() != numExprs) {
+    return false;
+  }
+
+  // Each string starts within the characters, which end with a terminator.
+  if (numOffsets == 0) return column.chars.empty();
+  if (column.chars.empty() || column.chars.back() != '\0') return false;
+  for (size_t offset : column.offsets) {
+    if (offset >= column.chars.size()) return false;
+  }
+  return true;
+}
+
+// Rebuilds the nodes in the active arena. Every read checks the remaining size; after the first
+// failure all reads return zero and the partially built nodes are released with the arena.
+class Reader {
+ public:
+  Reader(const char* data, size_t size) : cursor_(data), end_(data + size), ok_(true) {}
+
+  bool ok() const { return ok_; }
+  bool atEnd() const { return cursor_ == end_; }
+  const std::vector<Expr*>& parameters() const { return parameters_; }
+
+  bool fail() {
+    ok_ = false;
+    cursor_ = end_;
+    return false;
+  }
+
+  template <typename T>
+  T read() {
+    T value = T();
+    if (static_cast<size_t>(end_ - cursor_) < sizeof(T)) {
+      fail();
+      return value;
+    }
+    memcpy(&value, cursor_, sizeof(T));
+    cursor_ += sizeof(T);
+    return value;
+  }
+
+  bool readBool() { return read<uint8_t>() != 0; }
+
+  template <typename T>
+  void readVector(std::vector<T>* values) {
+    const uint64_t size = read<uint64_t>();
+    if (size > static_cast<size_t>(end_ - cursor_) / sizeof(T)) {
+      fail();
+      return;
+    }
+    values->resize(size);
+    if (size > 0) memcpy(values->data(), cursor_, size * sizeof(T));
+    cursor_ += size * sizeof(T);
+  }
+
+  // Returns the number of elements of a list, or kNull. Each element takes at least one byte,
+  // which bounds the allocations for corrupt lengths.
+  uint32_t readLength() {
+    const uint32_t length = read<uint32_t>();
+    if (length != kNull && length > static_cast<size_t>(end_ - cursor_)) fail();
+    return ok_ ? length : kNull;
+  }
+
+  // Returns a pointer into the data.
+  char* readString() {
+    const uint32_t length = read<uint32_t>();
+    if (length == kNull) return nullptr;
+    if (length >= static_cast<size_t>(end_ - cursor_) || cursor_[length] != '\0') {
+      fail();
+      return nullptr;
+    }
+    char* string = const_cast<char*>(cursor_);
+    cursor_ += length + 1;
+    return string;
+  }
+
+  std::vector<char*>* readStrings() {
+    const uint32_t length = readLength();
+    if (length == kNull) return nullptr;
+    std::vector<char*>* strings = arenaNew<std::vector<char*>>();
+    for (uint32_t i = 0; i < length && ok_; ++i) strings->push_back(readString());
+    return strings;
+  }
+
+  ColumnType readColumnType() {
+    ColumnType columnType;
+    columnType.data_type = static_cast<DataType>(read<uint8_t>());
+    columnType.length = read<int64_t>();
+    columnType.precision = read<int64_t>();
+    columnType.scale = read<int64_t>();
+    return columnType;
+  }
+
+  Expr* readExpr();
+
+  std::vector<Expr*>* readExprs() {
+    const uint32_t length = readLength();
+    if (length == kNull) return nullptr;
+    std::vector<Expr*>* exprs = arenaNew<std::vector<Expr*>>();
+    for (uint32_t i = 0; i < length && ok_; ++i) exprs->push_back(readExpr());
+    return exprs;
+  }
+
+  std::vector<OrderDescription*>* readOrder() {
+    const uint32_t length = readLength();
+    if (length == kNull) return nullptr;
+    std::vector<OrderDescription*>* order = arenaNew<std::vector<OrderDescription*>>();
+    for (uint32_t i = 0; i < length && ok_; ++i) {
+      const OrderType type = static_cast<OrderType>(read<uint8_t>());
+      order->push_back(new OrderDescription(type, readExpr()));
+    }
+    return order;
+  }
+
+  LimitDescription* readLimit() {
+    if (!readBool()) return nullptr;
+    Expr* limit = readExpr();
+    return new LimitDescription(limit, readExpr());
+  }
+
+  TableRef* readTable();
+
+  SQLStatement* readStatement();
+
+  SelectStatement* readSelect() {
+    SQLStatement* statement = readStatement();
+    if (statement != nullptr && !statement->isType(kStmtSelect)) fail();
+    return ok_ ? static_cast<SelectStatement*>(statement) : nullptr;
+  }
+
+  ValuesList* readValues();
+
+ private:
+  void readSelectBody(SelectStatement* select);
+  void readCreateBody(CreateStatement* create);
+
+  const char* cursor_;
+  const char* end_;
+  bool ok_;
+  std::vector<Expr*> parameters_;
+};
+
+Expr* Reader::readExpr() {
+  Expr* root = nullptr;
+  std::vector<Expr**> targets = {&root};
+  while (!targets.empty() && ok_) {
+    Expr** target = targets.back();
+    targets.pop_back();
+    const uint8_t type = read<uint8_t>();
+    if (type == kNullExpr) continue;
+    if (type > kExprCast) {
+      fail();
+      break;
+    }
+
+    Expr* expr = new Expr(static_cast<ExprType>(type));
+    *target = expr;
+    expr->opType = static_cast<OperatorType>(read<uint8_t>());
+    expr->datetimeField = static_cast<DatetimeField>(read<uint8_t>());
+    const uint16_t flags = read<uint16_t>();
+    expr->name = readString();
+    expr->table = readString();
+    expr->alias = readString();
+    expr->distinct = flags & kIsDistinct;
+    expr->isBoolLiteral = flags & kIsBoolLiteral;
+    if (flags & kHasFval) expr->fval = read<double>();
+    if (flags & kHasIval) expr->ival = read<int64_t>();
+    if (flags & kHasIval2) expr->ival2 = read<int64_t>();
+    if (flags & kHasColumnType) expr->columnType = readColumnType();
+    if (flags & kHasSelect) expr->select = readSelect();
+    if (expr->isType(kExprParameter)) parameters_.push_back(expr);
+
+    if (flags & kHasExprList) {
+      // The flag is only written for lists.
+      const uint32_t length = readLength();
+      if (length == kNull) {
+        fail();
+        break;
+      }
+      expr->exprList = arenaNew<std::vector<Expr*>>(length, nullptr);
+      for (size_t i = length; i-- > 0;) targets.push_back(&(*expr->exprList)[i]);
+    }
+    if (flags & kHasExpr2) targets.push_back(&expr->expr2);
+    if (flags & kHasExpr) targets.push_back(&expr->expr);
+  }
+  return ok_ ? root : nullptr;
+}
+
+TableRef* Reader::readTable() {
+  if (!readBool()) return nullptr;
+  TableRef* table = new TableRef(static_cast<TableRefType>(read<uint8_t>()));
+  table->schema = readString();
+  table->name = readString();
+  if (readBool()) {
+    char* name = readString();
+    table->alias = new Alias(name, readStrings());
+  }
+  table->select = readSelect();
+  const uint32_t length = readLength();
+  if (length != kNull) {
+    table->list = arenaNew<std::vector<TableRef*>>();
+    for (uint32_t i = 0; i < length && ok_; ++i) table->list->push_back(readTable());
+  }
+  if (readBool()) {
+    table->join = new JoinDefinition();
+    table->join->type = static_cast<JoinType>(read<uint8_t>());
+    table->join->left = readTable();
+    table->join->right = readTable();
+    table->join->condition = readExpr();
+  }
+  return table;
+}
+
+ValuesList* Reader::readValues() {
+  if (!readBool()) return nullptr;
+  ValuesList* rows = arenaNew<ValuesList>();
+  rows->numRows = read<uint64_t>();
+  const uint32_t numColumns = readLength();
+  if (numColumns == kNull) return rows;
+  rows->columns.resize(numColumns);
+  for (ValuesColumn& column : rows->columns) {
+    column.type = static_cast<ExprType>(read<uint8_t>());
+    column.isBool = readBool();
+    column.hasMixedTypes = readBool();
+    column.size = read<uint64_t>();
+    readVector(&column.ints);
+    readVector(&column.floats);
+    readVector(&column.offsets);
+    readVector(&column.chars);
+    readVector(&column.nulls);
+    const uint32_t numExprs = readLength();
+    for (uint32_t i = 0; i < numExprs && ok_; ++i) column.exprs.push_back(readExpr());
+    if (!ok_) break;
+
+    if (!isConsistent(column, rows->numRows)) {
+      fail();
+      break;
+    }
+  }
+  return rows;
+}
+
+void Reader::readSelectBody(SelectStatement* select) {
+  select->fromTable = readTable();
+  select->selectDistinct = readBool();
+  select->selectList = readExprs();
+  select->whereClause = readExpr();
+  if (readBool()) {
+    select->groupBy = new GroupByDescription();
+    select->groupBy->columns = readExprs();
+    select->groupBy->having = readExpr();
+  }
+  uint32_t length = readLength();
+  if (length != kNull) {
+    select->setOperations = arenaNew<std::vector<SetOperation*>>();
+    for (uint32_t i = 0; i < length && ok_; ++i) {
+      SetOperation* setOperation = new SetOperation();
+      setOperation->setType = static_cast<SetType>(read<uint8_t>());
+      setOperation->isAll = readBool();
+      setOperation->nestedSelectStatement = readSelect();
+      setOperation->resultOrder = readOrder();
+      setOperation->resultLimit = readLimit();
+      select->setOperations->push_back(setOperation);
+    }
+  }
+  select->order = readOrder();
+  length = readLength();
+  if (length != kNull) {
+    select->withDescriptions = arenaNew<std::vector<WithDescription*>>();
+    for (uint32_t i = 0; i < length && ok_; ++i) {
+      WithDescription* with = new WithDescription();
+      with->alias = readString();
+      with->select = readSelect();
+      select->withDescriptions->push_back(with);
+    }
+  }
+  select->limit = readLimit();
+}
+
+void Reader::readCreateBody(CreateStatement* create) {
+  create->ifNotExists = readBool();
+  create->filePath = readString();
+  create->schema = readString();
+  create->tableName = readString();
+  create->indexName = readString();
+  create->indexColumns = readStrings();
+  uint32_t length = readLength();
+  if (length != kNull) {
+    create->columns = arenaNew<std::vector<ColumnDefinition*>>();
+    for (uint32_t i = 0; i < length && ok_; ++i) {
+      char* name = readString();
+      const ColumnType type = readColumnType();
+      const bool nullable = readBool();
+      std::vector<ConstraintType>* constraints = nullptr;
+      const uint32_t numConstraints = readLength();
+      if (numConstraints != kNull) {
+        constraints = arenaNew<std::vector<ConstraintType>>();
+        for (uint32_t c = 0; c < numConstraints && ok_; ++c) {
+          constraints->push_back(static_cast<ConstraintType>(read<uint8_t>()));
+        }
+      }
+      ColumnDefinition* column = new ColumnDefinition(name, type, constraints);
+      column->nullable = nullable;
+      create->columns->push_back(column);
+    }
+  }
+  length = readLength();
+  if (length != kNull) {
+    create->tableConstraints = arenaNew<std::vector<TableConstraint*>>();
+    for (uint32_t i = 0; i < length && ok_; ++i) {
+      const ConstraintType type = static_cast<ConstraintType>(read<uint8_t>());
+      create->tableConstraints->push_back(new TableConstraint(type, readStrings()));
+    }
+  }
+  create->viewColumns = readStrings();
+  create->select = readSelect();
+}
+
+SQLStatement* Reader::readStatement() {
+  const uint8_t type = read<uint8_t>();
+  if (!ok_ || type == kStmtError) return nullptr;
+  if (type > kStmtTransaction) {
+    fail();
+    return nullptr;
+  }
+  const size_t stringLength = read<uint64_t>();
+  std::vector<Expr*>* hints = readExprs();
+
+  SQLStatement* statement = nullptr;
+  switch (static_cast<StatementType>(type)) {
+    case kStmtSelect: {
+      SelectStatement* select = new SelectStatement();
+      readSelectBody(select);
+      statement = select;
+      break;
+    }
+    case kStmtImport: {
+      ImportStatement* import = new ImportStatement(static_cast<ImportType>(read<uint8_t>()));
+      import->filePath = readString();
+      import->schema = readString();
+      import->tableName = readString();
+      statement = import;
+      break;
+    }
+    case kStmtExport: {
+      ExportStatement* exportStatement = new ExportStatement(static_cast<ImportType>(read<uint8_t>()));
+      exportStatement->filePath = readString();
+      exportStatement->schema = readString();
+      exportStatement->tableName = readString();
+      statement = exportStatement;
+      break;
+    }
+    case kStmtInsert: {
+      InsertStatement* insert = new InsertStatement(static_cast<InsertType>(read<uint8_t>()));
+      insert->schema = readString();
+      insert->tableName = readString();
+      insert->columns = readStrings();
+      insert->values = readExprs();
+      insert->rows = readValues();
+      insert->select = readSelect();
+      statement = insert;
+      break;
+    }
+    case kStmtUpdate: {
+      UpdateStatement* update = new UpdateStatement();
+      update->table = readTable();
+      const uint32_t length = readLength();
+      if (length != kNull) {
+        update->updates = arenaNew<std::vector<UpdateClause*>>();
+        for (uint32_t i = 0; i < length && ok_; ++i) {
+          UpdateClause* clause = new UpdateClause();
+          clause->column = readString();
+          clause->value = readExpr();
+          update->updates->push_back(clause);
+        }
+      }
+      update->where = readExpr();
+      statement = update;
+      break;
+    }
+    case kStmtDelete: {
+      DeleteStatement* del = new DeleteStatement();
+      del->schema = readString();
+      del->tableName = readString();
+      del->expr = readExpr();
+      statement = del;
+      break;
+    }
+    case kStmtCreate: {
+      CreateStatement* create = new CreateStatement(static_cast<CreateType>(read<uint8_t>()));
+      readCreateBody(create);
+      statement = create;
+      break;
+    }
+    case kStmtDrop: {
+      DropStatement* drop = new DropStatement(static_cast<DropType>(read<uint8_t>()));
+      drop->ifExists = readBool();
+      drop->schema = readString();
+      drop->name = readString();
+      drop->indexName = readString();
+      statement = drop;
+      break;
+    }
+    case kStmtPrepare: {
+      PrepareStatement* prepare = new PrepareStatement();
+      prepare->name = readString();
+      prepare->query = readString();
+      statement = prepare;
+      break;
+    }
+    case kStmtExecute: {
+      ExecuteStatement* execute = new ExecuteStatement();
+      execute->name = readString();
+      execute->parameters = readExprs();
+      statement = execute;
+      break;
+    }
+    case kStmtAlter: {
+      char* schema = readString();
+      const bool ifTableExists = readBool();
+      char* name = readString();
+      AlterAction* action = nullptr;
+      if (readBool()) {
+        const ActionType actionType = static_cast<ActionType>(read<uint8_t>());
+        if (actionType != DropColumn) {
+          fail();
+          return nullptr;
+        }
+        DropColumnAction* dropColumn = new DropColumnAction(readString());
+        dropColumn->ifExists = readBool();
+        action = dropColumn;
+      }
+      AlterStatement* alter = new AlterStatement(name, action);
+      alter->schema = schema;
+      alter->ifTableExists = ifTableExists;
+      statement = alter;
+      break;
+    }
+    case kStmtShow: {
+      ShowStatement* show = new ShowStatement(static_cast<ShowType>(read<uint8_t>()));
+      show->schema = readString();
+      show->name = readString();
+      statement = show;
+      break;
+    }
+    case kStmtTransaction:
+      statement = new TransactionStatement(static_cast<TransactionCommand>(read<uint8_t>()));
+      break;
+    case kStmtError:
+    case kStmtRename:
+      statement = new SQLStatement(static_cast<StatementType>(type));
+      break;
+  }
+  statement->stringLength = stringLength;
+  statement->hints = hints;
+  return statement;
+}
+
+}  // namespace
+
+void ResultSerializer::serialize(const SQLParserResult& result, std::string* out) {
+  Writer writer(out);
+  writer.write<uint32_t>(kMagic);
+  writer.write<uint32_t>(kFormatVersion);
+  writer.write<uint32_t>(kByteOrderMark);
+
+  writer.write<uint8_t>(result.isValid());
+  writer.writeString(result.errorMsg());
+  writer.write<int32_t>(result.errorLine());
+  writer.write<int32_t>(result.errorColumn());
+  writer.write<uint32_t>(result.size());
+  for (const SQLStatement* statement : result.getStatements()) writer.writeStatement(statement);
+}
+
+bool ResultSerializer::deserialize(const char* data, size_t size, SQLParserResult* result) {
+  result->setUseArena(true);
+  Reader reader(data, size);
+  if (reader.read<uint32_t>() != kMagic || reader.read<uint32_t>() != kFormatVersion ||
+      reader.read<uint32_t>() != kByteOrderMark) {
+    return false;
+  }
+
+  ArenaScope arenaScope(result->arena());
+  const bool isValid = reader.readBool();
+  const char* errorMsg = reader.readString();
+  const int errorLine = reader.read<int32_t>();
+  const int errorColumn = reader.read<int32_t>();
+  const uint32_t numStatements = reader.readLength();
+  for (uint32_t i = 0; i < numStatements && reader.ok(); ++i) {
+    SQLStatement* statement = reader.readStatement();
+    if (statement == nullptr) reader.fail();
+    if (reader.ok()) result->addStatement(statement);
+  }
+
+  if (!reader.ok() || !reader.atEnd()) {
+    result->reset();
+    return false;
+  }
+  result->setIsValid(isValid);
+  if (errorMsg != nullptr) result->setErrorDetails(strdup(errorMsg), errorLine, errorColumn);
+  for (Expr* parameter : reader.parameters()) result->addParameter(parameter);
+  return true;
+}
+
+}  // namespace hsql
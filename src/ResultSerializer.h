@@ -0,0 +1,37 @@
+#ifndef SQLPARSER_RESULT_SERIALIZER_H
+#define SQLPARSER_RESULT_SERIALIZER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include "SQLParserResult.h"
+
+namespace hsql {
+
+// Binary format of parse results, e.g. for a parse cache that is shared by several processes
+// through a file or shared memory, so that a new process does not reparse the hot queries.
+//
+// The data starts with a header (magic number, format version and a byte order mark) followed
+// by the statements of the result, their strings included. Data of another version or byte
+// order is rejected, and the caller should reparse the query.
+class ResultSerializer {
+ public:
+  static constexpr uint32_t kMagic = 0x4c515348;  // "HSQL"
+  static constexpr uint32_t kFormatVersion = 2;
+
+  // Appends the serialized result to out. Works for valid and invalid results.
+  static void serialize(const SQLParserResult& result, std::string* out);
+
+  // Reads a result from data, which must hold exactly one serialized result. The result is put
+  // into arena mode and reset first. Strings of the AST point into data instead of being copied,
+  // so data must stay valid and unmodified until the result is reset, e.g. a read-only mapping
+  // of a cache file. data needs no particular alignment.
+  //
+  // Returns false if the data is truncated or malformed or has another version; the result is
+  // then empty and invalid. The data is checked for consistency, not for malicious input.
+  static bool deserialize(const char* data, size_t size, SQLParserResult* result);
+};
+
+}  // namespace hsql
+
+#endif
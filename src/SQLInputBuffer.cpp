@@ -0,0 +1,76 @@
+#include "SQLInputBuffer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+#include <utility>
+
+namespace hsql {
+
+SQLInputBuffer::SQLInputBuffer() : data_(nullptr), size_(0), capacity_(0) { resize(0); }
+
+SQLInputBuffer::SQLInputBuffer(size_t length) : data_(nullptr), size_(0), capacity_(0) { resize(length); }
+
+SQLInputBuffer::SQLInputBuffer(const std::string& sql) : data_(nullptr), size_(0), capacity_(0) {
+  resize(sql.size());
+  memcpy(data_, sql.data(), sql.size());
+}
+
+SQLInputBuffer::SQLInputBuffer(SQLInputBuffer&& moved) : data_(nullptr), size_(0), capacity_(0) {
+  *this = std::move(moved);
+}
+
+SQLInputBuffer& SQLInputBuffer::operator=(SQLInputBuffer&& moved) {
+  free(data_);
+  data_ = moved.data_;
+  size_ = moved.size_;
+  capacity_ = moved.capacity_;
+
+  moved.data_ = nullptr;
+  moved.size_ = 0;
+  moved.capacity_ = 0;
+  return *this;
+}
+
+SQLInputBuffer::~SQLInputBuffer() { free(data_); }
+
+char* SQLInputBuffer::data() { return data_; }
+
+const char* SQLInputBuffer::data() const { return data_; }
+
+size_t SQLInputBuffer::size() const { return size_; }
+
+void SQLInputBuffer::resize(size_t length) {
+  if (data_ == nullptr || length + kPadding > capacity_) {
+    char* data = static_cast<char*>(realloc(data_, length + kPadding));
+    if (data == nullptr) throw std::bad_alloc();
+    data_ = data;
+    capacity_ = length + kPadding;
+  }
+
+  size_ = length;
+  memset(data_ + size_, '\0', kPadding);
+}
+
+bool SQLInputBuffer::readFile(const std::string& path) {
+  FILE* file = fopen(path.c_str(), "rb");
+  if (file == nullptr) {
+    resize(0);
+    return false;
+  }
+
+  bool success = fseek(file, 0, SEEK_END) == 0;
+  const long length = success ? ftell(file) : -1;
+  success = length >= 0 && fseek(file, 0, SEEK_SET) == 0;
+
+  if (success) {
+    resize(length);
+    success = fread(data_, 1, size_, file) == size_;
+  }
+
+  fclose(file);
+  if (!success) resize(0);
+  return success;
+}
+
+}  // namespace hsql
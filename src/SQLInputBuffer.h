@@ -0,0 +1,59 @@
+#ifndef SQLPARSER_SQL_INPUT_BUFFER_H
+#define SQLPARSER_SQL_INPUT_BUFFER_H
+
+#include <stddef.h>
+#include <string>
+
+namespace hsql {
+
+// Owns a query string followed by the two null bytes the lexer requires to scan
+// a buffer in place. Parsing from an SQLInputBuffer does not copy the query,
+// so large inputs can be read directly into it and parsed without a second copy.
+// The lexer temporarily writes into the buffer while scanning. It restores the
+// content, but the buffer must not be used by concurrent parses.
+class SQLInputBuffer {
+ public:
+  // Number of trailing null bytes behind the query.
+  static constexpr size_t kPadding = 2;
+
+  // Creates an empty buffer.
+  SQLInputBuffer();
+
+  // Creates a buffer for a query of the given length. The content is uninitialized.
+  explicit SQLInputBuffer(size_t length);
+
+  // Creates a buffer holding a copy of sql.
+  explicit SQLInputBuffer(const std::string& sql);
+
+  SQLInputBuffer(SQLInputBuffer&& moved);
+  SQLInputBuffer& operator=(SQLInputBuffer&& moved);
+
+  SQLInputBuffer(const SQLInputBuffer&) = delete;
+  SQLInputBuffer& operator=(const SQLInputBuffer&) = delete;
+
+  ~SQLInputBuffer();
+
+  // Returns the query. The padding starts at data() + size().
+  char* data();
+  const char* data() const;
+
+  // Returns the length of the query, excluding the padding.
+  size_t size() const;
+
+  // Sets the length of the query and writes the padding behind it.
+  // Reallocates if the buffer is too small; the first min(size(), length) characters are kept.
+  void resize(size_t length);
+
+  // Replaces the content with the content of the file at the given path.
+  // Returns false and leaves the buffer empty if the file could not be read.
+  bool readFile(const std::string& path);
+
+ private:
+  char* data_;
+  size_t size_;
+  size_t capacity_;
+};
+
+}  // namespace hsql
+
+#endif
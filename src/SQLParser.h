@@ -1,12 +1,14 @@
 #ifndef SQLPARSER_SQLPARSER_H
 #define SQLPARSER_SQLPARSER_H
 
+#include "ParserContext.h"
 #include "SQLParserResult.h"
 #include "sql/statements.h"
 
 namespace hsql {
 
 // Static methods used to parse SQL strings.
+// Each call sets up a new lexer. Use a ParserContext to reuse it across parses.
 class SQLParser {
  public:
   // Parses a given constant character SQL string into the result object.
@@ -15,9 +17,25 @@ class SQLParser {
   // you need to check result->isValid();
   static bool parse(const std::string& sql, SQLParserResult* result);
 
+  // Parses the query in the given buffer without copying it.
+  static bool parse(SQLInputBuffer& input, SQLParserResult* result);
+
+  // Parses length characters at buffer without copying them. buffer[length] and
+  // buffer[length + 1] have to be null bytes (see SQLInputBuffer::kPadding).
+  // Returns false if the padding is missing.
+  static bool parse(char* buffer, size_t length, SQLParserResult* result);
+
   // Run tokenization on the given string and store the tokens in the output vector.
   static bool tokenize(const std::string& sql, std::vector<int16_t>* tokens);
 
+  // Stores the tokens of the given string with their byte ranges and numeric values
+  // in the stream, see ParserContext::tokenize(const std::string&, TokenStream*).
+  static bool tokenize(const std::string& sql, TokenStream* tokens);
+
+  // Computes the fingerprint of the given string without parsing it,
+  // see ParserContext::fingerprint().
+  static bool fingerprint(const std::string& sql, QueryFingerprint* fingerprint);
+
   // Deprecated.
   // Old method to parse SQL strings. Replaced by parse().
   static bool parseSQLString(const char* sql, SQLParserResult* result);
@@ -4,9 +4,13 @@
 
 namespace hsql {
 
-SQLParserResult::SQLParserResult() : isValid_(false), errorMsg_(nullptr){};
+SQLParserResult::SQLParserResult()
+    : isValid_(false), errorMsg_(nullptr), errorLine_(-1), errorColumn_(-1), arena_(nullptr){};
 
-SQLParserResult::SQLParserResult(SQLStatement* stmt) : isValid_(false), errorMsg_(nullptr) { addStatement(stmt); };
+SQLParserResult::SQLParserResult(SQLStatement* stmt)
+    : isValid_(false), errorMsg_(nullptr), errorLine_(-1), errorColumn_(-1), arena_(nullptr) {
+  addStatement(stmt);
+};
 
 // Move constructor.
 SQLParserResult::SQLParserResult(SQLParserResult&& moved) { *this = std::forward<SQLParserResult>(moved); }
@@ -14,9 +18,15 @@ SQLParserResult::SQLParserResult(SQLParserResult&& moved) { *this = std::forward
 SQLParserResult& SQLParserResult::operator=(SQLParserResult&& moved) {
   isValid_ = moved.isValid_;
   errorMsg_ = moved.errorMsg_;
+  errorLine_ = moved.errorLine_;
+  errorColumn_ = moved.errorColumn_;
   statements_ = std::move(moved.statements_);
+  parameters_ = std::move(moved.parameters_);
+  arena_ = moved.arena_;
+  ownedArena_ = std::move(moved.ownedArena_);
 
   moved.errorMsg_ = nullptr;
+  moved.arena_ = nullptr;
   moved.reset();
   return *this;
 }
@@ -50,6 +60,7 @@ void SQLParserResult::setErrorDetails(char* errorMsg, int errorLine, int errorCo
 const std::vector<SQLStatement*>& SQLParserResult::getStatements() const { return statements_; }
 
 std::vector<SQLStatement*> SQLParserResult::releaseStatements() {
+  if (arena_) return {};
   std::vector<SQLStatement*> copy = statements_;
 
   statements_.clear();
@@ -57,11 +68,26 @@ std::vector<SQLStatement*> SQLParserResult::releaseStatements() {
   return copy;
 }
 
+std::unique_ptr<Arena> SQLParserResult::releaseArena() {
+  if (!ownedArena_) return nullptr;
+  statements_.clear();
+  parameters_.clear();
+  arena_ = nullptr;
+  return std::move(ownedArena_);
+}
+
 void SQLParserResult::reset() {
-  for (SQLStatement* statement : statements_) {
-    delete statement;
+  if (arena_) {
+    statements_.clear();
+    // A shared arena is reset by its owner.
+    if (ownedArena_) arena_->reset();
+  } else {
+    for (SQLStatement* statement : statements_) {
+      delete statement;
+    }
+    statements_.clear();
   }
-  statements_.clear();
+  parameters_.clear();
 
   isValid_ = false;
 
@@ -71,12 +97,40 @@ void SQLParserResult::reset() {
   errorColumn_ = -1;
 }
 
+void SQLParserResult::setUseArena(bool useArena) {
+  reset();
+  if (useArena && !ownedArena_) {
+    ownedArena_ = std::make_unique<Arena>();
+  } else if (!useArena) {
+    ownedArena_.reset();
+  }
+  arena_ = ownedArena_.get();
+}
+
+void SQLParserResult::setArena(Arena* arena) {
+  reset();
+  ownedArena_.reset();
+  arena_ = arena;
+}
+
+bool SQLParserResult::usesArena() const { return arena_ != nullptr; }
+
+Arena* SQLParserResult::arena() const { return arena_; }
+
 // Does NOT take ownership.
 void SQLParserResult::addParameter(Expr* parameter) {
-  parameters_.push_back(parameter);
-  std::sort(parameters_.begin(), parameters_.end(), [](const Expr* a, const Expr* b) { return a->ival < b->ival; });
+  if (parameters_.empty() || parameters_.back()->ival <= parameter->ival) {
+    parameters_.push_back(parameter);
+    return;
+  }
+  auto position = std::upper_bound(parameters_.begin(), parameters_.end(), parameter,
+                                   [](const Expr* a, const Expr* b) { return a->ival < b->ival; });
+  parameters_.insert(position, parameter);
 }
 
-const std::vector<Expr*>& SQLParserResult::parameters() { return parameters_; }
+// Does NOT take ownership.
+void SQLParserResult::setParameters(const std::vector<Expr*>& parameters) { parameters_ = parameters; }
+
+const std::vector<Expr*>& SQLParserResult::parameters() const { return parameters_; }
 
 }  // namespace hsql
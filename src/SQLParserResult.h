@@ -1,7 +1,9 @@
 #ifndef SQLPARSER_SQLPARSER_RESULT_H
 #define SQLPARSER_SQLPARSER_RESULT_H
 
+#include <memory>
 #include "sql/SQLStatement.h"
+#include "util/Arena.h"
 
 namespace hsql {
 // Represents the result of the SQLParser.
@@ -58,16 +60,48 @@ class SQLParserResult {
   const std::vector<SQLStatement*>& getStatements() const;
 
   // Returns a copy of the list of all statements in this result.
-  // Removes them from this result.
+  // Removes them from this result. The caller takes ownership and has to delete them.
+  // In arena mode, the statements belong to the arena and cannot be deleted individually,
+  // so nothing is released and an empty list is returned; see releaseArena().
   std::vector<SQLStatement*> releaseStatements();
 
+  // Removes the statements (see getStatements()) from this result and returns the arena that
+  // owns them. They stay valid until the caller destroys or resets the arena, e.g. after
+  // splicing it into another arena. The result leaves arena mode. Returns nullptr and keeps
+  // the statements if the result does not own an arena (see setArena()).
+  std::unique_ptr<Arena> releaseArena();
+
   // Deletes all statements and other data within the result.
+  // In arena mode this releases the arena at once instead of destructing each node.
   void reset();
 
-  // Does NOT take ownership.
+  // Enables or disables arena mode and resets the result.
+  // In arena mode all AST nodes, lists and strings of subsequent parses are allocated
+  // from an arena owned by this result. Statements of an arena-backed result must not
+  // be deleted individually and stay valid only as long as the result is not reset.
+  void setUseArena(bool useArena);
+
+  // Resets the result and puts it into arena mode with an arena that is owned by the caller,
+  // e.g. one arena for the results of many queries. Resetting the result leaves the memory to
+  // the arena, which the caller must only reset or destroy after the result has been reset.
+  // Passing nullptr leaves arena mode.
+  void setArena(Arena* arena);
+
+  // Returns true if the result is in arena mode.
+  bool usesArena() const;
+
+  // Returns the arena backing this result, or nullptr if it is not in arena mode.
+  Arena* arena() const;
+
+  // Adds a parameter, keeping the parameters ordered by their id (Expr::ival).
+  // Appending in order costs O(1). Does NOT take ownership.
   void addParameter(Expr* parameter);
 
-  const std::vector<Expr*>& parameters();
+  // Replaces all parameters. They have to be ordered by their id. Does NOT take ownership.
+  void setParameters(const std::vector<Expr*>& parameters);
+
+  // Returns the parameters of all statements ordered by their id.
+  const std::vector<Expr*>& parameters() const;
 
  private:
   // List of statements within the result.
@@ -87,6 +121,12 @@ class SQLParserResult {
 
   // Does NOT have ownership.
   std::vector<Expr*> parameters_;
+
+  // Backs all AST allocations in arena mode.
+  Arena* arena_;
+
+  // The arena of setUseArena(). Null if the arena is owned by the caller of setArena().
+  std::unique_ptr<Arena> ownedArena_;
 };
 
 }  // namespace hsql
@@ -0,0 +1,1263 @@
+#include "SQLUnparser.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "parser/sql_keywords.h"
+
+namespace hsql {
+
+namespace {
+
+// How tightly the forms of expressions bind, from loose to tight, following the precedence
+// declarations in bison_parser.y. An operand that binds more loosely than its position
+// requires is put in parentheses.
+enum Precedence : uint8_t {
+  // Clauses, lists and the arguments of functions, CASE, CAST and EXTRACT.
+  kPrecedenceAny,
+  kPrecedenceOr,
+  kPrecedenceAnd,
+  // BETWEEN, IN and EXISTS, which cannot be the operands of other operators.
+  kPrecedencePredicate,
+  kPrecedenceNot,
+  // =, <>, LIKE, NOT LIKE and ILIKE.
+  kPrecedenceEquality,
+  // <, >, <= and >=.
+  kPrecedenceComparison,
+  kPrecedenceIsNull,
+  // +, - and unary minus.
+  kPrecedenceAdditive,
+  kPrecedenceMultiplicative,
+  kPrecedenceCaret,
+  kPrecedenceConcat,
+  // Literals, column references, function calls, array indexes and everything in parentheses.
+  kPrecedencePrimary
+};
+
+bool isOperator(const Expr* expr, OperatorType opType) {
+  return expr != nullptr && expr->type == kExprOperator && expr->opType == opType;
+}
+
+Precedence precedence(const Expr* expr) {
+  switch (expr->type) {
+    case kExprLiteralInt:
+      return expr->ival < 0 && !expr->isBoolLiteral ? kPrecedenceAdditive : kPrecedencePrimary;
+    case kExprLiteralFloat:
+      return expr->fval < 0 ? kPrecedenceAdditive : kPrecedencePrimary;
+    case kExprOperator:
+      break;
+    default:
+      return kPrecedencePrimary;
+  }
+
+  switch (expr->opType) {
+    case kOpOr:
+      return kPrecedenceOr;
+    case kOpAnd:
+      return kPrecedenceAnd;
+    case kOpBetween:
+    case kOpIn:
+    case kOpExists:
+      return kPrecedencePredicate;
+    case kOpNot:
+      // Written as NOT IN, NOT EXISTS and IS NOT NULL.
+      if (isOperator(expr->expr, kOpIn) || isOperator(expr->expr, kOpExists)) return kPrecedencePredicate;
+      if (isOperator(expr->expr, kOpIsNull)) return kPrecedenceIsNull;
+      return kPrecedenceNot;
+    case kOpEquals:
+    case kOpNotEquals:
+    case kOpLike:
+    case kOpNotLike:
+    case kOpILike:
+      return kPrecedenceEquality;
+    case kOpLess:
+    case kOpLessEq:
+    case kOpGreater:
+    case kOpGreaterEq:
+      return kPrecedenceComparison;
+    case kOpIsNull:
+      return kPrecedenceIsNull;
+    case kOpPlus:
+    case kOpMinus:
+    case kOpUnaryMinus:
+      return kPrecedenceAdditive;
+    case kOpAsterisk:
+    case kOpSlash:
+    case kOpPercentage:
+      return kPrecedenceMultiplicative;
+    case kOpCaret:
+      return kPrecedenceCaret;
+    case kOpConcat:
+      return kPrecedenceConcat;
+    default:
+      return kPrecedencePrimary;
+  }
+}
+
+// Text of the binary operators between their operands, nullptr for all other operators.
+const char* binaryOperator(OperatorType opType) {
+  switch (opType) {
+    case kOpPlus:
+      return " + ";
+    case kOpMinus:
+      return " - ";
+    case kOpAsterisk:
+      return " * ";
+    case kOpSlash:
+      return " / ";
+    case kOpPercentage:
+      return " % ";
+    case kOpCaret:
+      return " ^ ";
+    case kOpEquals:
+      return " = ";
+    case kOpNotEquals:
+      return " <> ";
+    case kOpLess:
+      return " < ";
+    case kOpLessEq:
+      return " <= ";
+    case kOpGreater:
+      return " > ";
+    case kOpGreaterEq:
+      return " >= ";
+    case kOpLike:
+      return " LIKE ";
+    case kOpNotLike:
+      return " NOT LIKE ";
+    case kOpILike:
+      return " ILIKE ";
+    case kOpConcat:
+      return " || ";
+    default:
+      return nullptr;
+  }
+}
+
+const char* datetimeField(DatetimeField field) {
+  switch (field) {
+    case kDatetimeSecond:
+      return "SECOND";
+    case kDatetimeMinute:
+      return "MINUTE";
+    case kDatetimeHour:
+      return "HOUR";
+    case kDatetimeDay:
+      return "DAY";
+    case kDatetimeMonth:
+      return "MONTH";
+    case kDatetimeYear:
+      return "YEAR";
+    default:
+      return "";
+  }
+}
+
+const char* fileType(ImportType type) {
+  switch (type) {
+    case kImportCSV:
+      return "CSV";
+    case kImportTbl:
+      return "TBL";
+    case kImportBinary:
+      return "BINARY";
+    default:
+      return nullptr;
+  }
+}
+
+bool isLetter(char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+
+bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+// Pending output of Writer::writeExpr(): an expression, or a part of the text of an expression
+// that follows one of its operands.
+struct Task {
+  enum Kind { kExpr, kText, kIdentifier, kArrayIndex, kColumnType, kSubquery, kLineBreak };
+
+  Kind kind;
+  const Expr* expr;
+  const char* text;
+
+  // kExpr: the expression is put in parentheses if it binds more loosely.
+  Precedence precedence;
+
+  // kExpr: in pretty mode, the chain of AND or OR operators that starts at the expression is
+  // broken into lines.
+  bool breakLines;
+};
+
+Task operand(const Expr* expr, Precedence precedence, bool breakLines = false) {
+  return {Task::kExpr, expr, nullptr, precedence, breakLines};
+}
+
+Task text(const char* text) { return {Task::kText, nullptr, text, kPrecedenceAny, false}; }
+
+Task identifier(const char* name) { return {Task::kIdentifier, nullptr, name, kPrecedenceAny, false}; }
+
+Task part(Task::Kind kind, const Expr* expr) { return {kind, expr, nullptr, kPrecedenceAny, false}; }
+
+// Appends the SQL text of statements and expressions.
+class Writer {
+ public:
+  Writer(std::string* out, UnparseMode mode) : out_(out), pretty_(mode == kUnparsePretty), depth_(0) {}
+
+  void writeStatement(const SQLStatement* statement);
+
+  void writeExpr(const Expr* expr, bool breakLines = false);
+
+  // Writes the next statement of a result on a new line in pretty mode.
+  void separateStatements() { pretty_ ? out_->push_back('\n') : out_->push_back(' '); }
+
+  void append(const char* text) { out_->append(text); }
+
+  void append(char c) { out_->push_back(c); }
+
+ private:
+  // Keywords are quoted, as are names that the lexer would not read as one identifier.
+  void appendIdentifier(const char* name);
+
+  void appendTableName(const char* schema, const char* name) {
+    if (schema != nullptr) {
+      appendIdentifier(schema);
+      append('.');
+    }
+    appendIdentifier(name);
+  }
+
+  void appendIdentifiers(const std::vector<char*>* names) {
+    for (size_t i = 0; i < names->size(); ++i) {
+      if (i > 0) append(", ");
+      appendIdentifier(names->at(i));
+    }
+  }
+
+  void appendString(const char* value);
+  void appendInt(int64_t value);
+  void appendFloat(double value);
+  void appendColumnType(const ColumnType& columnType);
+
+  void lineBreak() {
+    out_->push_back('\n');
+    out_->append(2 * depth_, ' ');
+  }
+
+  // Starts the next clause.
+  void separate() { pretty_ ? lineBreak() : append(' '); }
+
+  // Parentheses around subqueries and lists that are written one element per line in pretty mode.
+  void openBlock() {
+    append('(');
+    if (!pretty_) return;
+    ++depth_;
+    lineBreak();
+  }
+
+  void closeBlock() {
+    if (pretty_) {
+      --depth_;
+      lineBreak();
+    }
+    append(')');
+  }
+
+  // Schedules the list, each expression followed by its alias. Tasks are popped from the back, so
+  // the elements are pushed in reverse order.
+  void pushList(const std::vector<Expr*>* exprs, const char* separator = ", ");
+
+  void writeList(const std::vector<Expr*>* exprs);
+  void writeClause(const char* keyword, const Expr* expr);
+
+  void writeSelect(const SelectStatement* select);
+  void writeSelectBody(const SelectStatement* select, size_t numSetOperations);
+  void writeSelectClause(const SelectStatement* select);
+  void writeSetOperand(const SelectStatement* select);
+  void writeOrder(const std::vector<OrderDescription*>* order);
+  void writeLimit(const LimitDescription* limit);
+  void writeTable(const TableRef* table);
+  void writeAlias(const Alias* alias);
+
+  void writeInsert(const InsertStatement* insert);
+  void writeValue(const ValuesColumn& column, size_t row);
+  void writeCreate(const CreateStatement* create);
+  void writeColumnDefinition(const ColumnDefinition* column);
+  void writeStatementBody(const SQLStatement* statement);
+
+  std::string* out_;
+  const bool pretty_;
+  size_t depth_;
+
+  // Shared by the nested calls of writeExpr() for subqueries.
+  std::vector<Task> tasks_;
+};
+
+void Writer::appendIdentifier(const char* name) {
+  if (name == nullptr) return;
+  bool isPlain = isLetter(name[0]);
+  size_t length = 0;
+  for (; name[length] != '\0'; ++length) {
+    const char c = name[length];
+    isPlain = isPlain && (isLetter(c) || isDigit(c) || c == '_');
+  }
+  if (isPlain && lookupKeyword(name, length) == 0) {
+    out_->append(name, length);
+    return;
+  }
+  append('"');
+  out_->append(name, length);
+  append('"');
+}
+
+void Writer::appendString(const char* value) {
+  append('\'');
+  // Quotes are escaped by doubling them.
+  for (const char* quote = strchr(value, '\''); quote != nullptr; quote = strchr(value, '\'')) {
+    out_->append(value, quote - value + 1);
+    append('\'');
+    value = quote + 1;
+  }
+  append(value);
+  append('\'');
+}
+
+void Writer::appendInt(int64_t value) {
+  char digits[24];
+  char* begin = digits + sizeof(digits);
+  // Negated as unsigned, which also works for INT64_MIN.
+  uint64_t magnitude = value < 0 ? 0 - static_cast<uint64_t>(value) : value;
+  do {
+    *--begin = static_cast<char>('0' + magnitude % 10);
+    magnitude /= 10;
+  } while (magnitude != 0);
+  if (value < 0) *--begin = '-';
+  out_->append(begin, digits + sizeof(digits) - begin);
+}
+
+void Writer::appendFloat(double value) {
+  char text[32];
+  if (!isfinite(value)) {
+    snprintf(text, sizeof(text), "%g", value);
+    append(text);
+    return;
+  }
+
+  // The shortest precision that reads back as the same value, so that the text is stable.
+  for (int precision = 15; precision <= 17; ++precision) {
+    snprintf(text, sizeof(text), "%.*e", precision - 1, value);
+    if (strtod(text, nullptr) == value) break;
+  }
+
+  // The lexer reads no exponents, so the digits of d.ddde±x are written out in full.
+  const char* mantissa = text;
+  if (*mantissa == '-') {
+    append('-');
+    ++mantissa;
+  }
+  char* exponentBegin = strchr(text, 'e');
+  const int exponent = atoi(exponentBegin + 1);
+  char digits[20];
+  size_t numDigits = 0;
+  for (const char* c = mantissa; c < exponentBegin; ++c) {
+    if (*c != '.') digits[numDigits++] = *c;
+  }
+  while (numDigits > 1 && digits[numDigits - 1] == '0') --numDigits;
+
+  // Number of digits before the decimal point.
+  const int point = exponent + 1;
+  if (point <= 0) {
+    append("0.");
+    out_->append(-point, '0');
+    out_->append(digits, numDigits);
+  } else if (static_cast<size_t>(point) >= numDigits) {
+    out_->append(digits, numDigits);
+    out_->append(point - numDigits, '0');
+    append(".0");
+  } else {
+    out_->append(digits, point);
+    append('.');
+    out_->append(digits + point, numDigits - point);
+  }
+}
+
+void Writer::appendColumnType(const ColumnType& columnType) {
+  switch (columnType.data_type) {
+    case DataType::CHAR:
+      append("CHAR(");
+      appendInt(columnType.length);
+      append(')');
+      return;
+    case DataType::VARCHAR:
+      append("VARCHAR(");
+      appendInt(columnType.length);
+      append(')');
+      return;
+    case DataType::DECIMAL:
+      append("DECIMAL");
+      if (columnType.precision == 0 && columnType.scale == 0) return;
+      append('(');
+      appendInt(columnType.precision);
+      if (columnType.scale != 0) {
+        append(", ");
+        appendInt(columnType.scale);
+      }
+      append(')');
+      return;
+    case DataType::TIME:
+      append("TIME");
+      if (columnType.precision == 0) return;
+      append('(');
+      appendInt(columnType.precision);
+      append(')');
+      return;
+    case DataType::DATE:
+      append("DATE");
+      return;
+    case DataType::DATETIME:
+      append("DATETIME");
+      return;
+    case DataType::DOUBLE:
+      append("DOUBLE");
+      return;
+    case DataType::FLOAT:
+      append("FLOAT");
+      return;
+    case DataType::INT:
+      append("INT");
+      return;
+    case DataType::LONG:
+      append("LONG");
+      return;
+    case DataType::REAL:
+      append("REAL");
+      return;
+    case DataType::SMALLINT:
+      append("SMALLINT");
+      return;
+    case DataType::TEXT:
+      append("TEXT");
+      return;
+    case DataType::UNKNOWN:
+      append("UNKNOWN");
+      return;
+  }
+}
+
+void Writer::pushList(const std::vector<Expr*>* exprs, const char* separator) {
+  if (exprs == nullptr) return;
+  for (size_t i = exprs->size(); i-- > 0;) {
+    const Expr* expr = exprs->at(i);
+    if (expr->alias != nullptr) {
+      tasks_.push_back(identifier(expr->alias));
+      tasks_.push_back(text(" AS "));
+    }
+    tasks_.push_back(operand(expr, kPrecedenceAny));
+    if (i > 0) tasks_.push_back(text(separator));
+  }
+}
+
+void Writer::writeExpr(const Expr* root, bool breakLines) {
+  // Operands are written from an explicit stack instead of recursively, so that deep trees (e.g.
+  // long chains of AND) do not overflow the call stack. Subqueries recurse through writeSelect()
+  // and share the stack, this call owns the tasks above base.
+  const size_t base = tasks_.size();
+  tasks_.push_back(operand(root, kPrecedenceAny, breakLines));
+  while (tasks_.size() > base) {
+    const Task task = tasks_.back();
+    tasks_.pop_back();
+
+    switch (task.kind) {
+      case Task::kText:
+        append(task.text);
+        continue;
+      case Task::kIdentifier:
+        appendIdentifier(task.text);
+        continue;
+      case Task::kArrayIndex:
+        append('[');
+        appendInt(task.expr->ival);
+        append(']');
+        continue;
+      case Task::kColumnType:
+        appendColumnType(task.expr->columnType);
+        continue;
+      case Task::kSubquery:
+        openBlock();
+        writeSelect(task.expr->select);
+        closeBlock();
+        continue;
+      case Task::kLineBreak:
+        lineBreak();
+        continue;
+      case Task::kExpr:
+        break;
+    }
+
+    const Expr* expr = task.expr;
+    if (expr == nullptr) continue;
+    bool breakLines = task.breakLines && pretty_;
+    if (precedence(expr) < task.precedence) {
+      append('(');
+      tasks_.push_back(text(")"));
+      breakLines = false;
+    }
+
+    switch (expr->type) {
+      case kExprLiteralFloat:
+        appendFloat(expr->fval);
+        break;
+      case kExprLiteralString:
+        appendString(expr->name);
+        break;
+      case kExprLiteralInt:
+        if (expr->isBoolLiteral) {
+          append(expr->ival != 0 ? "TRUE" : "FALSE");
+        } else {
+          appendInt(expr->ival);
+        }
+        break;
+      case kExprLiteralNull:
+        append("NULL");
+        break;
+      case kExprLiteralDate:
+        append("DATE ");
+        appendString(expr->name);
+        break;
+      case kExprLiteralInterval:
+        // INTERVAL 'n' takes an int, larger durations are written as n DAYS etc.
+        if (expr->ival >= INT32_MIN && expr->ival <= INT32_MAX) {
+          append("INTERVAL '");
+          appendInt(expr->ival);
+          append("' ");
+        } else {
+          appendInt(expr->ival);
+          append(' ');
+        }
+        append(datetimeField(expr->datetimeField));
+        break;
+      case kExprStar:
+        if (expr->table != nullptr) {
+          appendIdentifier(expr->table);
+          append('.');
+        }
+        append('*');
+        break;
+      case kExprParameter:
+        append('?');
+        break;
+      case kExprColumnRef:
+        appendTableName(expr->table, expr->name);
+        break;
+      case kExprFunctionRef:
+        appendIdentifier(expr->name);
+        append('(');
+        if (expr->distinct) append("DISTINCT ");
+        tasks_.push_back(text(")"));
+        pushList(expr->exprList);
+        break;
+      case kExprSelect:
+        tasks_.push_back(part(Task::kSubquery, expr));
+        break;
+      case kExprHint:
+        appendIdentifier(expr->name);
+        if (expr->exprList == nullptr) break;
+        append('(');
+        tasks_.push_back(text(")"));
+        pushList(expr->exprList);
+        break;
+      case kExprArray:
+        append("ARRAY[");
+        tasks_.push_back(text("]"));
+        pushList(expr->exprList);
+        break;
+      case kExprArrayIndex:
+        tasks_.push_back(part(Task::kArrayIndex, expr));
+        tasks_.push_back(operand(expr->expr, kPrecedencePrimary));
+        break;
+      case kExprExtract:
+        append("EXTRACT(");
+        append(datetimeField(expr->datetimeField));
+        append(" FROM ");
+        tasks_.push_back(text(")"));
+        tasks_.push_back(operand(expr->expr, kPrecedenceAny));
+        break;
+      case kExprCast:
+        append("CAST(");
+        tasks_.push_back(text(")"));
+        tasks_.push_back(part(Task::kColumnType, expr));
+        tasks_.push_back(text(" AS "));
+        tasks_.push_back(operand(expr->expr, kPrecedenceAny));
+        break;
+      case kExprOperator:
+        break;
+    }
+    if (expr->type != kExprOperator) continue;
+
+    if (const char* op = binaryOperator(expr->opType)) {
+      // The operators of one level are left-associative, or non-associative for comparisons.
+      const Precedence level = precedence(expr);
+      const bool isAssociative = level >= kPrecedenceAdditive;
+      tasks_.push_back(operand(expr->expr2, static_cast<Precedence>(level + 1)));
+      tasks_.push_back(text(op));
+      tasks_.push_back(operand(expr->expr, static_cast<Precedence>(isAssociative ? level : level + 1)));
+      continue;
+    }
+
+    switch (expr->opType) {
+      case kOpAnd:
+      case kOpOr: {
+        // In pretty mode, the conditions of a clause are broken into lines, each line starting
+        // with its AND or OR. Parenthesized conditions stay on one line.
+        const Precedence level = precedence(expr);
+        const char* op = expr->opType == kOpAnd ? " AND " : " OR ";
+        const auto pushOperator = [&]() {
+          if (breakLines) {
+            tasks_.push_back(text(op + 1));
+            tasks_.push_back(part(Task::kLineBreak, nullptr));
+          } else {
+            tasks_.push_back(text(op));
+          }
+        };
+        if (expr->isNaryOperator(expr->opType)) {
+          for (size_t i = expr->exprList->size(); i-- > 1;) {
+            tasks_.push_back(operand(expr->exprList->at(i), static_cast<Precedence>(level + 1)));
+            pushOperator();
+          }
+          tasks_.push_back(operand(expr->exprList->front(), level, breakLines));
+        } else {
+          tasks_.push_back(operand(expr->expr2, static_cast<Precedence>(level + 1)));
+          pushOperator();
+          tasks_.push_back(operand(expr->expr, level, breakLines));
+        }
+        break;
+      }
+      case kOpNot: {
+        const Expr* negated = expr->expr;
+        if (isOperator(negated, kOpIn)) {
+          tasks_.push_back(negated->select != nullptr ? part(Task::kSubquery, negated) : text(")"));
+          if (negated->select == nullptr) pushList(negated->exprList);
+          tasks_.push_back(text(negated->select != nullptr ? " NOT IN " : " NOT IN ("));
+          tasks_.push_back(operand(negated->expr, kPrecedenceEquality));
+        } else if (isOperator(negated, kOpExists)) {
+          append("NOT EXISTS ");
+          tasks_.push_back(part(Task::kSubquery, negated));
+        } else if (isOperator(negated, kOpIsNull)) {
+          tasks_.push_back(text(" IS NOT NULL"));
+          tasks_.push_back(operand(negated->expr, kPrecedenceAdditive));
+        } else {
+          append("NOT ");
+          tasks_.push_back(operand(negated, kPrecedenceNot));
+        }
+        break;
+      }
+      case kOpUnaryMinus:
+        append('-');
+        tasks_.push_back(operand(expr->expr, kPrecedenceMultiplicative));
+        break;
+      case kOpIsNull:
+        tasks_.push_back(text(" IS NULL"));
+        tasks_.push_back(operand(expr->expr, kPrecedenceAdditive));
+        break;
+      case kOpExists:
+        append("EXISTS ");
+        tasks_.push_back(part(Task::kSubquery, expr));
+        break;
+      case kOpIn:
+        tasks_.push_back(expr->select != nullptr ? part(Task::kSubquery, expr) : text(")"));
+        if (expr->select == nullptr) pushList(expr->exprList);
+        tasks_.push_back(text(expr->select != nullptr ? " IN " : " IN ("));
+        tasks_.push_back(operand(expr->expr, kPrecedenceEquality));
+        break;
+      case kOpBetween:
+        // The operands of BETWEEN may not be NOT expressions, which would take the BETWEEN as
+        // their operand.
+        tasks_.push_back(operand(expr->exprList->at(1), kPrecedenceEquality));
+        tasks_.push_back(text(" AND "));
+        tasks_.push_back(operand(expr->exprList->at(0), kPrecedenceEquality));
+        tasks_.push_back(text(" BETWEEN "));
+        tasks_.push_back(operand(expr->expr, kPrecedenceEquality));
+        break;
+      case kOpCase:
+        append("CASE");
+        tasks_.push_back(text(" END"));
+        if (expr->expr2 != nullptr) {
+          tasks_.push_back(operand(expr->expr2, kPrecedenceAny));
+          tasks_.push_back(text(" ELSE "));
+        }
+        for (size_t i = expr->exprList->size(); i-- > 0;) {
+          const Expr* element = expr->exprList->at(i);
+          tasks_.push_back(operand(element->expr2, kPrecedenceAny));
+          tasks_.push_back(text(" THEN "));
+          tasks_.push_back(operand(element->expr, kPrecedenceAny));
+          tasks_.push_back(text(" WHEN "));
+        }
+        if (expr->expr != nullptr) {
+          tasks_.push_back(operand(expr->expr, kPrecedenceAny));
+          tasks_.push_back(text(" "));
+        }
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+void Writer::writeList(const std::vector<Expr*>* exprs) {
+  // Subqueries in the list are indented below the clause.
+  ++depth_;
+  for (size_t i = 0; i < exprs->size(); ++i) {
+    if (i > 0) append(", ");
+    writeExpr(exprs->at(i));
+    if (exprs->at(i)->alias != nullptr) {
+      append(" AS ");
+      appendIdentifier(exprs->at(i)->alias);
+    }
+  }
+  --depth_;
+}
+
+void Writer::writeClause(const char* keyword, const Expr* expr) {
+  separate();
+  append(keyword);
+  append(' ');
+  ++depth_;
+  writeExpr(expr, true);
+  --depth_;
+}
+
+void Writer::writeSelect(const SelectStatement* select) {
+  if (select->withDescriptions != nullptr) {
+    append("WITH ");
+    for (size_t i = 0; i < select->withDescriptions->size(); ++i) {
+      const WithDescription* description = select->withDescriptions->at(i);
+      if (i > 0) append(", ");
+      appendIdentifier(description->alias);
+      append(" AS ");
+      openBlock();
+      writeSelect(description->select);
+      closeBlock();
+    }
+    separate();
+  }
+  writeSelectBody(select, select->setOperations != nullptr ? select->setOperations->size() : 0);
+}
+
+// The set operations of a statement are applied one after the other, so the statement with the
+// first n operations is the left side of operation n + 1. Only a single operation can follow the
+// clauses of a statement without parentheses, and only if it has no ORDER BY or LIMIT of its own.
+void Writer::writeSelectBody(const SelectStatement* select, size_t numSetOperations) {
+  if (numSetOperations == 0) {
+    writeSelectClause(select);
+    writeOrder(select->order);
+    writeLimit(select->limit);
+    return;
+  }
+
+  if (numSetOperations == 1 && select->order == nullptr && select->limit == nullptr) {
+    writeSelectClause(select);
+  } else {
+    openBlock();
+    writeSelectBody(select, numSetOperations - 1);
+    closeBlock();
+  }
+
+  const SetOperation* operation = select->setOperations->at(numSetOperations - 1);
+  separate();
+  switch (operation->setType) {
+    case kSetUnion:
+      append("UNION");
+      break;
+    case kSetIntersect:
+      append("INTERSECT");
+      break;
+    case kSetExcept:
+      append("EXCEPT");
+      break;
+  }
+  if (operation->isAll) append(" ALL");
+  separate();
+  writeSetOperand(operation->nestedSelectStatement);
+  writeOrder(operation->resultOrder);
+  writeLimit(operation->resultLimit);
+}
+
+void Writer::writeSetOperand(const SelectStatement* select) {
+  // The right side of a set operation needs no parentheses if it is a chain of set operations
+  // without ORDER BY and LIMIT.
+  bool isChain = true;
+  for (const SelectStatement* link = select; link != nullptr && isChain;) {
+    isChain = link->order == nullptr && link->limit == nullptr && link->withDescriptions == nullptr;
+    const size_t numSetOperations = link->setOperations != nullptr ? link->setOperations->size() : 0;
+    if (numSetOperations == 0) break;
+    const SetOperation* operation = link->setOperations->front();
+    isChain = isChain && numSetOperations == 1 && operation->resultOrder == nullptr && operation->resultLimit == nullptr;
+    link = operation->nestedSelectStatement;
+  }
+
+  if (isChain) {
+    writeSelect(select);
+    return;
+  }
+  openBlock();
+  writeSelect(select);
+  closeBlock();
+}
+
+void Writer::writeSelectClause(const SelectStatement* select) {
+  append("SELECT ");
+  if (select->selectDistinct) append("DISTINCT ");
+  writeList(select->selectList);
+  if (select->fromTable != nullptr) {
+    separate();
+    append("FROM ");
+    ++depth_;
+    writeTable(select->fromTable);
+    --depth_;
+  }
+  if (select->whereClause != nullptr) writeClause("WHERE", select->whereClause);
+  if (select->groupBy != nullptr) {
+    separate();
+    append("GROUP BY ");
+    writeList(select->groupBy->columns);
+    if (select->groupBy->having != nullptr) writeClause("HAVING", select->groupBy->having);
+  }
+}
+
+void Writer::writeOrder(const std::vector<OrderDescription*>* order) {
+  if (order == nullptr) return;
+  separate();
+  append("ORDER BY ");
+  ++depth_;
+  for (size_t i = 0; i < order->size(); ++i) {
+    if (i > 0) append(", ");
+    writeExpr(order->at(i)->expr);
+    if (order->at(i)->type == kOrderDesc) append(" DESC");
+  }
+  --depth_;
+}
+
+void Writer::writeLimit(const LimitDescription* limit) {
+  if (limit == nullptr) return;
+  separate();
+  if (limit->limit != nullptr) {
+    append("LIMIT ");
+    writeExpr(limit->limit);
+  } else if (limit->offset == nullptr) {
+    append("LIMIT ALL");
+  }
+  if (limit->offset != nullptr) {
+    if (limit->limit != nullptr) append(' ');
+    append("OFFSET ");
+    writeExpr(limit->offset);
+  }
+}
+
+void Writer::writeAlias(const Alias* alias) {
+  if (alias == nullptr) return;
+  append(" AS ");
+  appendIdentifier(alias->name);
+  if (alias->columns == nullptr) return;
+  append(" (");
+  appendIdentifiers(alias->columns);
+  append(')');
+}
+
+void Writer::writeTable(const TableRef* table) {
+  switch (table->type) {
+    case kTableName:
+      appendTableName(table->schema, table->name);
+      break;
+    case kTableSelect:
+      openBlock();
+      writeSelect(table->select);
+      closeBlock();
+      break;
+    case kTableJoin: {
+      const JoinDefinition* join = table->join;
+      writeTable(join->left);
+      separate();
+      switch (join->type) {
+        case kJoinInner:
+          append("JOIN ");
+          break;
+        case kJoinFull:
+          append("FULL JOIN ");
+          break;
+        case kJoinLeft:
+          append("LEFT JOIN ");
+          break;
+        case kJoinRight:
+          append("RIGHT JOIN ");
+          break;
+        case kJoinCross:
+          append("CROSS JOIN ");
+          break;
+        case kJoinNatural:
+          append("NATURAL JOIN ");
+          break;
+      }
+      writeTable(join->right);
+      if (join->condition != nullptr) {
+        append(" ON ");
+        writeExpr(join->condition);
+      }
+      break;
+    }
+    case kTableCrossProduct:
+      for (size_t i = 0; i < table->list->size(); ++i) {
+        if (i > 0) append(", ");
+        writeTable(table->list->at(i));
+      }
+      break;
+  }
+  writeAlias(table->alias);
+}
+
+void Writer::writeValue(const ValuesColumn& column, size_t row) {
+  if (column.isNull(row)) {
+    append("NULL");
+    return;
+  }
+  if (column.hasExpressions()) {
+    writeExpr(column.exprValue(row));
+    return;
+  }
+  switch (column.type) {
+    case kExprLiteralInt:
+      if (column.isBool) {
+        append(column.intValue(row) != 0 ? "TRUE" : "FALSE");
+      } else {
+        appendInt(column.intValue(row));
+      }
+      break;
+    case kExprLiteralFloat:
+      appendFloat(column.floatValue(row));
+      break;
+    case kExprLiteralString:
+      appendString(column.stringValue(row));
+      break;
+    case kExprLiteralDate:
+      append("DATE ");
+      appendString(column.stringValue(row));
+      break;
+    default:
+      break;
+  }
+}
+
+void Writer::writeInsert(const InsertStatement* insert) {
+  append("INSERT INTO ");
+  appendTableName(insert->schema, insert->tableName);
+  if (insert->columns != nullptr) {
+    append(" (");
+    appendIdentifiers(insert->columns);
+    append(')');
+  }
+  separate();
+  if (insert->type == kInsertSelect) {
+    writeSelect(insert->select);
+    return;
+  }
+
+  // Each row on its own line in pretty mode.
+  append("VALUES");
+  ++depth_;
+  separate();
+  if (insert->values != nullptr) {
+    append('(');
+    writeList(insert->values);
+    append(')');
+  } else if (insert->rows != nullptr) {
+    for (size_t row = 0; row < insert->rows->numRows; ++row) {
+      if (row > 0) {
+        append(',');
+        separate();
+      }
+      append('(');
+      for (size_t i = 0; i < insert->rows->columns.size(); ++i) {
+        if (i > 0) append(", ");
+        writeValue(insert->rows->columns[i], row);
+      }
+      append(')');
+    }
+  }
+  --depth_;
+}
+
+void Writer::writeColumnDefinition(const ColumnDefinition* column) {
+  appendIdentifier(column->name);
+  append(' ');
+  appendColumnType(column->type);
+  if (column->nullable) append(" NULL");
+  if (column->column_constraints == nullptr) return;
+  for (ConstraintType constraint : *column->column_constraints) {
+    switch (constraint) {
+      case ConstraintType::PrimaryKey:
+        append(" PRIMARY KEY");
+        break;
+      case ConstraintType::Unique:
+        append(" UNIQUE");
+        break;
+      case ConstraintType::NotNull:
+        append(" NOT NULL");
+        break;
+      case ConstraintType::Null:
+        append(" NULL");
+        break;
+      case ConstraintType::None:
+        break;
+    }
+  }
+}
+
+void Writer::writeCreate(const CreateStatement* create) {
+  append("CREATE ");
+  switch (create->type) {
+    case kCreateTable:
+    case kCreateTableFromTbl:
+      append("TABLE ");
+      break;
+    case kCreateView:
+      append("VIEW ");
+      break;
+    case kCreateIndex:
+      append("INDEX ");
+      break;
+  }
+  if (create->ifNotExists) append("IF NOT EXISTS ");
+
+  if (create->type == kCreateIndex) {
+    if (create->indexName != nullptr) {
+      appendIdentifier(create->indexName);
+      append(' ');
+    }
+    append("ON ");
+    appendIdentifier(create->tableName);
+    append(" (");
+    if (create->indexColumns != nullptr) appendIdentifiers(create->indexColumns);
+    append(')');
+    return;
+  }
+
+  appendTableName(create->schema, create->tableName);
+  if (create->type == kCreateTableFromTbl) {
+    append(" FROM TBL FILE ");
+    appendString(create->filePath);
+    return;
+  }
+  if (create->viewColumns != nullptr) {
+    append(" (");
+    appendIdentifiers(create->viewColumns);
+    append(')');
+  }
+  if (create->select != nullptr) {
+    append(" AS");
+    separate();
+    writeSelect(create->select);
+    return;
+  }
+
+  // Each column and constraint on its own line in pretty mode.
+  append(' ');
+  openBlock();
+  bool isFirst = true;
+  const auto separateElement = [&]() {
+    if (!isFirst) {
+      append(',');
+      separate();
+    }
+    isFirst = false;
+  };
+  if (create->columns != nullptr) {
+    for (const ColumnDefinition* column : *create->columns) {
+      separateElement();
+      writeColumnDefinition(column);
+    }
+  }
+  if (create->tableConstraints != nullptr) {
+    for (const TableConstraint* constraint : *create->tableConstraints) {
+      separateElement();
+      append(constraint->type == ConstraintType::PrimaryKey ? "PRIMARY KEY (" : "UNIQUE (");
+      appendIdentifiers(constraint->columnNames);
+      append(')');
+    }
+  }
+  closeBlock();
+}
+
+void Writer::writeStatementBody(const SQLStatement* statement) {
+  switch (statement->type()) {
+    case kStmtSelect:
+      writeSelect(static_cast<const SelectStatement*>(statement));
+      break;
+    case kStmtImport: {
+      const auto* import = static_cast<const ImportStatement*>(statement);
+      append("COPY ");
+      appendTableName(import->schema, import->tableName);
+      append(" FROM ");
+      appendString(import->filePath);
+      if (const char* type = fileType(import->type)) {
+        append(" WITH FORMAT ");
+        append(type);
+      }
+      break;
+    }
+    case kStmtExport: {
+      const auto* exportStatement = static_cast<const ExportStatement*>(statement);
+      append("COPY ");
+      appendTableName(exportStatement->schema, exportStatement->tableName);
+      append(" TO ");
+      appendString(exportStatement->filePath);
+      if (const char* type = fileType(exportStatement->type)) {
+        append(" WITH FORMAT ");
+        append(type);
+      }
+      break;
+    }
+    case kStmtInsert:
+      writeInsert(static_cast<const InsertStatement*>(statement));
+      break;
+    case kStmtUpdate: {
+      const auto* update = static_cast<const UpdateStatement*>(statement);
+      append("UPDATE ");
+      writeTable(update->table);
+      separate();
+      append("SET ");
+      ++depth_;
+      for (size_t i = 0; i < update->updates->size(); ++i) {
+        if (i > 0) append(", ");
+        appendIdentifier(update->updates->at(i)->column);
+        append(" = ");
+        writeExpr(update->updates->at(i)->value);
+      }
+      --depth_;
+      if (update->where != nullptr) writeClause("WHERE", update->where);
+      break;
+    }
+    case kStmtDelete: {
+      const auto* deleteStatement = static_cast<const DeleteStatement*>(statement);
+      append("DELETE FROM ");
+      appendTableName(deleteStatement->schema, deleteStatement->tableName);
+      if (deleteStatement->expr != nullptr) writeClause("WHERE", deleteStatement->expr);
+      break;
+    }
+    case kStmtCreate:
+      writeCreate(static_cast<const CreateStatement*>(statement));
+      break;
+    case kStmtDrop: {
+      const auto* drop = static_cast<const DropStatement*>(statement);
+      switch (drop->type) {
+        case kDropTable:
+          append("DROP TABLE ");
+          break;
+        case kDropSchema:
+          append("DROP SCHEMA ");
+          break;
+        case kDropIndex:
+          append("DROP INDEX ");
+          break;
+        case kDropView:
+          append("DROP VIEW ");
+          break;
+        case kDropPreparedStatement:
+          append("DEALLOCATE PREPARE ");
+          appendIdentifier(drop->name);
+          return;
+      }
+      if (drop->ifExists) append("IF EXISTS ");
+      if (drop->type == kDropIndex) {
+        appendIdentifier(drop->indexName);
+      } else {
+        appendTableName(drop->schema, drop->name);
+      }
+      break;
+    }
+    case kStmtPrepare: {
+      const auto* prepare = static_cast<const PrepareStatement*>(statement);
+      append("PREPARE ");
+      appendIdentifier(prepare->name);
+      append(" FROM ");
+      appendString(prepare->query);
+      break;
+    }
+    case kStmtExecute: {
+      const auto* execute = static_cast<const ExecuteStatement*>(statement);
+      append("EXECUTE ");
+      appendIdentifier(execute->name);
+      if (execute->parameters != nullptr) {
+        append('(');
+        writeList(execute->parameters);
+        append(')');
+      }
+      break;
+    }
+    case kStmtAlter: {
+      const auto* alter = static_cast<const AlterStatement*>(statement);
+      append("ALTER TABLE ");
+      if (alter->ifTableExists) append("IF EXISTS ");
+      appendTableName(alter->schema, alter->name);
+      if (alter->action->type == DropColumn) {
+        const auto* action = static_cast<const DropColumnAction*>(alter->action);
+        append(" DROP COLUMN ");
+        if (action->ifExists) append("IF EXISTS ");
+        appendIdentifier(action->columnName);
+      }
+      break;
+    }
+    case kStmtShow: {
+      const auto* show = static_cast<const ShowStatement*>(statement);
+      if (show->type == kShowTables) {
+        append("SHOW TABLES");
+      } else {
+        append("SHOW COLUMNS ");
+        appendTableName(show->schema, show->name);
+      }
+      break;
+    }
+    case kStmtTransaction:
+      switch (static_cast<const TransactionStatement*>(statement)->command) {
+        case kBeginTransaction:
+          append("BEGIN");
+          break;
+        case kCommitTransaction:
+          append("COMMIT");
+          break;
+        case kRollbackTransaction:
+          append("ROLLBACK");
+          break;
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+void Writer::writeStatement(const SQLStatement* statement) {
+  writeStatementBody(statement);
+  if (statement->hints == nullptr) return;
+  separate();
+  append("WITH HINT(");
+  writeList(statement->hints);
+  append(')');
+}
+
+}  // namespace
+
+void SQLUnparser::unparse(const SQLParserResult& result, std::string* out, UnparseMode mode) {
+  Writer writer(out, mode);
+  for (size_t i = 0; i < result.size(); ++i) {
+    if (i > 0) writer.separateStatements();
+    writer.writeStatement(result.getStatement(i));
+    writer.append(';');
+  }
+}
+
+void SQLUnparser::unparse(const SQLStatement* statement, std::string* out, UnparseMode mode) {
+  Writer(out, mode).writeStatement(statement);
+}
+
+void SQLUnparser::unparse(const Expr* expr, std::string* out, UnparseMode mode) {
+  Writer(out, mode).writeExpr(expr);
+}
+
+}  // namespace hsql
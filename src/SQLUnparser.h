@@ -0,0 +1,44 @@
+#ifndef SQLPARSER_SQL_UNPARSER_H
+#define SQLPARSER_SQL_UNPARSER_H
+
+#include <string>
+#include "SQLParserResult.h"
+#include "sql/statements.h"
+
+namespace hsql {
+
+// Layout of the SQL text written by SQLUnparser.
+enum UnparseMode {
+  // A single line with upper case keywords and single spaces between the tokens. Equivalent
+  // statements are written as the same text, e.g. `a <> b` for `a != b`, and operands are only
+  // put in parentheses where the precedence of the operators requires it.
+  kUnparseCanonical,
+
+  // The canonical tokens, but each clause starts on a new line. Subqueries, column definitions
+  // and the rows of VALUES lists are indented by two spaces per level, as are the AND and OR
+  // conditions that follow the first one of a clause.
+  kUnparsePretty
+};
+
+// Writes statements and expressions as SQL text, e.g. after a proxy has rewritten a query.
+// Parsing the text yields the same statements, as long as they could have been parsed in the
+// first place: literals that the lexer cannot read, e.g. negative numbers, come back as unary
+// minus operators.
+//
+// The text is appended to out, so that a buffer can be reused for many statements.
+class SQLUnparser {
+ public:
+  // Appends the statements of the result, each terminated by a semicolon.
+  static void unparse(const SQLParserResult& result, std::string* out, UnparseMode mode = kUnparseCanonical);
+
+  // Appends the statement, including its hints.
+  static void unparse(const SQLStatement* statement, std::string* out, UnparseMode mode = kUnparseCanonical);
+
+  // Appends the expression. Aliases are only written in the lists that allow them, e.g. the
+  // select list, so the alias of expr itself is left out.
+  static void unparse(const Expr* expr, std::string* out, UnparseMode mode = kUnparseCanonical);
+};
+
+}  // namespace hsql
+
+#endif
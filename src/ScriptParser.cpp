@@ -0,0 +1,110 @@
+#include "ScriptParser.h"
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <algorithm>
+
+namespace hsql {
+
+ScriptParser::ScriptParser(int fd, size_t chunkSize)
+    : fd_(fd),
+      data_(nullptr),
+      dataSize_(0),
+      dataOffset_(0),
+      chunkSize_(std::max<size_t>(chunkSize, 1)),
+      readError_(false),
+      scanned_(0),
+      size_(0),
+      bufferOffset_(0),
+      offset_(0) {}
+
+ScriptParser::ScriptParser(const char* data, size_t size, size_t chunkSize)
+    : fd_(-1),
+      data_(data),
+      dataSize_(size),
+      dataOffset_(0),
+      chunkSize_(std::max<size_t>(chunkSize, 1)),
+      readError_(false),
+      scanned_(0),
+      size_(0),
+      bufferOffset_(0),
+      offset_(0) {}
+
+bool ScriptParser::next(SQLParserResult* result) {
+  result->reset();
+  for (;;) {
+    if (splitter_.scan(buffer_.data(), &scanned_, size_)) {
+      // Semicolons without a statement are skipped.
+      if (splitter_.hasContent()) break;
+      splitter_.reset();
+    } else if (!read()) {
+      // The last statement does not have to end with a semicolon.
+      if (readError_ || !splitter_.finish()) return false;
+      break;
+    }
+  }
+  parseStatement(splitter_.begin(), scanned_, result);
+  return true;
+}
+
+bool ScriptParser::read() {
+  if (readError_) return false;
+
+  // Move the current statement to the front of the buffer, dropping whitespace and comments before it.
+  const size_t begin = splitter_.hasStarted() ? splitter_.begin() : scanned_;
+  if (begin > 0) {
+    memmove(buffer_.data(), buffer_.data() + begin, size_ - begin);
+    size_ -= begin;
+    scanned_ -= begin;
+    bufferOffset_ += begin;
+    splitter_.shift(begin);
+  }
+  if (buffer_.size() < size_ + chunkSize_ + SQLInputBuffer::kPadding) {
+    buffer_.resize(size_ + chunkSize_ + SQLInputBuffer::kPadding);
+  }
+
+  size_t length = 0;
+  if (fd_ < 0) {
+    length = std::min(chunkSize_, dataSize_ - dataOffset_);
+    if (length > 0) memcpy(buffer_.data() + size_, data_ + dataOffset_, length);
+    dataOffset_ += length;
+  } else {
+    ssize_t bytesRead;
+    do {
+      bytesRead = ::read(fd_, buffer_.data() + size_, chunkSize_);
+    } while (bytesRead < 0 && errno == EINTR);
+    if (bytesRead < 0) {
+      readError_ = true;
+      return false;
+    }
+    length = bytesRead;
+  }
+
+  size_ += length;
+  return length > 0;
+}
+
+void ScriptParser::parseStatement(size_t begin, size_t end, SQLParserResult* result) {
+  // The statement is parsed in place. The bytes behind it are replaced by the padding the lexer
+  // requires and restored afterwards.
+  char* statement = buffer_.data() + begin;
+  const size_t length = end - begin;
+  char next[SQLInputBuffer::kPadding];
+  memcpy(next, statement + length, SQLInputBuffer::kPadding);
+  memset(statement + length, '\0', SQLInputBuffer::kPadding);
+
+  offset_ = bufferOffset_ + begin;
+  context_.parse(statement, length, result);
+  memcpy(statement + length, next, SQLInputBuffer::kPadding);
+  splitter_.reset();
+}
+
+size_t ScriptParser::offset() const { return offset_; }
+
+bool ScriptParser::hasReadError() const { return readError_; }
+
+size_t ScriptParser::bufferCapacity() const { return buffer_.capacity(); }
+
+ParserContext& ScriptParser::context() { return context_; }
+
+}  // namespace hsql
@@ -0,0 +1,81 @@
+#ifndef SQLPARSER_SCRIPT_PARSER_H
+#define SQLPARSER_SCRIPT_PARSER_H
+
+#include <stddef.h>
+#include <vector>
+#include "ParserContext.h"
+#include "SQLParserResult.h"
+#include "util/StatementSplitter.h"
+
+namespace hsql {
+
+// Parses a SQL script, e.g. a database dump, one statement at a time. The script is read
+// in chunks from a file descriptor or a memory region (e.g. a mmap'd file), so its size is
+// not limited by memory: the reader only holds the current chunk and the statement that is
+// being read, which may straddle any number of chunks.
+//
+// Statements end at semicolons outside of string literals, quoted identifiers and comments.
+// Each statement is parsed on its own, so an invalid statement does not stop the script.
+// Segments that only contain whitespace and comments are skipped.
+class ScriptParser {
+ public:
+  static constexpr size_t kDefaultChunkSize = 1 << 20;
+
+  // Reads the script from the file descriptor, which stays open.
+  explicit ScriptParser(int fd, size_t chunkSize = kDefaultChunkSize);
+
+  // Reads the script from memory, which must stay valid while statements are parsed.
+  ScriptParser(const char* data, size_t size, size_t chunkSize = kDefaultChunkSize);
+
+  ScriptParser(const ScriptParser&) = delete;
+  ScriptParser& operator=(const ScriptParser&) = delete;
+
+  // Resets the result and parses the next statement of the script into it.
+  // Returns false at the end of the script or if reading the file descriptor failed.
+  bool next(SQLParserResult* result);
+
+  // Byte offset of the statement returned by the last call to next() in the script. The
+  // error line and column of its result are relative to this offset.
+  size_t offset() const;
+
+  // Returns true if reading the file descriptor failed.
+  bool hasReadError() const;
+
+  // Size of the buffer that holds the current chunk and statement.
+  size_t bufferCapacity() const;
+
+  // Context the statements are parsed with, e.g. to select the lexer.
+  ParserContext& context();
+
+ private:
+  // Appends the next chunk of the script to the buffer. Returns false at the end of the script.
+  bool read();
+
+  // Parses the statement buffer_[begin, end) and starts the next one.
+  void parseStatement(size_t begin, size_t end, SQLParserResult* result);
+
+  // Source of the script: the file descriptor if it is not negative, the memory region otherwise.
+  const int fd_;
+  const char* data_;
+  const size_t dataSize_;
+  size_t dataOffset_;
+  const size_t chunkSize_;
+  bool readError_;
+
+  // Unparsed input, starting with the current statement. The input up to scanned_ has been
+  // scanned. Behind size_, there are always SQLInputBuffer::kPadding bytes of space.
+  std::vector<char> buffer_;
+  size_t scanned_;
+  size_t size_;
+  StatementSplitter splitter_;
+
+  // Offset of the buffer in the script, and of the last statement.
+  size_t bufferOffset_;
+  size_t offset_;
+
+  ParserContext context_;
+};
+
+}  // namespace hsql
+
+#endif
@@ -0,0 +1,36 @@
+#include "TokenStream.h"
+
+namespace hsql {
+
+TokenStream::TokenStream() : isComplete_(true) {}
+
+size_t TokenStream::size() const { return kinds_.size(); }
+
+const std::vector<int16_t>& TokenStream::kinds() const { return kinds_; }
+
+const std::vector<uint32_t>& TokenStream::offsets() const { return offsets_; }
+
+const std::vector<uint32_t>& TokenStream::lengths() const { return lengths_; }
+
+const std::vector<TokenValue>& TokenStream::values() const { return values_; }
+
+bool TokenStream::isComplete() const { return isComplete_; }
+
+void TokenStream::clear() {
+  kinds_.clear();
+  offsets_.clear();
+  lengths_.clear();
+  values_.clear();
+  isComplete_ = true;
+}
+
+void TokenStream::add(int16_t kind, uint32_t offset, uint32_t length, TokenValue value) {
+  kinds_.push_back(kind);
+  offsets_.push_back(offset);
+  lengths_.push_back(length);
+  values_.push_back(value);
+}
+
+void TokenStream::setIsComplete(bool isComplete) { isComplete_ = isComplete; }
+
+}  // namespace hsql
@@ -0,0 +1,57 @@
+#ifndef SQLPARSER_TOKEN_STREAM_H
+#define SQLPARSER_TOKEN_STREAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace hsql {
+
+// Decoded value of an integer (SQL_INTVAL) or float (SQL_FLOATVAL) literal.
+union TokenValue {
+  int64_t ival;
+  double fval;
+};
+
+// Tokens of a query as parallel arrays: the token kind (the bison token code, e.g.
+// SQL_SELECT or ';'), the byte range of the token in the query and the value of numeric
+// literals. Identifiers and strings are not copied, their text is the range in the query,
+// including the quotes of quoted identifiers and string literals.
+// Reuse a stream across calls to tokenize() to avoid allocations.
+class TokenStream {
+ public:
+  TokenStream();
+
+  // Number of tokens.
+  size_t size() const;
+
+  const std::vector<int16_t>& kinds() const;
+  const std::vector<uint32_t>& offsets() const;
+  const std::vector<uint32_t>& lengths() const;
+
+  // Values of numeric literals. Zero for all other tokens.
+  const std::vector<TokenValue>& values() const;
+
+  // Returns false if the lexer stopped at an invalid character, an unterminated string or an
+  // integer that does not fit into 64 bits. The stream then contains the tokens in front of it.
+  bool isComplete() const;
+
+  // Removes all tokens, but keeps the allocated memory.
+  void clear();
+
+  // Appends a token.
+  void add(int16_t kind, uint32_t offset, uint32_t length, TokenValue value);
+
+  void setIsComplete(bool isComplete);
+
+ private:
+  std::vector<int16_t> kinds_;
+  std::vector<uint32_t> offsets_;
+  std::vector<uint32_t> lengths_;
+  std::vector<TokenValue> values_;
+  bool isComplete_;
+};
+
+}  // namespace hsql
+
+#endif
@@ -64,20 +64,20 @@
 #define YYPULL 1
 
 /* Substitute the type names.  */
-#define YYSTYPE HSQL_STYPE
-#define YYLTYPE HSQL_LTYPE
+#define YYSTYPE         HSQL_STYPE
+#define YYLTYPE         HSQL_LTYPE
 /* Substitute the variable and function names.  */
-#define yyparse hsql_parse
-#define yylex hsql_lex
-#define yyerror hsql_error
-#define yydebug hsql_debug
-#define yynerrs hsql_nerrs
+#define yyparse         hsql_parse
+#define yylex           hsql_lex
+#define yyerror         hsql_error
+#define yydebug         hsql_debug
+#define yynerrs         hsql_nerrs
 
 /* First part of user prologue.  */
 #line 2 "bison_parser.y"
 
-// clang-format on
-/**
+  // clang-format on
+  /**
  * bison_parser.y
  * defines bison_parser.h
  * outputs bison_parser.c
@@ -85,7 +85,7 @@
  * Grammar File Spec: http://dinosaur.compilertools.net/bison/bison_6.html
  *
  */
-/*********************************
+  /*********************************
  ** Section 1: C Declarations
  *********************************/
 
@@ -94,17 +94,50 @@
 
 #include <stdio.h>
 #include <string.h>
+#include "../util/LineIndex.h"
+#include "simd_lexer.h"
 
-using namespace hsql;
+  using namespace hsql;
 
-int yyerror(YYLTYPE* llocp, SQLParserResult* result, yyscan_t scanner, const char* msg) {
-  result->setIsValid(false);
-  result->setErrorDetails(strdup(msg), llocp->first_line, llocp->first_column);
-  return 0;
-}
-// clang-format off
+// State of the current parse that is shared with the lexer, see parser_typedef.h.
+#define PARSE_STATE (static_cast<ParseState*>(hsql_get_extra(scanner)))
 
-#line 108 "bison_parser.cpp"
+  int yyerror(YYLTYPE * llocp, SQLParserResult * result, yyscan_t scanner, const char* msg) {
+    result->setIsValid(false);
+    // Line and column are only computed for the error, from the offsets of the preceding input.
+    const LineIndex lines(PARSE_STATE->input, llocp->first_offset);
+    result->setErrorDetails(strdup(msg), lines.line(llocp->first_offset), lines.column(llocp->first_offset));
+    return 0;
+  }
+
+  // Tokens are read from the hand-written lexer if the parse uses one (see ParserContext::setLexer).
+  static int hsql_next_token(YYSTYPE * lvalp, YYLTYPE * llocp, yyscan_t scanner) {
+    SimdLexer* lexer = PARSE_STATE->lexer;
+    return lexer != nullptr ? lexer->next(lvalp, llocp) : hsql_lex(lvalp, llocp, scanner);
+  }
+#undef yylex
+#define yylex hsql_next_token
+
+  // Frees the rows of a multi-row VALUES list, e.g. after an error.
+  static void deleteValuesList(ValuesList * rows) {
+    if (rows != nullptr && Arena::current() == nullptr) rows->deleteExpressions();
+    arenaDelete(rows);
+  }
+
+  // Returns a binary AND / OR node, or a flat one (see ParserContext::setFlattenLogicalOperators).
+  static Expr* makeLogicalOperator(Expr * expr1, OperatorType op, Expr * expr2, bool flatten) {
+    return flatten ? Expr::makeOpNary(expr1, op, expr2) : Expr::makeOpBinary(expr1, op, expr2);
+  }
+
+  // Returns true if the string of a date literal has the format YYYY-MM-DD.
+  static bool isValidDate(const char* date) {
+    int day{0}, month{0}, year{0}, chars_parsed{0};
+    // If the whole string is parsed, chars_parsed points to the terminating null byte after the last character
+    return sscanf(date, "%4d-%2d-%2d%n", &day, &month, &year, &chars_parsed) == 3 && date[chars_parsed] == 0;
+  }
+  // clang-format off
+
+#line 141 "bison_parser.cpp"
 
 # ifndef YY_CAST
 #  ifdef __cplusplus
@@ -352,86 +385,90 @@ enum yysymbol_kind_t
   YYSYMBOL_truncate_statement = 217,       /* truncate_statement  */
   YYSYMBOL_insert_statement = 218,         /* insert_statement  */
   YYSYMBOL_opt_column_list = 219,          /* opt_column_list  */
-  YYSYMBOL_update_statement = 220,         /* update_statement  */
-  YYSYMBOL_update_clause_commalist = 221,  /* update_clause_commalist  */
-  YYSYMBOL_update_clause = 222,            /* update_clause  */
-  YYSYMBOL_select_statement = 223,         /* select_statement  */
-  YYSYMBOL_select_within_set_operation = 224, /* select_within_set_operation  */
-  YYSYMBOL_select_within_set_operation_no_parentheses = 225, /* select_within_set_operation_no_parentheses  */
-  YYSYMBOL_select_with_paren = 226,        /* select_with_paren  */
-  YYSYMBOL_select_no_paren = 227,          /* select_no_paren  */
-  YYSYMBOL_set_operator = 228,             /* set_operator  */
-  YYSYMBOL_set_type = 229,                 /* set_type  */
-  YYSYMBOL_opt_all = 230,                  /* opt_all  */
-  YYSYMBOL_select_clause = 231,            /* select_clause  */
-  YYSYMBOL_opt_distinct = 232,             /* opt_distinct  */
-  YYSYMBOL_select_list = 233,              /* select_list  */
-  YYSYMBOL_opt_from_clause = 234,          /* opt_from_clause  */
-  YYSYMBOL_from_clause = 235,              /* from_clause  */
-  YYSYMBOL_opt_where = 236,                /* opt_where  */
-  YYSYMBOL_opt_group = 237,                /* opt_group  */
-  YYSYMBOL_opt_having = 238,               /* opt_having  */
-  YYSYMBOL_opt_order = 239,                /* opt_order  */
-  YYSYMBOL_order_list = 240,               /* order_list  */
-  YYSYMBOL_order_desc = 241,               /* order_desc  */
-  YYSYMBOL_opt_order_type = 242,           /* opt_order_type  */
-  YYSYMBOL_opt_top = 243,                  /* opt_top  */
-  YYSYMBOL_opt_limit = 244,                /* opt_limit  */
-  YYSYMBOL_expr_list = 245,                /* expr_list  */
-  YYSYMBOL_opt_literal_list = 246,         /* opt_literal_list  */
-  YYSYMBOL_literal_list = 247,             /* literal_list  */
-  YYSYMBOL_expr_alias = 248,               /* expr_alias  */
-  YYSYMBOL_expr = 249,                     /* expr  */
-  YYSYMBOL_operand = 250,                  /* operand  */
-  YYSYMBOL_scalar_expr = 251,              /* scalar_expr  */
-  YYSYMBOL_unary_expr = 252,               /* unary_expr  */
-  YYSYMBOL_binary_expr = 253,              /* binary_expr  */
-  YYSYMBOL_logic_expr = 254,               /* logic_expr  */
-  YYSYMBOL_in_expr = 255,                  /* in_expr  */
-  YYSYMBOL_case_expr = 256,                /* case_expr  */
-  YYSYMBOL_case_list = 257,                /* case_list  */
-  YYSYMBOL_exists_expr = 258,              /* exists_expr  */
-  YYSYMBOL_comp_expr = 259,                /* comp_expr  */
-  YYSYMBOL_function_expr = 260,            /* function_expr  */
-  YYSYMBOL_extract_expr = 261,             /* extract_expr  */
-  YYSYMBOL_cast_expr = 262,                /* cast_expr  */
-  YYSYMBOL_datetime_field = 263,           /* datetime_field  */
-  YYSYMBOL_datetime_field_plural = 264,    /* datetime_field_plural  */
-  YYSYMBOL_duration_field = 265,           /* duration_field  */
-  YYSYMBOL_array_expr = 266,               /* array_expr  */
-  YYSYMBOL_array_index = 267,              /* array_index  */
-  YYSYMBOL_between_expr = 268,             /* between_expr  */
-  YYSYMBOL_column_name = 269,              /* column_name  */
-  YYSYMBOL_literal = 270,                  /* literal  */
-  YYSYMBOL_string_literal = 271,           /* string_literal  */
-  YYSYMBOL_bool_literal = 272,             /* bool_literal  */
-  YYSYMBOL_num_literal = 273,              /* num_literal  */
-  YYSYMBOL_int_literal = 274,              /* int_literal  */
-  YYSYMBOL_null_literal = 275,             /* null_literal  */
-  YYSYMBOL_date_literal = 276,             /* date_literal  */
-  YYSYMBOL_interval_literal = 277,         /* interval_literal  */
-  YYSYMBOL_param_expr = 278,               /* param_expr  */
-  YYSYMBOL_table_ref = 279,                /* table_ref  */
-  YYSYMBOL_table_ref_atomic = 280,         /* table_ref_atomic  */
-  YYSYMBOL_nonjoin_table_ref_atomic = 281, /* nonjoin_table_ref_atomic  */
-  YYSYMBOL_table_ref_commalist = 282,      /* table_ref_commalist  */
-  YYSYMBOL_table_ref_name = 283,           /* table_ref_name  */
-  YYSYMBOL_table_ref_name_no_alias = 284,  /* table_ref_name_no_alias  */
-  YYSYMBOL_table_name = 285,               /* table_name  */
-  YYSYMBOL_opt_index_name = 286,           /* opt_index_name  */
-  YYSYMBOL_table_alias = 287,              /* table_alias  */
-  YYSYMBOL_opt_table_alias = 288,          /* opt_table_alias  */
-  YYSYMBOL_alias = 289,                    /* alias  */
-  YYSYMBOL_opt_alias = 290,                /* opt_alias  */
-  YYSYMBOL_opt_with_clause = 291,          /* opt_with_clause  */
-  YYSYMBOL_with_clause = 292,              /* with_clause  */
-  YYSYMBOL_with_description_list = 293,    /* with_description_list  */
-  YYSYMBOL_with_description = 294,         /* with_description  */
-  YYSYMBOL_join_clause = 295,              /* join_clause  */
-  YYSYMBOL_opt_join_type = 296,            /* opt_join_type  */
-  YYSYMBOL_join_condition = 297,           /* join_condition  */
-  YYSYMBOL_opt_semicolon = 298,            /* opt_semicolon  */
-  YYSYMBOL_ident_commalist = 299           /* ident_commalist  */
+  YYSYMBOL_values_list = 220,              /* values_list  */
+  YYSYMBOL_values_rows = 221,              /* values_rows  */
+  YYSYMBOL_values_row_begin = 222,         /* values_row_begin  */
+  YYSYMBOL_values_cell = 223,              /* values_cell  */
+  YYSYMBOL_update_statement = 224,         /* update_statement  */
+  YYSYMBOL_update_clause_commalist = 225,  /* update_clause_commalist  */
+  YYSYMBOL_update_clause = 226,            /* update_clause  */
+  YYSYMBOL_select_statement = 227,         /* select_statement  */
+  YYSYMBOL_select_within_set_operation = 228, /* select_within_set_operation  */
+  YYSYMBOL_select_within_set_operation_no_parentheses = 229, /* select_within_set_operation_no_parentheses  */
+  YYSYMBOL_select_with_paren = 230,        /* select_with_paren  */
+  YYSYMBOL_select_no_paren = 231,          /* select_no_paren  */
+  YYSYMBOL_set_operator = 232,             /* set_operator  */
+  YYSYMBOL_set_type = 233,                 /* set_type  */
+  YYSYMBOL_opt_all = 234,                  /* opt_all  */
+  YYSYMBOL_select_clause = 235,            /* select_clause  */
+  YYSYMBOL_opt_distinct = 236,             /* opt_distinct  */
+  YYSYMBOL_select_list = 237,              /* select_list  */
+  YYSYMBOL_opt_from_clause = 238,          /* opt_from_clause  */
+  YYSYMBOL_from_clause = 239,              /* from_clause  */
+  YYSYMBOL_opt_where = 240,                /* opt_where  */
+  YYSYMBOL_opt_group = 241,                /* opt_group  */
+  YYSYMBOL_opt_having = 242,               /* opt_having  */
+  YYSYMBOL_opt_order = 243,                /* opt_order  */
+  YYSYMBOL_order_list = 244,               /* order_list  */
+  YYSYMBOL_order_desc = 245,               /* order_desc  */
+  YYSYMBOL_opt_order_type = 246,           /* opt_order_type  */
+  YYSYMBOL_opt_top = 247,                  /* opt_top  */
+  YYSYMBOL_opt_limit = 248,                /* opt_limit  */
+  YYSYMBOL_expr_list = 249,                /* expr_list  */
+  YYSYMBOL_opt_literal_list = 250,         /* opt_literal_list  */
+  YYSYMBOL_literal_list = 251,             /* literal_list  */
+  YYSYMBOL_expr_alias = 252,               /* expr_alias  */
+  YYSYMBOL_expr = 253,                     /* expr  */
+  YYSYMBOL_operand = 254,                  /* operand  */
+  YYSYMBOL_scalar_expr = 255,              /* scalar_expr  */
+  YYSYMBOL_unary_expr = 256,               /* unary_expr  */
+  YYSYMBOL_binary_expr = 257,              /* binary_expr  */
+  YYSYMBOL_logic_expr = 258,               /* logic_expr  */
+  YYSYMBOL_in_expr = 259,                  /* in_expr  */
+  YYSYMBOL_case_expr = 260,                /* case_expr  */
+  YYSYMBOL_case_list = 261,                /* case_list  */
+  YYSYMBOL_exists_expr = 262,              /* exists_expr  */
+  YYSYMBOL_comp_expr = 263,                /* comp_expr  */
+  YYSYMBOL_function_expr = 264,            /* function_expr  */
+  YYSYMBOL_extract_expr = 265,             /* extract_expr  */
+  YYSYMBOL_cast_expr = 266,                /* cast_expr  */
+  YYSYMBOL_datetime_field = 267,           /* datetime_field  */
+  YYSYMBOL_datetime_field_plural = 268,    /* datetime_field_plural  */
+  YYSYMBOL_duration_field = 269,           /* duration_field  */
+  YYSYMBOL_array_expr = 270,               /* array_expr  */
+  YYSYMBOL_array_index = 271,              /* array_index  */
+  YYSYMBOL_between_expr = 272,             /* between_expr  */
+  YYSYMBOL_column_name = 273,              /* column_name  */
+  YYSYMBOL_literal = 274,                  /* literal  */
+  YYSYMBOL_string_literal = 275,           /* string_literal  */
+  YYSYMBOL_bool_literal = 276,             /* bool_literal  */
+  YYSYMBOL_num_literal = 277,              /* num_literal  */
+  YYSYMBOL_int_literal = 278,              /* int_literal  */
+  YYSYMBOL_null_literal = 279,             /* null_literal  */
+  YYSYMBOL_date_literal = 280,             /* date_literal  */
+  YYSYMBOL_interval_literal = 281,         /* interval_literal  */
+  YYSYMBOL_param_expr = 282,               /* param_expr  */
+  YYSYMBOL_table_ref = 283,                /* table_ref  */
+  YYSYMBOL_table_ref_atomic = 284,         /* table_ref_atomic  */
+  YYSYMBOL_nonjoin_table_ref_atomic = 285, /* nonjoin_table_ref_atomic  */
+  YYSYMBOL_table_ref_commalist = 286,      /* table_ref_commalist  */
+  YYSYMBOL_table_ref_name = 287,           /* table_ref_name  */
+  YYSYMBOL_table_ref_name_no_alias = 288,  /* table_ref_name_no_alias  */
+  YYSYMBOL_table_name = 289,               /* table_name  */
+  YYSYMBOL_opt_index_name = 290,           /* opt_index_name  */
+  YYSYMBOL_table_alias = 291,              /* table_alias  */
+  YYSYMBOL_opt_table_alias = 292,          /* opt_table_alias  */
+  YYSYMBOL_alias = 293,                    /* alias  */
+  YYSYMBOL_opt_alias = 294,                /* opt_alias  */
+  YYSYMBOL_opt_with_clause = 295,          /* opt_with_clause  */
+  YYSYMBOL_with_clause = 296,              /* with_clause  */
+  YYSYMBOL_with_description_list = 297,    /* with_description_list  */
+  YYSYMBOL_with_description = 298,         /* with_description  */
+  YYSYMBOL_join_clause = 299,              /* join_clause  */
+  YYSYMBOL_opt_join_type = 300,            /* opt_join_type  */
+  YYSYMBOL_join_condition = 301,           /* join_condition  */
+  YYSYMBOL_opt_semicolon = 302,            /* opt_semicolon  */
+  YYSYMBOL_ident_commalist = 303           /* ident_commalist  */
 };
 typedef enum yysymbol_kind_t yysymbol_kind_t;
 
@@ -762,16 +799,16 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  67
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   899
+#define YYLAST   910
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  180
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  120
+#define YYNNTS  124
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  303
+#define YYNRULES  318
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  549
+#define YYNSTATES  571
 
 /* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   417
@@ -836,37 +873,38 @@ static const yytype_uint8 yytranslate[] =
 /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,   294,   294,   313,   319,   326,   330,   334,   335,   336,
-     338,   339,   340,   341,   342,   343,   344,   345,   346,   347,
-     353,   354,   356,   360,   365,   369,   379,   380,   381,   383,
-     383,   389,   395,   397,   401,   412,   418,   425,   440,   445,
-     446,   452,   464,   465,   470,   481,   494,   502,   509,   516,
-     525,   526,   528,   532,   537,   538,   540,   545,   546,   547,
-     548,   549,   550,   554,   555,   556,   557,   558,   559,   560,
-     561,   562,   564,   565,   567,   568,   569,   571,   572,   574,
-     578,   583,   584,   585,   586,   588,   589,   597,   603,   609,
-     615,   621,   622,   629,   635,   637,   647,   654,   665,   672,
-     680,   681,   688,   695,   699,   704,   714,   718,   722,   734,
-     734,   736,   737,   746,   747,   749,   759,   770,   775,   779,
-     783,   788,   789,   791,   801,   802,   804,   806,   807,   809,
-     811,   812,   814,   819,   821,   822,   824,   825,   827,   831,
-     836,   838,   839,   840,   844,   845,   847,   848,   849,   850,
-     851,   852,   857,   861,   866,   867,   869,   873,   878,   886,
-     886,   886,   886,   886,   888,   889,   889,   889,   889,   889,
-     889,   889,   889,   890,   890,   894,   894,   896,   897,   898,
-     899,   900,   902,   902,   903,   904,   905,   906,   907,   908,
-     909,   910,   911,   913,   914,   916,   917,   918,   919,   923,
-     924,   925,   926,   928,   929,   931,   932,   934,   935,   936,
-     937,   938,   939,   940,   942,   943,   945,   947,   949,   950,
-     951,   952,   953,   954,   956,   957,   958,   959,   960,   961,
-     963,   963,   965,   967,   969,   971,   972,   973,   974,   976,
-     976,   976,   976,   976,   976,   976,   978,   980,   981,   983,
-     984,   986,   988,   990,  1001,  1005,  1016,  1048,  1057,  1057,
-    1064,  1064,  1066,  1066,  1073,  1077,  1082,  1090,  1096,  1100,
-    1105,  1106,  1108,  1108,  1110,  1110,  1112,  1113,  1115,  1115,
-    1121,  1121,  1123,  1125,  1129,  1134,  1144,  1151,  1159,  1175,
-    1176,  1177,  1178,  1179,  1180,  1181,  1182,  1183,  1184,  1186,
-    1192,  1192,  1195,  1199
+       0,   345,   345,   362,   368,   375,   379,   383,   384,   385,
+     387,   388,   389,   390,   391,   392,   393,   394,   395,   396,
+     402,   403,   405,   409,   414,   418,   428,   429,   430,   432,
+     432,   438,   444,   446,   450,   461,   467,   474,   489,   494,
+     495,   501,   513,   514,   519,   530,   543,   551,   558,   565,
+     574,   575,   577,   581,   586,   587,   589,   594,   595,   596,
+     597,   598,   599,   603,   604,   605,   606,   607,   608,   609,
+     610,   611,   613,   614,   616,   617,   618,   620,   621,   623,
+     627,   632,   633,   634,   635,   637,   638,   646,   652,   658,
+     664,   670,   671,   678,   684,   686,   696,   703,   714,   721,
+     728,   736,   737,   740,   749,   754,   763,   768,   777,   782,
+     787,   792,   797,   802,   806,   816,   821,   832,   839,   843,
+     848,   858,   862,   866,   878,   878,   880,   881,   890,   891,
+     893,   903,   914,   919,   923,   927,   932,   933,   935,   945,
+     946,   948,   950,   951,   953,   955,   956,   958,   963,   965,
+     966,   968,   969,   971,   975,   980,   982,   983,   984,   988,
+     989,   991,   992,   993,   994,   995,   996,  1001,  1005,  1010,
+    1011,  1013,  1017,  1022,  1030,  1030,  1030,  1030,  1030,  1032,
+    1033,  1033,  1033,  1033,  1033,  1033,  1033,  1033,  1034,  1034,
+    1038,  1038,  1040,  1041,  1042,  1043,  1044,  1046,  1046,  1047,
+    1048,  1049,  1050,  1051,  1052,  1053,  1054,  1055,  1057,  1058,
+    1060,  1061,  1062,  1063,  1067,  1068,  1069,  1070,  1072,  1073,
+    1075,  1076,  1078,  1079,  1080,  1081,  1082,  1083,  1084,  1086,
+    1087,  1089,  1091,  1093,  1094,  1095,  1096,  1097,  1098,  1100,
+    1101,  1102,  1103,  1104,  1105,  1107,  1107,  1109,  1111,  1116,
+    1118,  1119,  1120,  1121,  1123,  1123,  1123,  1123,  1123,  1123,
+    1123,  1125,  1127,  1128,  1130,  1131,  1133,  1135,  1137,  1146,
+    1150,  1161,  1193,  1202,  1202,  1209,  1209,  1211,  1211,  1218,
+    1222,  1227,  1235,  1241,  1245,  1250,  1251,  1253,  1253,  1255,
+    1255,  1257,  1258,  1260,  1260,  1266,  1266,  1268,  1270,  1274,
+    1279,  1289,  1296,  1304,  1320,  1321,  1322,  1323,  1324,  1325,
+    1326,  1327,  1328,  1329,  1331,  1337,  1337,  1340,  1344
 };
 #endif
 
@@ -917,7 +955,8 @@ static const char *const yytname[] =
   "opt_column_constraints", "column_constraint_list", "column_constraint",
   "table_constraint", "drop_statement", "opt_exists", "alter_statement",
   "alter_action", "drop_action", "delete_statement", "truncate_statement",
-  "insert_statement", "opt_column_list", "update_statement",
+  "insert_statement", "opt_column_list", "values_list", "values_rows",
+  "values_row_begin", "values_cell", "update_statement",
   "update_clause_commalist", "update_clause", "select_statement",
   "select_within_set_operation",
   "select_within_set_operation_no_parentheses", "select_with_paren",
@@ -948,12 +987,12 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 }
 #endif
 
-#define YYPACT_NINF (-410)
+#define YYPACT_NINF (-333)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF (-301)
+#define YYTABLE_NINF (-316)
 
 #define yytable_value_is_error(Yyn) \
   ((Yyn) == YYTABLE_NINF)
@@ -962,61 +1001,64 @@ yysymbol_name (yysymbol_kind_t yysymbol)
    STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-     579,    31,    44,   117,   138,    44,   -26,    70,    74,    76,
-      44,   116,    44,   -14,    19,   203,    78,    78,    78,   241,
-      84,  -410,   140,  -410,   140,  -410,  -410,  -410,  -410,  -410,
-    -410,  -410,  -410,  -410,  -410,  -410,  -410,   -23,  -410,   244,
-      77,  -410,    91,   196,  -410,   146,   146,   146,    44,   287,
-      44,   180,  -410,   185,   -57,   185,   185,   185,    44,  -410,
-     182,   134,  -410,  -410,  -410,  -410,  -410,  -410,   548,  -410,
-     220,  -410,  -410,   194,   -23,   204,  -410,   166,  -410,   320,
-      37,   323,   218,   337,    44,    44,   267,  -410,   266,   186,
-     363,   322,    44,   364,   364,   373,    44,    44,  -410,   222,
-     203,  -410,   225,   371,   380,   208,   219,  -410,  -410,  -410,
-     -23,   288,   277,   -23,    80,  -410,  -410,  -410,  -410,   400,
-    -410,   403,  -410,  -410,  -410,   233,   235,  -410,  -410,  -410,
-    -410,   714,  -410,  -410,  -410,  -410,  -410,  -410,   369,  -410,
-     285,   -48,   186,   316,  -410,   364,   413,   105,   265,   -51,
-    -410,  -410,   332,   312,  -410,   312,  -410,  -410,  -410,  -410,
-    -410,   421,  -410,  -410,   316,  -410,  -410,   349,  -410,  -410,
-     204,  -410,  -410,   316,   349,   316,   125,  -410,  -410,   375,
-    -410,    37,  -410,  -410,  -410,  -410,  -410,  -410,  -410,  -410,
-    -410,  -410,  -410,  -410,  -410,  -410,  -410,  -410,    44,   423,
-     318,    34,   306,  -106,   259,   261,   263,   176,   325,   268,
-     385,  -410,   231,    93,   410,  -410,  -410,  -410,  -410,  -410,
-    -410,  -410,  -410,  -410,  -410,  -410,  -410,  -410,  -410,  -410,
-    -410,   341,  -410,    27,   269,  -410,   316,   363,  -410,   404,
-    -410,  -410,   393,  -410,  -410,   270,    39,  -410,   353,   272,
-    -410,    24,    80,   -23,   273,  -410,   -43,    80,    93,   394,
-      28,  -410,  -410,   278,   355,  -410,   781,   335,   281,    65,
-    -410,  -410,  -410,   318,     9,    21,   399,   375,   316,   316,
-      43,   109,   283,   385,   607,   316,    99,   284,   -52,   316,
-     316,   385,  -410,   385,   -46,   286,   136,   385,   385,   385,
-     385,   385,   385,   385,   385,   385,   385,   385,   385,   385,
-     385,   385,   371,    44,  -410,   458,    37,    93,  -410,   185,
-     287,    37,  -410,   421,    20,   267,  -410,   316,  -410,   459,
-    -410,  -410,  -410,  -410,   316,  -410,  -410,  -410,  -410,   316,
-     316,   413,   364,  -410,   293,  -410,   294,  -410,   297,  -410,
-    -410,   302,  -410,  -410,  -410,  -410,   303,  -410,    98,   304,
-     413,  -410,    34,  -410,  -410,   316,  -410,  -410,   305,   386,
-     -65,    47,   171,   316,   316,  -410,   399,   381,    26,  -410,
-    -410,  -410,   370,   554,   625,   385,   311,   231,  -410,   383,
-     315,   625,   625,   625,   625,   675,   675,   675,   675,    99,
-      99,   -83,   -83,   -83,   -71,   321,  -410,  -410,   119,   486,
-    -410,   123,  -410,   318,  -410,    66,  -410,   319,  -410,    25,
-    -410,   424,  -410,  -410,  -410,    93,    93,   157,  -410,   490,
-     492,  -410,   494,   495,   496,  -410,   384,  -410,  -410,   405,
-    -410,    98,  -410,   413,   158,  -410,   169,  -410,   316,   781,
-     316,   316,  -410,   179,   101,   331,  -410,   385,   625,   231,
-     334,   170,  -410,  -410,  -410,  -410,  -410,   342,   409,  -410,
-    -410,  -410,   442,   443,   444,   425,    20,   519,  -410,  -410,
-    -410,   401,  -410,  -410,   350,   181,   352,   354,   356,  -410,
-    -410,  -410,   200,  -410,  -410,    52,   357,    93,   223,  -410,
-     316,  -410,   607,   361,   207,  -410,  -410,    25,    20,  -410,
-    -410,  -410,    20,   275,   365,   316,  -410,  -410,   518,  -410,
-    -410,  -410,  -410,  -410,  -410,  -410,    93,  -410,  -410,  -410,
-    -410,   340,   413,   -28,   366,   368,   316,   209,   316,  -410,
-    -410,    22,    93,  -410,  -410,    93,   367,   372,  -410
+     590,    33,    43,    57,    78,    43,    98,    35,    39,   138,
+      43,   143,    43,   110,    24,   172,   102,   102,   102,   262,
+      92,  -333,   201,  -333,   201,  -333,  -333,  -333,  -333,  -333,
+    -333,  -333,  -333,  -333,  -333,  -333,  -333,   -16,  -333,   326,
+     154,  -333,   157,   243,  -333,   215,   215,   215,    43,   340,
+      43,   241,  -333,   238,   -41,   238,   238,   238,    43,  -333,
+     246,   213,  -333,  -333,  -333,  -333,  -333,  -333,   585,  -333,
+     291,  -333,  -333,   269,   -16,    42,  -333,    94,  -333,   392,
+      62,   397,   276,   405,    43,    43,   328,  -333,   319,   239,
+     409,   369,    43,   412,   412,   415,    43,    43,  -333,   245,
+     172,  -333,   249,   418,   416,   256,   257,  -333,  -333,  -333,
+     -16,   317,   308,   -16,     1,  -333,  -333,  -333,  -333,   439,
+    -333,   440,  -333,  -333,  -333,   270,   268,  -333,  -333,  -333,
+    -333,   209,  -333,  -333,  -333,  -333,  -333,  -333,   402,  -333,
+     318,   -48,   239,   322,  -333,   412,   446,   116,   296,   -54,
+    -333,  -333,   360,   341,  -333,   341,  -333,  -333,  -333,  -333,
+    -333,   453,  -333,  -333,   322,  -333,  -333,   381,  -333,  -333,
+      42,  -333,  -333,   322,   381,   322,   137,  -333,  -333,   158,
+    -333,    62,  -333,  -333,  -333,  -333,  -333,  -333,  -333,  -333,
+    -333,  -333,  -333,  -333,  -333,  -333,  -333,  -333,    43,   455,
+     348,   145,   336,   108,   288,   289,   294,   255,   394,   293,
+     380,  -333,   287,    20,   421,  -333,  -333,  -333,  -333,  -333,
+    -333,  -333,  -333,  -333,  -333,  -333,  -333,  -333,  -333,  -333,
+    -333,   372,  -333,  -131,   301,  -333,   322,   409,  -333,   438,
+    -333,  -333,   429,  -333,  -333,   305,    73,  -333,   387,   304,
+    -333,    31,     1,   -16,   306,  -333,   -36,     1,    20,   431,
+     -12,  -333,  -333,   312,   395,  -333,   792,   371,   320,    96,
+    -333,  -333,  -333,   348,    12,    18,   434,   158,   322,   322,
+      50,   126,   321,   380,   600,   322,   109,   323,   -74,   322,
+     322,   380,  -333,   380,   -38,   325,    56,   380,   380,   380,
+     380,   380,   380,   380,   380,   380,   380,   380,   380,   380,
+     380,   380,   418,    43,  -333,   489,    62,  -333,    97,    66,
+      20,  -333,   238,   340,    62,  -333,   453,    17,   328,  -333,
+     322,  -333,   490,  -333,  -333,  -333,  -333,   322,  -333,  -333,
+    -333,  -333,   322,   322,   446,   412,  -333,   329,  -333,   330,
+    -333,   331,  -333,  -333,   332,  -333,  -333,  -333,  -333,   333,
+    -333,    34,   334,   446,  -333,   145,  -333,  -333,   322,  -333,
+    -333,   327,   417,    47,   -51,   136,   322,   322,  -333,   434,
+     411,    45,  -333,  -333,  -333,   398,   549,   626,   380,   335,
+     287,  -333,   413,   343,   626,   626,   626,   626,   645,   645,
+     645,   645,   109,   109,   -95,   -95,   -95,   -85,   344,  -333,
+    -333,   130,   342,    66,  -333,  -333,   132,   514,  -333,  -333,
+    -333,  -333,   209,  -333,  -333,   516,  -333,   140,  -333,   348,
+    -333,   131,  -333,   345,  -333,    28,  -333,   456,  -333,  -333,
+    -333,    20,    20,   144,  -333,   518,   520,  -333,   525,   526,
+     527,  -333,   403,  -333,  -333,   432,  -333,    34,  -333,   446,
+     160,  -333,   162,  -333,   322,   792,   322,   322,  -333,   133,
+     125,   359,  -333,   380,   626,   287,   361,   182,  -333,  -333,
+     362,   363,  -333,  -333,  -333,  -333,   364,   447,  -333,  -333,
+    -333,   461,   473,   474,   454,    17,   550,  -333,  -333,  -333,
+     433,  -333,  -333,   382,   184,   388,   389,   390,  -333,  -333,
+    -333,   202,  -333,  -333,    13,   391,    20,   152,  -333,   322,
+    -333,   600,   396,   203,  -333,  -333,   393,  -333,    28,    17,
+    -333,  -333,  -333,    17,   295,   400,   322,  -333,  -333,   556,
+    -333,  -333,  -333,  -333,  -333,  -333,  -333,    20,  -333,  -333,
+    -333,  -333,  -333,   557,   446,   -21,   406,   401,   322,   204,
+     322,  -333,  -333,    19,    20,  -333,  -333,    20,   419,   423,
+    -333
 };
 
 /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -1024,78 +1066,82 @@ static const yytype_int16 yypact[] =
    means the default is an error.  */
 static const yytype_int16 yydefact[] =
 {
-     281,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     296,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,    30,    30,    30,     0,
-     301,     3,    21,    19,    21,    18,     8,     9,     7,    11,
-      16,    17,    13,    14,    12,    15,    10,     0,   280,     0,
-     268,    97,    33,     0,    44,    51,    51,    51,     0,     0,
-       0,     0,   267,    92,     0,    92,    92,    92,     0,    42,
-       0,   282,   283,    29,    26,    28,    27,     1,   281,     2,
-       0,     6,     5,   145,     0,   106,   107,   137,    89,     0,
-     155,     0,     0,   271,     0,     0,   131,    37,     0,   101,
+     316,     3,    21,    19,    21,    18,     8,     9,     7,    11,
+      16,    17,    13,    14,    12,    15,    10,     0,   295,     0,
+     283,    97,    33,     0,    44,    51,    51,    51,     0,     0,
+       0,     0,   282,    92,     0,    92,    92,    92,     0,    42,
+       0,   297,   298,    29,    26,    28,    27,     1,   296,     2,
+       0,     6,     5,   160,     0,   121,   122,   152,    89,     0,
+     170,     0,     0,   286,     0,     0,   146,    37,     0,   102,
        0,     0,     0,     0,     0,     0,     0,     0,    43,     0,
-       0,     4,     0,     0,   125,     0,     0,   119,   120,   118,
-       0,   122,     0,     0,   151,   269,   246,   249,   251,     0,
-     252,     0,   247,   248,   257,     0,   154,   156,   239,   240,
-     241,   250,   242,   243,   244,   245,    32,    31,     0,   270,
-       0,     0,   101,     0,    96,     0,     0,     0,     0,   131,
-     103,    91,     0,    40,    38,    40,    90,    87,    88,   285,
-     284,     0,   144,   124,     0,   114,   113,   137,   110,   109,
-     111,   121,   117,     0,   137,     0,     0,   115,   253,   256,
-      34,     0,   218,   219,   220,   221,   222,   223,   224,   225,
-     226,   227,   228,   229,   230,   231,   254,    50,     0,     0,
-     281,     0,     0,   235,     0,     0,     0,     0,     0,     0,
-       0,   237,     0,   130,   159,   166,   167,   168,   161,   163,
-     169,   162,   182,   170,   171,   172,   173,   165,   160,   175,
-     176,     0,   302,     0,     0,    99,     0,     0,   102,     0,
-      93,    94,     0,    36,    41,    24,     0,    22,   128,   126,
-     152,   279,   151,     0,   136,   138,   143,   151,   147,   149,
-     146,   255,   157,     0,     0,    47,     0,     0,     0,     0,
-      52,    54,    55,   281,   125,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   178,     0,   177,     0,     0,     0,
-       0,     0,   179,     0,     0,     0,     0,     0,     0,     0,
+       0,     4,     0,     0,   140,     0,     0,   134,   135,   133,
+       0,   137,     0,     0,   166,   284,   261,   264,   266,     0,
+     267,     0,   262,   263,   272,     0,   169,   171,   254,   255,
+     256,   265,   257,   258,   259,   260,    32,    31,     0,   285,
+       0,     0,   102,     0,    96,     0,     0,     0,     0,   146,
+     118,    91,     0,    40,    38,    40,    90,    87,    88,   300,
+     299,     0,   159,   139,     0,   129,   128,   152,   125,   124,
+     126,   136,   132,     0,   152,     0,     0,   130,   268,   271,
+      34,     0,   233,   234,   235,   236,   237,   238,   239,   240,
+     241,   242,   243,   244,   245,   246,   269,    50,     0,     0,
+     296,     0,     0,   250,     0,     0,     0,     0,     0,     0,
+       0,   252,     0,   145,   174,   181,   182,   183,   176,   178,
+     184,   177,   197,   185,   186,   187,   188,   180,   175,   190,
+     191,     0,   317,     0,     0,   100,     0,     0,   117,     0,
+      93,    94,     0,    36,    41,    24,     0,    22,   143,   141,
+     167,   294,   166,     0,   151,   153,   158,   166,   162,   164,
+     161,   270,   172,     0,     0,    47,     0,     0,     0,     0,
+      52,    54,    55,   296,   140,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   193,     0,   192,     0,     0,     0,
+       0,     0,   194,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   100,     0,     0,   105,   104,    92,
-       0,     0,    20,     0,     0,   131,   127,     0,   277,     0,
-     278,   158,   108,   112,     0,   142,   141,   140,   116,     0,
-       0,     0,     0,    65,     0,    67,    76,    68,     0,    63,
-      64,     0,    60,    61,    66,    69,    73,    57,    78,     0,
-       0,    46,     0,    49,   214,     0,   236,   238,     0,     0,
-       0,     0,     0,     0,     0,   201,     0,     0,     0,   174,
-     164,   193,   194,     0,   189,     0,     0,     0,   180,     0,
-     192,   191,   207,   208,   209,   210,   211,   212,   213,   184,
-     183,   186,   185,   187,   188,     0,    35,   303,     0,     0,
-      39,     0,    23,   281,   129,   258,   260,     0,   262,   275,
-     261,   133,   153,   276,   139,   150,   148,     0,    45,     0,
-       0,    62,     0,     0,     0,    70,     0,    82,    83,     0,
-      56,    77,    79,     0,     0,    53,     0,   205,     0,     0,
-       0,     0,   199,     0,     0,     0,   232,     0,   190,     0,
-       0,     0,   181,   233,    98,    95,    25,     0,     0,   297,
-     289,   295,   293,   296,   291,     0,     0,     0,   274,   266,
-     272,     0,   123,    48,     0,     0,     0,     0,     0,    81,
-      84,    80,     0,    86,   215,     0,     0,   203,     0,   202,
-       0,   206,   234,     0,     0,   197,   195,   275,     0,   292,
-     294,   290,     0,   259,   276,     0,    59,    75,     0,    71,
-      58,    72,    85,   216,   217,   200,   204,   198,   196,   263,
-     286,   298,     0,   135,     0,     0,     0,     0,     0,   132,
-      74,     0,   299,   287,   273,   134,   235,     0,   288
+       0,     0,     0,     0,   101,     0,     0,    99,     0,     0,
+     120,   119,    92,     0,     0,    20,     0,     0,   146,   142,
+       0,   292,     0,   293,   173,   123,   127,     0,   157,   156,
+     155,   131,     0,     0,     0,     0,    65,     0,    67,    76,
+      68,     0,    63,    64,     0,    60,    61,    66,    69,    73,
+      57,    78,     0,     0,    46,     0,    49,   229,     0,   251,
+     253,     0,     0,     0,     0,     0,     0,     0,   216,     0,
+       0,     0,   189,   179,   208,   209,     0,   204,     0,     0,
+       0,   195,     0,   207,   206,   222,   223,   224,   225,   226,
+     227,   228,   199,   198,   201,   200,   202,   203,     0,    35,
+     318,     0,   103,     0,   108,   110,   266,     0,   113,   111,
+     112,   104,     0,   115,   116,     0,    39,     0,    23,   296,
+     144,   273,   275,     0,   277,   290,   276,   148,   168,   291,
+     154,   165,   163,     0,    45,     0,     0,    62,     0,     0,
+       0,    70,     0,    82,    83,     0,    56,    77,    79,     0,
+       0,    53,     0,   220,     0,     0,     0,     0,   214,     0,
+       0,     0,   247,     0,   205,     0,     0,     0,   196,   248,
+      98,     0,   105,   114,    95,    25,     0,     0,   312,   304,
+     310,   308,   311,   306,     0,     0,     0,   289,   281,   287,
+       0,   138,    48,     0,     0,     0,     0,     0,    81,    84,
+      80,     0,    86,   230,     0,     0,   218,     0,   217,     0,
+     221,   249,     0,     0,   212,   210,     0,   107,   290,     0,
+     307,   309,   305,     0,   274,   291,     0,    59,    75,     0,
+      71,    58,    72,    85,   231,   232,   215,   219,   213,   211,
+     106,   278,   301,   313,     0,   150,     0,     0,     0,     0,
+       0,   147,    74,     0,   314,   302,   288,   149,   250,     0,
+     303
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -410,  -410,  -410,   460,  -410,   516,  -410,   226,  -410,   159,
-    -410,  -410,  -410,  -410,   230,   -85,   391,  -410,  -410,  -410,
-     236,  -410,   191,  -410,   107,  -410,  -410,  -410,  -410,   113,
-    -410,  -410,   -49,  -410,  -410,  -410,  -410,  -410,  -410,   415,
-    -410,  -410,   324,  -187,   -97,  -410,     3,   -73,   -25,  -410,
-    -410,   -84,   307,  -410,  -410,  -410,  -135,  -410,  -410,   -94,
-    -410,   224,  -410,  -410,    -2,  -266,  -410,   -36,   256,  -143,
-    -193,  -410,  -410,  -410,  -410,  -410,  -410,   280,  -410,  -410,
-    -410,  -410,  -410,  -144,  -410,  -410,  -410,  -410,  -410,    30,
-     -62,   -90,  -410,  -410,   -92,  -410,  -410,  -410,  -410,  -410,
-    -409,    54,  -410,  -410,  -410,     0,  -410,  -410,    82,   339,
-    -410,  -410,  -410,  -410,   485,  -410,  -410,  -410,  -410,  -321
+    -333,  -333,  -333,   501,  -333,   546,  -333,   273,  -333,   175,
+    -333,  -333,  -333,  -333,   271,   -91,   441,  -333,  -333,  -333,
+     242,  -333,   207,  -333,   139,  -333,  -333,  -333,  -333,   146,
+    -333,  -333,   -49,  -333,  -333,  -333,  -333,  -333,  -333,   459,
+    -333,  -333,  -333,   193,  -333,  -333,   373,  -191,   -86,  -333,
+      51,   -73,   -39,  -333,  -333,   -87,   339,  -333,  -333,  -333,
+    -138,  -333,  -333,    70,  -333,   272,  -333,  -333,   -26,  -269,
+    -333,  -120,   278,  -143,  -193,  -333,  -333,  -333,  -333,  -333,
+    -333,   337,  -333,  -333,  -333,  -333,  -333,  -154,  -333,  -333,
+    -333,  -333,  -333,    52,   -61,   -80,  -333,  -333,   -99,  -333,
+    -333,  -284,  -283,  -333,  -332,    85,  -333,  -333,  -333,     0,
+    -333,  -333,    90,   368,  -333,  -333,  -333,  -333,   522,  -333,
+    -333,  -333,  -333,  -326
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
@@ -1103,16 +1149,17 @@ static const yytype_int16 yydefgoto[] =
 {
        0,    19,    20,    21,    22,    71,   246,   247,    23,    64,
       24,   137,    25,    26,    88,   153,   243,    27,    28,    29,
-      83,   269,   270,   271,   358,   435,   431,   440,   441,   442,
+      83,   269,   270,   271,   361,   451,   447,   456,   457,   458,
      272,    30,    92,    31,   240,   241,    32,    33,    34,   147,
-      35,   149,   150,    36,   167,   168,   169,    76,   110,   111,
-     172,    77,   164,   248,   325,   326,   144,   482,   539,   114,
-     254,   255,   337,   104,   177,   249,   125,   126,   250,   251,
-     214,   215,   216,   217,   218,   219,   220,   281,   221,   222,
-     223,   224,   225,   194,   195,   196,   226,   227,   228,   229,
-     230,   128,   129,   130,   131,   132,   133,   134,   135,   414,
-     415,   416,   417,   418,    51,   419,   140,   478,   479,   480,
-     331,    37,    38,    61,    62,   420,   475,   543,    69,   233
+     317,   318,   319,   421,    35,   149,   150,    36,   167,   168,
+     169,    76,   110,   111,   172,    77,   164,   248,   328,   329,
+     144,   501,   561,   114,   254,   255,   340,   104,   177,   249,
+     125,   126,   250,   251,   214,   215,   216,   217,   218,   219,
+     220,   281,   221,   222,   223,   224,   225,   194,   195,   196,
+     226,   227,   228,   229,   230,   128,   129,   130,   131,   132,
+     133,   134,   135,   430,   431,   432,   433,   434,    51,   435,
+     140,   497,   498,   499,   334,    37,    38,    61,    62,   436,
+     494,   565,    69,   233
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -1120,190 +1167,194 @@ static const yytype_int16 yydefgoto[] =
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-     213,   106,    41,   154,   154,    44,    95,    96,    97,   155,
-      52,   162,    54,   265,   238,   284,   174,   286,   127,   378,
-     427,   163,   538,    40,   366,   546,   170,   328,   328,   170,
-     256,   143,   258,   260,    73,   261,    93,   266,    58,   444,
-      75,   116,   117,   118,    45,   199,   335,    40,    86,   289,
-      89,   297,   113,    46,   385,   154,    55,    39,    98,   449,
-     231,   267,   289,   297,   280,    56,   290,   513,   274,   288,
-     275,   289,   336,   252,   235,    94,   200,   105,    59,   290,
-     257,   386,   340,    47,   141,   142,   363,   311,   290,   312,
-     284,   468,   152,   317,   268,    57,   157,   158,   383,   446,
-     384,   312,   159,   531,   390,   391,   392,   393,   394,   395,
-     396,   397,   398,   399,   400,   401,   402,   403,   404,   262,
-      42,   461,   492,   380,   119,   436,   201,   237,   203,   116,
-     117,   118,   469,   369,   175,   370,   371,   470,   289,   287,
-     120,    43,   289,   471,   472,   253,   381,   382,   329,   477,
-     327,    74,   176,   279,   450,   290,   333,   289,   437,   290,
-     473,   289,    73,    48,  -298,   474,   289,    49,   234,   170,
-     204,   205,   206,    50,   290,   107,    65,    66,   290,   203,
-     116,   117,   118,   290,   364,   121,   122,   123,   367,   211,
-     421,   256,   458,   504,   413,    53,   425,   426,   263,   456,
-     373,   438,   314,   368,   327,   315,    60,   289,   500,   207,
-     108,   537,   119,   107,   322,   289,   124,   323,   439,   374,
-     405,   204,   205,   206,   290,   375,   467,   523,   120,    63,
-     453,   454,   290,   297,   203,   116,   117,   118,   259,   388,
-     361,    67,   112,   362,  -264,   208,   109,    78,   108,   533,
-     332,    70,   154,    79,   127,   338,   389,   428,   209,   127,
-     207,    68,   451,   119,   502,    80,   308,   309,   310,   311,
-     409,   312,    82,   121,   122,   123,   204,   205,   206,   120,
-     408,   374,    84,    85,   109,   411,   279,   452,    73,    81,
-      87,   210,   211,   289,   464,   499,   208,   181,   466,   212,
-     468,   181,    90,   455,   124,   495,    99,   497,   498,   209,
-     290,    91,   100,   406,   460,   207,   102,   103,   119,   203,
-     116,   117,   118,   115,   121,   122,   123,   136,   203,   116,
-     117,   118,   483,   493,   120,   315,   315,   289,   138,   525,
-     139,   469,   210,   211,   494,   506,   470,   327,   327,   143,
-     212,   208,   471,   472,   290,   124,   517,   526,   145,   518,
-     146,   204,   205,   206,   209,   468,   148,   151,   116,   473,
-     282,   205,   206,  -298,   474,   522,   156,   118,   315,   121,
-     122,   123,   528,   165,   544,   327,   503,   315,   203,   116,
-     117,   118,   163,   542,   166,   545,    74,   210,   211,   161,
-     207,   171,   173,   119,   178,   212,   469,   179,   180,   207,
-     124,   470,   119,   181,   197,   198,   232,   471,   472,   120,
-     236,   535,   239,   242,   245,   112,   264,   291,   120,    15,
-     273,   205,   206,   276,   473,   277,   208,   278,   313,   474,
-     285,   320,   319,   316,   321,   283,   324,   342,   339,   209,
-     327,   334,   341,  -265,   359,   360,    73,   376,   209,   379,
-     387,   407,   423,   292,   121,   122,   123,   429,   430,   207,
-     536,   432,   119,   121,   122,   123,   433,   434,   443,   448,
-     447,   385,   210,   211,   289,   459,   462,   312,   120,   465,
-     212,   210,   211,   481,   463,   124,   484,   476,   485,   212,
-     486,   487,   488,   489,   124,   283,   501,   508,   490,   505,
-     293,   182,   183,   184,   185,   186,   187,   507,   209,   509,
-     510,   511,   514,   512,   534,   516,   515,   519,   101,   520,
-     294,   521,   524,   121,   122,   123,   527,   295,   296,   532,
-      72,   540,   541,   275,   297,   298,   244,   548,  -300,   412,
-     410,   210,   211,   445,   491,     1,   496,   202,   424,   212,
-     372,   318,   530,     2,   124,   299,   300,   301,   302,   303,
-       3,   547,   304,   305,     4,   306,   307,   308,   309,   310,
-     311,   365,   312,   422,     5,   160,     1,     6,     7,   529,
-     330,     0,     0,     0,     2,     0,     0,     0,     0,     8,
-       9,     3,     0,     0,     0,     4,     0,   292,     0,     0,
-      10,     0,     0,    11,     0,     5,     0,     0,     6,     7,
+     213,   106,    41,   155,   162,    44,    95,    96,    97,   265,
+      52,   238,    54,   154,   154,   284,   381,   286,   443,   127,
+      40,   369,   568,   170,   163,   261,   170,   174,   143,   560,
+     256,   331,   258,   260,   331,   423,   424,   460,   113,   297,
+     289,    73,   343,    58,   314,   199,    40,   315,    86,   297,
+      89,   107,    93,   338,   231,   175,   466,   290,    98,    39,
+      42,   452,   388,   289,   280,   154,   116,   117,   118,   288,
+     414,   415,   416,   176,   235,   311,   200,   312,   289,   339,
+     290,    43,   366,    59,   141,   142,   108,   312,    75,   389,
+     284,    94,   152,   320,   453,   290,   157,   158,   386,   462,
+     387,   383,   289,   107,   393,   394,   395,   396,   397,   398,
+     399,   400,   401,   402,   403,   404,   405,   406,   407,   290,
+     262,   477,   109,   372,   237,   105,   201,   289,    48,   423,
+     424,   253,    49,   511,   289,   373,   374,   454,   108,   287,
+     203,   116,   117,   118,   290,   289,   384,   385,   266,   119,
+     159,   290,   496,   417,   455,   332,   487,   330,    74,   391,
+     279,   289,   290,   534,   289,   120,   170,   336,    45,   418,
+     112,   465,   267,    73,   109,    60,   392,    46,   290,   234,
+      55,   290,   204,   205,   206,   370,   211,   367,   544,    56,
+     437,   429,    65,    66,   256,   474,   411,   488,   263,   441,
+     442,   553,   489,   371,   427,   268,   523,    47,   490,   491,
+     121,   122,   123,   408,   121,   419,   420,   376,   472,    57,
+     422,   207,    53,   330,   119,   492,   335,   467,   559,  -313,
+     493,   341,   519,   469,   470,    50,   377,   252,   486,   289,
+     120,   124,   378,   297,   257,   124,   377,   289,   325,   518,
+     259,   326,   468,    63,   444,   127,   290,   208,   203,   116,
+     117,   118,    67,   127,   290,   154,   289,   555,   546,    68,
+     209,   364,   412,   425,   365,   413,   308,   309,   310,   311,
+     521,   312,   274,   290,   275,   121,   122,   123,    84,    85,
+     203,   116,   117,   118,   182,   183,   184,   185,   186,   187,
+     204,   205,   206,   210,   211,   480,   471,  -109,   181,  -279,
+    -109,   212,    70,   409,   422,   485,   124,   476,   181,   502,
+     487,   514,   315,   516,   517,   203,   116,   117,   118,    78,
+      79,    80,   204,   205,   206,   512,    81,   513,   315,   207,
+     330,    82,   119,    87,    73,   182,   183,   184,   185,   186,
+     187,   188,   189,   190,   191,   192,   193,   525,   120,   538,
+     330,   488,   539,    90,    91,   279,   489,   204,   205,   206,
+      99,   207,   490,   491,   119,   208,   547,   543,   549,   566,
+     315,   330,   315,   203,   116,   117,   118,   102,   209,   492,
+     120,   100,   103,  -313,   493,   115,   138,   203,   116,   117,
+     118,   136,   522,   121,   122,   123,   207,   208,   139,   119,
+     143,   145,   148,   146,   151,   564,   116,   567,   156,    74,
+     209,   210,   211,   161,   118,   120,   205,   206,   163,   212,
+     171,   165,   166,   173,   124,   121,   122,   123,   291,   282,
+     205,   206,   208,   178,   179,   180,   181,   197,   198,   232,
+     239,   236,   242,   210,   211,   209,   245,   112,   264,    15,
+     273,   212,   276,   277,   207,   285,   124,   119,   278,   313,
+     121,   122,   123,  -280,   292,   316,   322,   323,   207,   324,
+     327,   119,   330,   120,   337,   342,   344,   345,   210,   211,
+     362,    73,   410,   439,   363,   379,   212,   120,   382,   390,
+     283,   124,   463,   445,   446,   448,   449,   450,   459,   475,
+     464,   388,   289,   209,   283,   312,   478,   479,   483,   484,
+     481,   293,   508,   495,   503,   500,   504,   209,   121,   122,
+     123,   505,   506,   507,   520,   509,   524,   527,   530,   528,
+     526,   294,   121,   122,   123,   529,   210,   211,   295,   296,
+     531,   532,   533,   535,   212,   297,   298,   537,   536,   124,
+     210,   211,   556,   540,   541,   542,   545,   550,   212,   101,
+      72,   548,   461,   124,   554,   563,   299,   300,   301,   302,
+     303,   562,   487,   304,   305,  -315,   306,   307,   308,   309,
+     310,   311,     1,   312,   426,   275,   244,     1,   570,   428,
+       2,   202,   292,   510,   515,     2,   482,     3,   438,   440,
+     321,     4,     3,   368,   552,   569,     4,   375,   551,   333,
+       0,     5,   160,   488,     6,     7,     5,     0,   489,     6,
+       7,     0,     0,     0,   490,   491,     8,     9,   557,     0,
+       0,     8,     9,     0,     0,     0,     0,    10,     0,   293,
+      11,   492,    10,   292,     0,    11,   493,     0,     0,     0,
+       0,     0,     0,   473,     0,     0,     0,     0,     0,   380,
+       0,    12,     0,     0,     0,    13,    12,   296,     0,   292,
+      13,     0,     0,   297,   298,     0,     0,   558,     0,     0,
+      14,     0,     0,     0,     0,    14,    15,     0,   292,     0,
+     293,    15,     0,     0,   299,   300,   301,   302,   303,     0,
+       0,   304,   305,     0,   306,   307,   308,   309,   310,   311,
+     380,   312,     0,     0,     0,     0,  -316,     0,   296,     0,
+       0,     0,     0,     0,   297,   298,     0,    16,    17,    18,
+       0,     0,    16,    17,    18,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   296,   299,   300,   301,   302,   303,
+     297,  -316,   304,   305,     0,   306,   307,   308,   309,   310,
+     311,     0,   312,   296,     0,     0,     0,     0,     0,   297,
+       0,  -316,  -316,  -316,   302,   303,     0,     0,   304,   305,
+       0,   306,   307,   308,   309,   310,   311,     0,   312,     0,
+       0,     0,     0,  -316,  -316,     0,     0,  -316,  -316,     0,
+     306,   307,   308,   309,   310,   311,   346,   312,     0,     0,
+       0,   347,   348,   349,   350,     0,   351,     0,     0,     0,
+       0,     0,     0,     0,   352,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       8,     9,     0,     0,    12,     0,     0,     0,    13,     0,
-       0,    10,     0,     0,    11,     0,     0,     0,     0,     0,
-       0,     0,     0,    14,   293,     0,     0,     0,     0,    15,
-     292,     0,     0,     0,     0,    12,     0,     0,   457,    13,
-       0,     0,     0,     0,   377,     0,     0,     0,   292,     0,
-       0,     0,   296,     0,    14,     0,     0,     0,   297,   298,
-      15,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      16,    17,    18,     0,     0,     0,     0,   293,     0,   299,
-     300,   301,   302,   303,     0,     0,   304,   305,     0,   306,
-     307,   308,   309,   310,   311,  -301,   312,   377,   292,     0,
-       0,    16,    17,    18,     0,   296,     0,     0,     0,     0,
-       0,   297,   298,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   296,     0,     0,     0,     0,     0,   297,
-    -301,     0,   299,   300,   301,   302,   303,     0,     0,   304,
-     305,     0,   306,   307,   308,   309,   310,   311,     0,   312,
-    -301,  -301,  -301,   302,   303,     0,     0,   304,   305,     0,
-     306,   307,   308,   309,   310,   311,     0,   312,     0,     0,
-       0,     0,     0,   296,     0,   343,     0,     0,     0,   297,
-     344,   345,   346,   347,     0,   348,     0,     0,     0,     0,
-       0,     0,     0,   349,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,  -301,  -301,     0,     0,  -301,  -301,     0,
-     306,   307,   308,   309,   310,   311,     0,   312,     0,   350,
-     182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
-     192,   193,     0,     0,     0,     0,   351,     0,   352,   353,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   354,     0,     0,     0,   355,     0,   356,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   357
+     353,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   354,     0,   355,
+     356,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   357,     0,     0,     0,   358,     0,
+     359,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     360
 };
 
 static const yytype_int16 yycheck[] =
 {
-     143,    74,     2,    93,    94,     5,    55,    56,    57,    94,
-      10,   103,    12,   200,   149,   208,   113,   210,    80,   285,
-     341,    12,    50,     3,     3,     3,   110,     3,     3,   113,
-     173,    82,   175,   176,    57,   179,    93,     3,    19,   360,
-      37,     4,     5,     6,    70,    93,    89,     3,    48,   114,
-      50,   134,    77,    79,   100,   145,    70,    26,    58,   124,
-     145,    27,   114,   134,   207,    79,   131,   476,   174,   212,
-     176,   114,   115,   167,   147,   132,   124,    74,    59,   131,
-     174,   127,    54,   109,    84,    85,   273,   170,   131,   172,
-     283,    25,    92,   236,    60,   109,    96,    97,   291,   365,
-     293,   172,    99,   512,   297,   298,   299,   300,   301,   302,
-     303,   304,   305,   306,   307,   308,   309,   310,   311,   181,
-       3,   387,   443,   175,    87,    27,   174,   178,     3,     4,
-       5,     6,    66,   277,    54,   278,   279,    71,   114,   212,
-     103,     3,   114,    77,    78,   170,   289,   290,   124,   124,
-     178,   174,    72,   110,   107,   131,   253,   114,    60,   131,
-      94,   114,    57,    93,    98,    99,   114,    93,    63,   253,
-      45,    46,    47,    97,   131,     9,    17,    18,   131,     3,
-       4,     5,     6,   131,   175,   148,   149,   150,   167,   167,
-     325,   334,   385,   459,   174,    79,   339,   340,   198,   173,
-      91,   103,   175,   276,   178,   178,     3,   114,   107,    84,
-      44,   532,    87,     9,   175,   114,   179,   178,   120,   110,
-     312,    45,    46,    47,   131,   116,   413,   175,   103,   151,
-     373,   374,   131,   134,     3,     4,     5,     6,   113,   103,
-     175,     0,    76,   178,   178,   120,    80,     3,    44,   515,
-     252,   111,   342,   176,   316,   257,   120,   342,   133,   321,
-      84,   177,    91,    87,   457,   174,   167,   168,   169,   170,
-     319,   172,   126,   148,   149,   150,    45,    46,    47,   103,
-     316,   110,    46,    47,    80,   321,   110,   116,    57,    93,
-       3,   166,   167,   114,   175,   116,   120,   178,   175,   174,
-      25,   178,   122,   376,   179,   448,   124,   450,   451,   133,
-     131,   126,   178,   313,   387,    84,    96,   123,    87,     3,
-       4,     5,     6,     3,   148,   149,   150,     4,     3,     4,
-       5,     6,   175,   175,   103,   178,   178,   114,   120,   116,
-       3,    66,   166,   167,   175,   175,    71,   178,   178,    82,
-     174,   120,    77,    78,   131,   179,   175,   500,    92,   178,
-     174,    45,    46,    47,   133,    25,     3,    45,     4,    94,
-      45,    46,    47,    98,    99,   175,     3,     6,   178,   148,
-     149,   150,   175,   175,   175,   178,   459,   178,     3,     4,
-       5,     6,    12,   536,   175,   538,   174,   166,   167,   174,
-      84,   113,   125,    87,     4,   174,    66,     4,   175,    84,
-     179,    71,    87,   178,    45,   130,     3,    77,    78,   103,
-     155,    81,    90,   111,     3,    76,     3,    17,   103,   111,
-     124,    46,    47,   174,    94,   174,   120,   174,    97,    99,
-     172,    48,    38,   174,   174,   120,    93,    92,    54,   133,
-     178,   178,   174,   178,   119,   174,    57,   174,   133,   175,
-     174,     3,     3,    53,   148,   149,   150,   174,   174,    84,
-     130,   174,    87,   148,   149,   150,   174,   174,   174,    93,
-     175,   100,   166,   167,   114,   174,   103,   172,   103,     3,
-     174,   166,   167,    69,   173,   179,     6,   178,     6,   174,
-       6,     6,     6,   119,   179,   120,   175,    98,   103,   175,
-     100,   136,   137,   138,   139,   140,   141,   175,   133,    77,
-      77,    77,     3,    98,     6,   175,   125,   175,    68,   175,
-     120,   175,   175,   148,   149,   150,   175,   127,   128,   174,
-      24,   175,   174,   176,   134,   135,   155,   175,     0,   323,
-     320,   166,   167,   362,   441,     7,   449,   142,   334,   174,
-     280,   237,   508,    15,   179,   155,   156,   157,   158,   159,
-      22,   541,   162,   163,    26,   165,   166,   167,   168,   169,
-     170,   274,   172,   327,    36,   100,     7,    39,    40,   507,
-     251,    -1,    -1,    -1,    15,    -1,    -1,    -1,    -1,    51,
-      52,    22,    -1,    -1,    -1,    26,    -1,    53,    -1,    -1,
-      62,    -1,    -1,    65,    -1,    36,    -1,    -1,    39,    40,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      51,    52,    -1,    -1,    86,    -1,    -1,    -1,    90,    -1,
-      -1,    62,    -1,    -1,    65,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   105,   100,    -1,    -1,    -1,    -1,   111,
-      53,    -1,    -1,    -1,    -1,    86,    -1,    -1,   114,    90,
-      -1,    -1,    -1,    -1,   120,    -1,    -1,    -1,    53,    -1,
-      -1,    -1,   128,    -1,   105,    -1,    -1,    -1,   134,   135,
-     111,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     152,   153,   154,    -1,    -1,    -1,    -1,   100,    -1,   155,
-     156,   157,   158,   159,    -1,    -1,   162,   163,    -1,   165,
-     166,   167,   168,   169,   170,   100,   172,   120,    53,    -1,
-      -1,   152,   153,   154,    -1,   128,    -1,    -1,    -1,    -1,
-      -1,   134,   135,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   128,    -1,    -1,    -1,    -1,    -1,   134,
-     135,    -1,   155,   156,   157,   158,   159,    -1,    -1,   162,
-     163,    -1,   165,   166,   167,   168,   169,   170,    -1,   172,
-     155,   156,   157,   158,   159,    -1,    -1,   162,   163,    -1,
-     165,   166,   167,   168,   169,   170,    -1,   172,    -1,    -1,
-      -1,    -1,    -1,   128,    -1,    24,    -1,    -1,    -1,   134,
-      29,    30,    31,    32,    -1,    34,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    42,    -1,    -1,    -1,    -1,    -1,    -1,
+     143,    74,     2,    94,   103,     5,    55,    56,    57,   200,
+      10,   149,    12,    93,    94,   208,   285,   210,   344,    80,
+       3,     3,     3,   110,    12,   179,   113,   113,    82,    50,
+     173,     3,   175,   176,     3,   319,   319,   363,    77,   134,
+     114,    57,    54,    19,   175,    93,     3,   178,    48,   134,
+      50,     9,    93,    89,   145,    54,   107,   131,    58,    26,
+       3,    27,   100,   114,   207,   145,     4,     5,     6,   212,
+       4,     5,     6,    72,   147,   170,   124,   172,   114,   115,
+     131,     3,   273,    59,    84,    85,    44,   172,    37,   127,
+     283,   132,    92,   236,    60,   131,    96,    97,   291,   368,
+     293,   175,   114,     9,   297,   298,   299,   300,   301,   302,
+     303,   304,   305,   306,   307,   308,   309,   310,   311,   131,
+     181,   390,    80,   277,   178,    74,   174,   114,    93,   413,
+     413,   170,    93,   459,   114,   278,   279,   103,    44,   212,
+       3,     4,     5,     6,   131,   114,   289,   290,     3,    87,
+      99,   131,   124,    87,   120,   124,    25,   178,   174,   103,
+     110,   114,   131,   495,   114,   103,   253,   253,    70,   103,
+      76,   124,    27,    57,    80,     3,   120,    79,   131,    63,
+      70,   131,    45,    46,    47,   167,   167,   175,   175,    79,
+     328,   174,    17,    18,   337,   388,   316,    66,   198,   342,
+     343,   533,    71,   276,   324,    60,   475,   109,    77,    78,
+     148,   149,   150,   312,   148,   149,   150,    91,   173,   109,
+     319,    84,    79,   178,    87,    94,   252,    91,   554,    98,
+      99,   257,   107,   376,   377,    97,   110,   167,   429,   114,
+     103,   179,   116,   134,   174,   179,   110,   114,   175,   116,
+     113,   178,   116,   151,   345,   316,   131,   120,     3,     4,
+       5,     6,     0,   324,   131,   345,   114,   536,   116,   177,
+     133,   175,   175,   322,   178,   178,   167,   168,   169,   170,
+     473,   172,   174,   131,   176,   148,   149,   150,    46,    47,
+       3,     4,     5,     6,   136,   137,   138,   139,   140,   141,
+      45,    46,    47,   166,   167,   175,   379,   175,   178,   178,
+     178,   174,   111,   313,   413,   175,   179,   390,   178,   175,
+      25,   464,   178,   466,   467,     3,     4,     5,     6,     3,
+     176,   174,    45,    46,    47,   175,    93,   175,   178,    84,
+     178,   126,    87,     3,    57,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   175,   103,   175,
+     178,    66,   178,   122,   126,   110,    71,    45,    46,    47,
+     124,    84,    77,    78,    87,   120,   519,   175,   175,   175,
+     178,   178,   178,     3,     4,     5,     6,    96,   133,    94,
+     103,   178,   123,    98,    99,     3,   120,     3,     4,     5,
+       6,     4,   475,   148,   149,   150,    84,   120,     3,    87,
+      82,    92,     3,   174,    45,   558,     4,   560,     3,   174,
+     133,   166,   167,   174,     6,   103,    46,    47,    12,   174,
+     113,   175,   175,   125,   179,   148,   149,   150,    17,    45,
+      46,    47,   120,     4,     4,   175,   178,    45,   130,     3,
+      90,   155,   111,   166,   167,   133,     3,    76,     3,   111,
+     124,   174,   174,   174,    84,   172,   179,    87,   174,    97,
+     148,   149,   150,   178,    53,   174,    38,    48,    84,   174,
+      93,    87,   178,   103,   178,    54,   174,    92,   166,   167,
+     119,    57,     3,     3,   174,   174,   174,   103,   175,   174,
+     120,   179,   175,   174,   174,   174,   174,   174,   174,   174,
+      93,   100,   114,   133,   120,   172,   103,   173,     4,     3,
+     178,   100,   119,   178,     6,    69,     6,   133,   148,   149,
+     150,     6,     6,     6,   175,   103,   175,   174,    77,   175,
+     178,   120,   148,   149,   150,    98,   166,   167,   127,   128,
+      77,    77,    98,     3,   174,   134,   135,   175,   125,   179,
+     166,   167,     6,   175,   175,   175,   175,   174,   174,    68,
+      24,   175,   365,   179,   174,   174,   155,   156,   157,   158,
+     159,   175,    25,   162,   163,     0,   165,   166,   167,   168,
+     169,   170,     7,   172,   323,   176,   155,     7,   175,   326,
+      15,   142,    53,   457,   465,    15,   413,    22,   330,   337,
+     237,    26,    22,   274,   529,   563,    26,   280,   528,   251,
+      -1,    36,   100,    66,    39,    40,    36,    -1,    71,    39,
+      40,    -1,    -1,    -1,    77,    78,    51,    52,    81,    -1,
+      -1,    51,    52,    -1,    -1,    -1,    -1,    62,    -1,   100,
+      65,    94,    62,    53,    -1,    65,    99,    -1,    -1,    -1,
+      -1,    -1,    -1,   114,    -1,    -1,    -1,    -1,    -1,   120,
+      -1,    86,    -1,    -1,    -1,    90,    86,   128,    -1,    53,
+      90,    -1,    -1,   134,   135,    -1,    -1,   130,    -1,    -1,
+     105,    -1,    -1,    -1,    -1,   105,   111,    -1,    53,    -1,
+     100,   111,    -1,    -1,   155,   156,   157,   158,   159,    -1,
+      -1,   162,   163,    -1,   165,   166,   167,   168,   169,   170,
+     120,   172,    -1,    -1,    -1,    -1,   100,    -1,   128,    -1,
+      -1,    -1,    -1,    -1,   134,   135,    -1,   152,   153,   154,
+      -1,    -1,   152,   153,   154,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   128,   155,   156,   157,   158,   159,
+     134,   135,   162,   163,    -1,   165,   166,   167,   168,   169,
+     170,    -1,   172,   128,    -1,    -1,    -1,    -1,    -1,   134,
+      -1,   155,   156,   157,   158,   159,    -1,    -1,   162,   163,
+      -1,   165,   166,   167,   168,   169,   170,    -1,   172,    -1,
       -1,    -1,    -1,   158,   159,    -1,    -1,   162,   163,    -1,
-     165,   166,   167,   168,   169,   170,    -1,   172,    -1,    68,
-     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
-     146,   147,    -1,    -1,    -1,    -1,    85,    -1,    87,    88,
+     165,   166,   167,   168,   169,   170,    24,   172,    -1,    -1,
+      -1,    29,    30,    31,    32,    -1,    34,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    42,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   102,    -1,    -1,    -1,   106,    -1,   108,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   118
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      68,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    85,    -1,    87,
+      88,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   102,    -1,    -1,    -1,   106,    -1,
+     108,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     118
 };
 
 /* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
@@ -1313,58 +1364,61 @@ static const yytype_int16 yystos[] =
        0,     7,    15,    22,    26,    36,    39,    40,    51,    52,
       62,    65,    86,    90,   105,   111,   152,   153,   154,   181,
      182,   183,   184,   188,   190,   192,   193,   197,   198,   199,
-     211,   213,   216,   217,   218,   220,   223,   291,   292,    26,
-       3,   285,     3,     3,   285,    70,    79,   109,    93,    93,
-      97,   284,   285,    79,   285,    70,    79,   109,    19,    59,
-       3,   293,   294,   151,   189,   189,   189,     0,   177,   298,
-     111,   185,   185,    57,   174,   226,   227,   231,     3,   176,
-     174,    93,   126,   200,   200,   200,   285,     3,   194,   285,
-     122,   126,   212,    93,   132,   212,   212,   212,   285,   124,
-     178,   183,    96,   123,   243,   226,   227,     9,    44,    80,
-     228,   229,    76,   228,   239,     3,     4,     5,     6,    87,
-     103,   148,   149,   150,   179,   246,   247,   270,   271,   272,
-     273,   274,   275,   276,   277,   278,     4,   191,   120,     3,
-     286,   285,   285,    82,   236,    92,   174,   219,     3,   221,
-     222,    45,   285,   195,   271,   195,     3,   285,   285,   226,
-     294,   174,   274,    12,   232,   175,   175,   224,   225,   226,
-     231,   113,   230,   125,   224,    54,    72,   244,     4,     4,
+     211,   213,   216,   217,   218,   224,   227,   295,   296,    26,
+       3,   289,     3,     3,   289,    70,    79,   109,    93,    93,
+      97,   288,   289,    79,   289,    70,    79,   109,    19,    59,
+       3,   297,   298,   151,   189,   189,   189,     0,   177,   302,
+     111,   185,   185,    57,   174,   230,   231,   235,     3,   176,
+     174,    93,   126,   200,   200,   200,   289,     3,   194,   289,
+     122,   126,   212,    93,   132,   212,   212,   212,   289,   124,
+     178,   183,    96,   123,   247,   230,   231,     9,    44,    80,
+     232,   233,    76,   232,   243,     3,     4,     5,     6,    87,
+     103,   148,   149,   150,   179,   250,   251,   274,   275,   276,
+     277,   278,   279,   280,   281,   282,     4,   191,   120,     3,
+     290,   289,   289,    82,   240,    92,   174,   219,     3,   225,
+     226,    45,   289,   195,   275,   195,     3,   289,   289,   230,
+     298,   174,   278,    12,   236,   175,   175,   228,   229,   230,
+     235,   113,   234,   125,   228,    54,    72,   248,     4,     4,
      175,   178,   136,   137,   138,   139,   140,   141,   142,   143,
-     144,   145,   146,   147,   263,   264,   265,    45,   130,    93,
+     144,   145,   146,   147,   267,   268,   269,    45,   130,    93,
      124,   174,   219,     3,    45,    46,    47,    84,   120,   133,
-     166,   167,   174,   249,   250,   251,   252,   253,   254,   255,
-     256,   258,   259,   260,   261,   262,   266,   267,   268,   269,
-     270,   195,     3,   299,    63,   227,   155,   178,   236,    90,
-     214,   215,   111,   196,   196,     3,   186,   187,   233,   245,
-     248,   249,   239,   228,   240,   241,   249,   239,   249,   113,
-     249,   263,   270,   285,     3,   223,     3,    27,    60,   201,
+     166,   167,   174,   253,   254,   255,   256,   257,   258,   259,
+     260,   262,   263,   264,   265,   266,   270,   271,   272,   273,
+     274,   195,     3,   303,    63,   231,   155,   178,   240,    90,
+     214,   215,   111,   196,   196,     3,   186,   187,   237,   249,
+     252,   253,   243,   232,   244,   245,   253,   243,   253,   113,
+     253,   267,   274,   289,     3,   227,     3,    27,    60,   201,
      202,   203,   210,   124,   174,   176,   174,   174,   174,   110,
-     249,   257,    45,   120,   250,   172,   250,   227,   249,   114,
+     253,   261,    45,   120,   254,   172,   254,   231,   253,   114,
      131,    17,    53,   100,   120,   127,   128,   134,   135,   155,
      156,   157,   158,   159,   162,   163,   165,   166,   167,   168,
-     169,   170,   172,    97,   175,   178,   174,   249,   222,    38,
-      48,   174,   175,   178,    93,   234,   235,   178,     3,   124,
-     289,   290,   244,   224,   178,    89,   115,   242,   244,    54,
-      54,   174,    92,    24,    29,    30,    31,    32,    34,    42,
-      68,    85,    87,    88,   102,   106,   108,   118,   204,   119,
-     174,   175,   178,   223,   175,   232,     3,   167,   227,   263,
-     249,   249,   257,    91,   110,   116,   174,   120,   245,   175,
-     175,   249,   249,   250,   250,   100,   127,   174,   103,   120,
-     250,   250,   250,   250,   250,   250,   250,   250,   250,   250,
-     250,   250,   250,   250,   250,   274,   285,     3,   247,   212,
-     194,   247,   187,   174,   279,   280,   281,   282,   283,   285,
-     295,   236,   248,     3,   241,   249,   249,   299,   195,   174,
-     174,   206,   174,   174,   174,   205,    27,    60,   103,   120,
-     207,   208,   209,   174,   299,   202,   245,   175,    93,   124,
-     107,    91,   116,   249,   249,   227,   173,   114,   250,   174,
-     227,   245,   103,   173,   175,     3,   175,   223,    25,    66,
-      71,    77,    78,    94,    99,   296,   178,   124,   287,   288,
-     289,    69,   237,   175,     6,     6,     6,     6,     6,   119,
-     103,   209,   299,   175,   175,   249,   204,   249,   249,   116,
-     107,   175,   250,   227,   245,   175,   175,   175,    98,    77,
-      77,    77,    98,   280,     3,   125,   175,   175,   178,   175,
-     175,   175,   175,   175,   175,   116,   249,   175,   175,   288,
-     281,   280,   174,   245,     6,    81,   130,   299,    50,   238,
-     175,   174,   249,   297,   175,   249,     3,   269,   175
+     169,   170,   172,    97,   175,   178,   174,   220,   221,   222,
+     253,   226,    38,    48,   174,   175,   178,    93,   238,   239,
+     178,     3,   124,   293,   294,   248,   228,   178,    89,   115,
+     246,   248,    54,    54,   174,    92,    24,    29,    30,    31,
+      32,    34,    42,    68,    85,    87,    88,   102,   106,   108,
+     118,   204,   119,   174,   175,   178,   227,   175,   236,     3,
+     167,   231,   267,   253,   253,   261,    91,   110,   116,   174,
+     120,   249,   175,   175,   253,   253,   254,   254,   100,   127,
+     174,   103,   120,   254,   254,   254,   254,   254,   254,   254,
+     254,   254,   254,   254,   254,   254,   254,   254,   278,   289,
+       3,   251,   175,   178,     4,     5,     6,    87,   103,   149,
+     150,   223,   278,   281,   282,   212,   194,   251,   187,   174,
+     283,   284,   285,   286,   287,   289,   299,   240,   252,     3,
+     245,   253,   253,   303,   195,   174,   174,   206,   174,   174,
+     174,   205,    27,    60,   103,   120,   207,   208,   209,   174,
+     303,   202,   249,   175,    93,   124,   107,    91,   116,   253,
+     253,   231,   173,   114,   254,   174,   231,   249,   103,   173,
+     175,   178,   223,     4,     3,   175,   227,    25,    66,    71,
+      77,    78,    94,    99,   300,   178,   124,   291,   292,   293,
+      69,   241,   175,     6,     6,     6,     6,     6,   119,   103,
+     209,   303,   175,   175,   253,   204,   253,   253,   116,   107,
+     175,   254,   231,   249,   175,   175,   178,   174,   175,    98,
+      77,    77,    77,    98,   284,     3,   125,   175,   175,   178,
+     175,   175,   175,   175,   175,   175,   116,   253,   175,   175,
+     174,   292,   285,   284,   174,   249,     6,    81,   130,   303,
+      50,   242,   175,   174,   253,   301,   175,   253,     3,   273,
+     175
 };
 
 /* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
@@ -1380,27 +1434,28 @@ static const yytype_int16 yyr1[] =
      204,   204,   205,   205,   206,   206,   206,   207,   207,   208,
      208,   209,   209,   209,   209,   210,   210,   211,   211,   211,
      211,   212,   212,   213,   214,   215,   216,   217,   218,   218,
-     219,   219,   220,   221,   221,   222,   223,   223,   223,   224,
-     224,   225,   225,   226,   226,   227,   227,   228,   229,   229,
-     229,   230,   230,   231,   232,   232,   233,   234,   234,   235,
-     236,   236,   237,   237,   238,   238,   239,   239,   240,   240,
-     241,   242,   242,   242,   243,   243,   244,   244,   244,   244,
-     244,   244,   245,   245,   246,   246,   247,   247,   248,   249,
-     249,   249,   249,   249,   250,   250,   250,   250,   250,   250,
-     250,   250,   250,   250,   250,   251,   251,   252,   252,   252,
-     252,   252,   253,   253,   253,   253,   253,   253,   253,   253,
-     253,   253,   253,   254,   254,   255,   255,   255,   255,   256,
-     256,   256,   256,   257,   257,   258,   258,   259,   259,   259,
-     259,   259,   259,   259,   260,   260,   261,   262,   263,   263,
-     263,   263,   263,   263,   264,   264,   264,   264,   264,   264,
-     265,   265,   266,   267,   268,   269,   269,   269,   269,   270,
-     270,   270,   270,   270,   270,   270,   271,   272,   272,   273,
-     273,   274,   275,   276,   277,   277,   277,   278,   279,   279,
-     280,   280,   281,   281,   282,   282,   283,   284,   285,   285,
-     286,   286,   287,   287,   288,   288,   289,   289,   290,   290,
-     291,   291,   292,   293,   293,   294,   295,   295,   295,   296,
-     296,   296,   296,   296,   296,   296,   296,   296,   296,   297,
-     298,   298,   299,   299
+     218,   219,   219,   220,   221,   221,   222,   222,   223,   223,
+     223,   223,   223,   223,   223,   223,   223,   224,   225,   225,
+     226,   227,   227,   227,   228,   228,   229,   229,   230,   230,
+     231,   231,   232,   233,   233,   233,   234,   234,   235,   236,
+     236,   237,   238,   238,   239,   240,   240,   241,   241,   242,
+     242,   243,   243,   244,   244,   245,   246,   246,   246,   247,
+     247,   248,   248,   248,   248,   248,   248,   249,   249,   250,
+     250,   251,   251,   252,   253,   253,   253,   253,   253,   254,
+     254,   254,   254,   254,   254,   254,   254,   254,   254,   254,
+     255,   255,   256,   256,   256,   256,   256,   257,   257,   257,
+     257,   257,   257,   257,   257,   257,   257,   257,   258,   258,
+     259,   259,   259,   259,   260,   260,   260,   260,   261,   261,
+     262,   262,   263,   263,   263,   263,   263,   263,   263,   264,
+     264,   265,   266,   267,   267,   267,   267,   267,   267,   268,
+     268,   268,   268,   268,   268,   269,   269,   270,   271,   272,
+     273,   273,   273,   273,   274,   274,   274,   274,   274,   274,
+     274,   275,   276,   276,   277,   277,   278,   279,   280,   281,
+     281,   281,   282,   283,   283,   284,   284,   285,   285,   286,
+     286,   287,   288,   289,   289,   290,   290,   291,   291,   292,
+     292,   293,   293,   294,   294,   295,   295,   296,   297,   297,
+     298,   299,   299,   299,   300,   300,   300,   300,   300,   300,
+     300,   300,   300,   300,   301,   302,   302,   303,   303
 };
 
 /* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
@@ -1415,28 +1470,29 @@ static const yytype_int8 yyr2[] =
        1,     1,     2,     1,     1,     1,     1,     1,     1,     1,
        2,     4,     3,     0,     5,     3,     0,     1,     0,     1,
        2,     2,     1,     1,     2,     5,     4,     4,     4,     3,
-       4,     2,     0,     5,     1,     4,     4,     2,     8,     5,
-       3,     0,     5,     1,     3,     3,     2,     2,     6,     1,
-       1,     1,     3,     3,     3,     3,     5,     2,     1,     1,
-       1,     1,     0,     7,     1,     0,     1,     1,     0,     2,
-       2,     0,     4,     0,     2,     0,     3,     0,     1,     3,
-       2,     1,     1,     0,     2,     0,     2,     2,     4,     2,
-       4,     0,     1,     3,     1,     0,     1,     3,     2,     1,
-       1,     1,     1,     1,     3,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     3,     1,     1,     2,     2,     2,
-       3,     4,     1,     3,     3,     3,     3,     3,     3,     3,
-       4,     3,     3,     3,     3,     5,     6,     5,     6,     4,
-       6,     3,     5,     4,     5,     4,     5,     3,     3,     3,
-       3,     3,     3,     3,     3,     5,     6,     6,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     4,     4,     5,     1,     3,     1,     3,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     2,     2,     3,     2,     1,     1,     3,
-       1,     1,     1,     4,     1,     3,     2,     1,     1,     3,
-       1,     0,     1,     5,     1,     0,     2,     1,     1,     0,
-       1,     0,     2,     1,     3,     3,     4,     6,     8,     1,
-       2,     1,     2,     1,     2,     1,     1,     1,     0,     1,
-       1,     0,     1,     3
+       4,     2,     0,     5,     1,     4,     4,     2,     8,     6,
+       5,     3,     0,     2,     2,     3,     5,     4,     1,     1,
+       1,     1,     1,     1,     2,     1,     1,     5,     1,     3,
+       3,     2,     2,     6,     1,     1,     1,     3,     3,     3,
+       3,     5,     2,     1,     1,     1,     1,     0,     7,     1,
+       0,     1,     1,     0,     2,     2,     0,     4,     0,     2,
+       0,     3,     0,     1,     3,     2,     1,     1,     0,     2,
+       0,     2,     2,     4,     2,     4,     0,     1,     3,     1,
+       0,     1,     3,     2,     1,     1,     1,     1,     1,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     3,
+       1,     1,     2,     2,     2,     3,     4,     1,     3,     3,
+       3,     3,     3,     3,     3,     4,     3,     3,     3,     3,
+       5,     6,     5,     6,     4,     6,     3,     5,     4,     5,
+       4,     5,     3,     3,     3,     3,     3,     3,     3,     3,
+       5,     6,     6,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     4,     4,     5,
+       1,     3,     1,     3,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     2,     2,
+       3,     2,     1,     1,     3,     1,     1,     1,     4,     1,
+       3,     2,     1,     1,     3,     1,     0,     1,     5,     1,
+       0,     2,     1,     1,     0,     1,     0,     2,     1,     3,
+       3,     4,     6,     8,     1,     2,     1,     2,     1,     2,
+       1,     1,     1,     0,     1,     1,     0,     1,     3
 };
 
 
@@ -2000,821 +2056,851 @@ yydestruct (const char *yymsg,
   switch (yykind)
     {
     case YYSYMBOL_IDENTIFIER: /* IDENTIFIER  */
-#line 163 "bison_parser.y"
-                { free( (((*yyvaluep).sval)) ); }
-#line 2006 "bison_parser.cpp"
+#line 196 "bison_parser.y"
+                { arenaFree( (((*yyvaluep).sval)) ); }
+#line 2062 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_STRING: /* STRING  */
-#line 163 "bison_parser.y"
-                { free( (((*yyvaluep).sval)) ); }
-#line 2012 "bison_parser.cpp"
+#line 196 "bison_parser.y"
+                { arenaFree( (((*yyvaluep).sval)) ); }
+#line 2068 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_FLOATVAL: /* FLOATVAL  */
-#line 161 "bison_parser.y"
+#line 193 "bison_parser.y"
                 { }
-#line 2018 "bison_parser.cpp"
+#line 2074 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_INTVAL: /* INTVAL  */
-#line 161 "bison_parser.y"
+#line 193 "bison_parser.y"
                 { }
-#line 2024 "bison_parser.cpp"
+#line 2080 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_statement_list: /* statement_list  */
-#line 164 "bison_parser.y"
+#line 205 "bison_parser.y"
                 {
-      if ((((*yyvaluep).stmt_vec)) != nullptr) {
+      if ((((*yyvaluep).stmt_vec)) != nullptr && Arena::current() == nullptr) {
         for (auto ptr : *(((*yyvaluep).stmt_vec))) {
           delete ptr;
         }
       }
-      delete (((*yyvaluep).stmt_vec));
+      arenaDelete(((*yyvaluep).stmt_vec));
     }
-#line 2037 "bison_parser.cpp"
+#line 2093 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_statement: /* statement  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).statement)); }
-#line 2043 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).statement)); }
+#line 2099 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_preparable_statement: /* preparable_statement  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).statement)); }
-#line 2049 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).statement)); }
+#line 2105 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_hints: /* opt_hints  */
-#line 164 "bison_parser.y"
+#line 205 "bison_parser.y"
                 {
-      if ((((*yyvaluep).expr_vec)) != nullptr) {
+      if ((((*yyvaluep).expr_vec)) != nullptr && Arena::current() == nullptr) {
         for (auto ptr : *(((*yyvaluep).expr_vec))) {
           delete ptr;
         }
       }
-      delete (((*yyvaluep).expr_vec));
+      arenaDelete(((*yyvaluep).expr_vec));
     }
-#line 2062 "bison_parser.cpp"
+#line 2118 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_hint_list: /* hint_list  */
-#line 164 "bison_parser.y"
+#line 205 "bison_parser.y"
                 {
-      if ((((*yyvaluep).expr_vec)) != nullptr) {
+      if ((((*yyvaluep).expr_vec)) != nullptr && Arena::current() == nullptr) {
         for (auto ptr : *(((*yyvaluep).expr_vec))) {
           delete ptr;
         }
       }
-      delete (((*yyvaluep).expr_vec));
+      arenaDelete(((*yyvaluep).expr_vec));
     }
-#line 2075 "bison_parser.cpp"
+#line 2131 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_hint: /* hint  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2081 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2137 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_transaction_statement: /* transaction_statement  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).transaction_stmt)); }
-#line 2087 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).transaction_stmt)); }
+#line 2143 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_prepare_statement: /* prepare_statement  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).prep_stmt)); }
-#line 2093 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).prep_stmt)); }
+#line 2149 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_prepare_target_query: /* prepare_target_query  */
-#line 163 "bison_parser.y"
-                { free( (((*yyvaluep).sval)) ); }
-#line 2099 "bison_parser.cpp"
+#line 196 "bison_parser.y"
+                { arenaFree( (((*yyvaluep).sval)) ); }
+#line 2155 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_execute_statement: /* execute_statement  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).exec_stmt)); }
-#line 2105 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).exec_stmt)); }
+#line 2161 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_import_statement: /* import_statement  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).import_stmt)); }
-#line 2111 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).import_stmt)); }
+#line 2167 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_file_type: /* file_type  */
-#line 161 "bison_parser.y"
+#line 193 "bison_parser.y"
                 { }
-#line 2117 "bison_parser.cpp"
+#line 2173 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_file_path: /* file_path  */
-#line 163 "bison_parser.y"
-                { free( (((*yyvaluep).sval)) ); }
-#line 2123 "bison_parser.cpp"
+#line 196 "bison_parser.y"
+                { arenaFree( (((*yyvaluep).sval)) ); }
+#line 2179 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_file_type: /* opt_file_type  */
-#line 161 "bison_parser.y"
+#line 193 "bison_parser.y"
                 { }
-#line 2129 "bison_parser.cpp"
+#line 2185 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_export_statement: /* export_statement  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).export_stmt)); }
-#line 2135 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).export_stmt)); }
+#line 2191 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_show_statement: /* show_statement  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).show_stmt)); }
-#line 2141 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).show_stmt)); }
+#line 2197 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_create_statement: /* create_statement  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).create_stmt)); }
-#line 2147 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).create_stmt)); }
+#line 2203 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_not_exists: /* opt_not_exists  */
-#line 161 "bison_parser.y"
+#line 193 "bison_parser.y"
                 { }
-#line 2153 "bison_parser.cpp"
+#line 2209 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_table_elem_commalist: /* table_elem_commalist  */
-#line 164 "bison_parser.y"
+#line 205 "bison_parser.y"
                 {
-      if ((((*yyvaluep).table_element_vec)) != nullptr) {
+      if ((((*yyvaluep).table_element_vec)) != nullptr && Arena::current() == nullptr) {
         for (auto ptr : *(((*yyvaluep).table_element_vec))) {
           delete ptr;
         }
       }
-      delete (((*yyvaluep).table_element_vec));
+      arenaDelete(((*yyvaluep).table_element_vec));
     }
-#line 2166 "bison_parser.cpp"
+#line 2222 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_table_elem: /* table_elem  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).table_element_t)); }
-#line 2172 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).table_element_t)); }
+#line 2228 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_column_def: /* column_def  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).column_t)); }
-#line 2178 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).column_t)); }
+#line 2234 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_column_type: /* column_type  */
-#line 161 "bison_parser.y"
+#line 193 "bison_parser.y"
                 { }
-#line 2184 "bison_parser.cpp"
+#line 2240 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_time_precision: /* opt_time_precision  */
-#line 161 "bison_parser.y"
+#line 193 "bison_parser.y"
                 { }
-#line 2190 "bison_parser.cpp"
+#line 2246 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_decimal_specification: /* opt_decimal_specification  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).ival_pair)); }
-#line 2196 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).ival_pair)); }
+#line 2252 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_column_constraints: /* opt_column_constraints  */
-#line 161 "bison_parser.y"
+#line 193 "bison_parser.y"
                 { }
-#line 2202 "bison_parser.cpp"
+#line 2258 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_column_constraint_list: /* column_constraint_list  */
-#line 161 "bison_parser.y"
+#line 193 "bison_parser.y"
                 { }
-#line 2208 "bison_parser.cpp"
+#line 2264 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_column_constraint: /* column_constraint  */
-#line 161 "bison_parser.y"
+#line 193 "bison_parser.y"
                 { }
-#line 2214 "bison_parser.cpp"
+#line 2270 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_table_constraint: /* table_constraint  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).table_constraint_t)); }
-#line 2220 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).table_constraint_t)); }
+#line 2276 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_drop_statement: /* drop_statement  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).drop_stmt)); }
-#line 2226 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).drop_stmt)); }
+#line 2282 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_exists: /* opt_exists  */
-#line 161 "bison_parser.y"
+#line 193 "bison_parser.y"
                 { }
-#line 2232 "bison_parser.cpp"
+#line 2288 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_alter_statement: /* alter_statement  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).alter_stmt)); }
-#line 2238 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).alter_stmt)); }
+#line 2294 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_alter_action: /* alter_action  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).alter_action_t)); }
-#line 2244 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).alter_action_t)); }
+#line 2300 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_drop_action: /* drop_action  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).drop_action_t)); }
-#line 2250 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).drop_action_t)); }
+#line 2306 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_delete_statement: /* delete_statement  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).delete_stmt)); }
-#line 2256 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).delete_stmt)); }
+#line 2312 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_truncate_statement: /* truncate_statement  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).delete_stmt)); }
-#line 2262 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).delete_stmt)); }
+#line 2318 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_insert_statement: /* insert_statement  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).insert_stmt)); }
-#line 2268 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).insert_stmt)); }
+#line 2324 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_column_list: /* opt_column_list  */
-#line 164 "bison_parser.y"
+#line 197 "bison_parser.y"
                 {
-      if ((((*yyvaluep).str_vec)) != nullptr) {
+      if ((((*yyvaluep).str_vec)) != nullptr && Arena::current() == nullptr) {
         for (auto ptr : *(((*yyvaluep).str_vec))) {
-          delete ptr;
+          arenaFree(ptr);
         }
       }
-      delete (((*yyvaluep).str_vec));
+      arenaDelete(((*yyvaluep).str_vec));
     }
-#line 2281 "bison_parser.cpp"
+#line 2337 "bison_parser.cpp"
+        break;
+
+    case YYSYMBOL_values_list: /* values_list  */
+#line 220 "bison_parser.y"
+                { deleteValuesList(((*yyvaluep).values_list)); }
+#line 2343 "bison_parser.cpp"
+        break;
+
+    case YYSYMBOL_values_rows: /* values_rows  */
+#line 220 "bison_parser.y"
+                { deleteValuesList(((*yyvaluep).values_list)); }
+#line 2349 "bison_parser.cpp"
+        break;
+
+    case YYSYMBOL_values_row_begin: /* values_row_begin  */
+#line 220 "bison_parser.y"
+                { deleteValuesList(((*yyvaluep).values_list)); }
+#line 2355 "bison_parser.cpp"
+        break;
+
+    case YYSYMBOL_values_cell: /* values_cell  */
+#line 213 "bison_parser.y"
+                {
+      if ((((*yyvaluep).values_cell)).type == kExprLiteralString || (((*yyvaluep).values_cell)).type == kExprLiteralDate) {
+        arenaFree( ((((*yyvaluep).values_cell)).sval) );
+      } else if ((((*yyvaluep).values_cell)).type == kExprLiteralInterval || (((*yyvaluep).values_cell)).type == kExprParameter) {
+        arenaDelete( ((((*yyvaluep).values_cell)).expr) );
+      }
+    }
+#line 2367 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_update_statement: /* update_statement  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).update_stmt)); }
-#line 2287 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).update_stmt)); }
+#line 2373 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_update_clause_commalist: /* update_clause_commalist  */
-#line 164 "bison_parser.y"
+#line 205 "bison_parser.y"
                 {
-      if ((((*yyvaluep).update_vec)) != nullptr) {
+      if ((((*yyvaluep).update_vec)) != nullptr && Arena::current() == nullptr) {
         for (auto ptr : *(((*yyvaluep).update_vec))) {
           delete ptr;
         }
       }
-      delete (((*yyvaluep).update_vec));
+      arenaDelete(((*yyvaluep).update_vec));
     }
-#line 2300 "bison_parser.cpp"
+#line 2386 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_update_clause: /* update_clause  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).update_t)); }
-#line 2306 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).update_t)); }
+#line 2392 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_select_statement: /* select_statement  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).select_stmt)); }
-#line 2312 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).select_stmt)); }
+#line 2398 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_select_within_set_operation: /* select_within_set_operation  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).select_stmt)); }
-#line 2318 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).select_stmt)); }
+#line 2404 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_select_within_set_operation_no_parentheses: /* select_within_set_operation_no_parentheses  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).select_stmt)); }
-#line 2324 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).select_stmt)); }
+#line 2410 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_select_with_paren: /* select_with_paren  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).select_stmt)); }
-#line 2330 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).select_stmt)); }
+#line 2416 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_select_no_paren: /* select_no_paren  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).select_stmt)); }
-#line 2336 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).select_stmt)); }
+#line 2422 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_set_operator: /* set_operator  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).set_operator_t)); }
-#line 2342 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).set_operator_t)); }
+#line 2428 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_set_type: /* set_type  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).set_operator_t)); }
-#line 2348 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).set_operator_t)); }
+#line 2434 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_all: /* opt_all  */
-#line 161 "bison_parser.y"
+#line 193 "bison_parser.y"
                 { }
-#line 2354 "bison_parser.cpp"
+#line 2440 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_select_clause: /* select_clause  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).select_stmt)); }
-#line 2360 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).select_stmt)); }
+#line 2446 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_distinct: /* opt_distinct  */
-#line 161 "bison_parser.y"
+#line 193 "bison_parser.y"
                 { }
-#line 2366 "bison_parser.cpp"
+#line 2452 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_select_list: /* select_list  */
-#line 164 "bison_parser.y"
+#line 205 "bison_parser.y"
                 {
-      if ((((*yyvaluep).expr_vec)) != nullptr) {
+      if ((((*yyvaluep).expr_vec)) != nullptr && Arena::current() == nullptr) {
         for (auto ptr : *(((*yyvaluep).expr_vec))) {
           delete ptr;
         }
       }
-      delete (((*yyvaluep).expr_vec));
+      arenaDelete(((*yyvaluep).expr_vec));
     }
-#line 2379 "bison_parser.cpp"
+#line 2465 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_from_clause: /* opt_from_clause  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).table)); }
-#line 2385 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).table)); }
+#line 2471 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_from_clause: /* from_clause  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).table)); }
-#line 2391 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).table)); }
+#line 2477 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_where: /* opt_where  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2397 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2483 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_group: /* opt_group  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).group_t)); }
-#line 2403 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).group_t)); }
+#line 2489 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_having: /* opt_having  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2409 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2495 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_order: /* opt_order  */
-#line 164 "bison_parser.y"
+#line 205 "bison_parser.y"
                 {
-      if ((((*yyvaluep).order_vec)) != nullptr) {
+      if ((((*yyvaluep).order_vec)) != nullptr && Arena::current() == nullptr) {
         for (auto ptr : *(((*yyvaluep).order_vec))) {
           delete ptr;
         }
       }
-      delete (((*yyvaluep).order_vec));
+      arenaDelete(((*yyvaluep).order_vec));
     }
-#line 2422 "bison_parser.cpp"
+#line 2508 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_order_list: /* order_list  */
-#line 164 "bison_parser.y"
+#line 205 "bison_parser.y"
                 {
-      if ((((*yyvaluep).order_vec)) != nullptr) {
+      if ((((*yyvaluep).order_vec)) != nullptr && Arena::current() == nullptr) {
         for (auto ptr : *(((*yyvaluep).order_vec))) {
           delete ptr;
         }
       }
-      delete (((*yyvaluep).order_vec));
+      arenaDelete(((*yyvaluep).order_vec));
     }
-#line 2435 "bison_parser.cpp"
+#line 2521 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_order_desc: /* order_desc  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).order)); }
-#line 2441 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).order)); }
+#line 2527 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_order_type: /* opt_order_type  */
-#line 161 "bison_parser.y"
+#line 193 "bison_parser.y"
                 { }
-#line 2447 "bison_parser.cpp"
+#line 2533 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_top: /* opt_top  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).limit)); }
-#line 2453 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).limit)); }
+#line 2539 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_limit: /* opt_limit  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).limit)); }
-#line 2459 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).limit)); }
+#line 2545 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_expr_list: /* expr_list  */
-#line 164 "bison_parser.y"
+#line 205 "bison_parser.y"
                 {
-      if ((((*yyvaluep).expr_vec)) != nullptr) {
+      if ((((*yyvaluep).expr_vec)) != nullptr && Arena::current() == nullptr) {
         for (auto ptr : *(((*yyvaluep).expr_vec))) {
           delete ptr;
         }
       }
-      delete (((*yyvaluep).expr_vec));
+      arenaDelete(((*yyvaluep).expr_vec));
     }
-#line 2472 "bison_parser.cpp"
+#line 2558 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_literal_list: /* opt_literal_list  */
-#line 164 "bison_parser.y"
+#line 205 "bison_parser.y"
                 {
-      if ((((*yyvaluep).expr_vec)) != nullptr) {
+      if ((((*yyvaluep).expr_vec)) != nullptr && Arena::current() == nullptr) {
         for (auto ptr : *(((*yyvaluep).expr_vec))) {
           delete ptr;
         }
       }
-      delete (((*yyvaluep).expr_vec));
+      arenaDelete(((*yyvaluep).expr_vec));
     }
-#line 2485 "bison_parser.cpp"
+#line 2571 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_literal_list: /* literal_list  */
-#line 164 "bison_parser.y"
+#line 205 "bison_parser.y"
                 {
-      if ((((*yyvaluep).expr_vec)) != nullptr) {
+      if ((((*yyvaluep).expr_vec)) != nullptr && Arena::current() == nullptr) {
         for (auto ptr : *(((*yyvaluep).expr_vec))) {
           delete ptr;
         }
       }
-      delete (((*yyvaluep).expr_vec));
+      arenaDelete(((*yyvaluep).expr_vec));
     }
-#line 2498 "bison_parser.cpp"
+#line 2584 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_expr_alias: /* expr_alias  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2504 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2590 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_expr: /* expr  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2510 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2596 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_operand: /* operand  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2516 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2602 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_scalar_expr: /* scalar_expr  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2522 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2608 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_unary_expr: /* unary_expr  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2528 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2614 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_binary_expr: /* binary_expr  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2534 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2620 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_logic_expr: /* logic_expr  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2540 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2626 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_in_expr: /* in_expr  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2546 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2632 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_case_expr: /* case_expr  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2552 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2638 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_case_list: /* case_list  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2558 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2644 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_exists_expr: /* exists_expr  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2564 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2650 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_comp_expr: /* comp_expr  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2570 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2656 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_function_expr: /* function_expr  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2576 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2662 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_extract_expr: /* extract_expr  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2582 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2668 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_cast_expr: /* cast_expr  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2588 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2674 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_datetime_field: /* datetime_field  */
-#line 161 "bison_parser.y"
+#line 193 "bison_parser.y"
                 { }
-#line 2594 "bison_parser.cpp"
+#line 2680 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_datetime_field_plural: /* datetime_field_plural  */
-#line 161 "bison_parser.y"
+#line 193 "bison_parser.y"
                 { }
-#line 2600 "bison_parser.cpp"
+#line 2686 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_duration_field: /* duration_field  */
-#line 161 "bison_parser.y"
+#line 193 "bison_parser.y"
                 { }
-#line 2606 "bison_parser.cpp"
+#line 2692 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_array_expr: /* array_expr  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2612 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2698 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_array_index: /* array_index  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2618 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2704 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_between_expr: /* between_expr  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2624 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2710 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_column_name: /* column_name  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2630 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2716 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_literal: /* literal  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2636 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2722 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_string_literal: /* string_literal  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2642 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2728 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_bool_literal: /* bool_literal  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2648 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2734 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_num_literal: /* num_literal  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2654 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2740 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_int_literal: /* int_literal  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2660 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2746 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_null_literal: /* null_literal  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2666 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2752 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_date_literal: /* date_literal  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2672 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2758 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_interval_literal: /* interval_literal  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2678 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2764 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_param_expr: /* param_expr  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2684 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2770 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_table_ref: /* table_ref  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).table)); }
-#line 2690 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).table)); }
+#line 2776 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_table_ref_atomic: /* table_ref_atomic  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).table)); }
-#line 2696 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).table)); }
+#line 2782 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_nonjoin_table_ref_atomic: /* nonjoin_table_ref_atomic  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).table)); }
-#line 2702 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).table)); }
+#line 2788 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_table_ref_commalist: /* table_ref_commalist  */
-#line 164 "bison_parser.y"
+#line 205 "bison_parser.y"
                 {
-      if ((((*yyvaluep).table_vec)) != nullptr) {
+      if ((((*yyvaluep).table_vec)) != nullptr && Arena::current() == nullptr) {
         for (auto ptr : *(((*yyvaluep).table_vec))) {
           delete ptr;
         }
       }
-      delete (((*yyvaluep).table_vec));
+      arenaDelete(((*yyvaluep).table_vec));
     }
-#line 2715 "bison_parser.cpp"
+#line 2801 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_table_ref_name: /* table_ref_name  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).table)); }
-#line 2721 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).table)); }
+#line 2807 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_table_ref_name_no_alias: /* table_ref_name_no_alias  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).table)); }
-#line 2727 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).table)); }
+#line 2813 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_table_name: /* table_name  */
-#line 162 "bison_parser.y"
-                { free( (((*yyvaluep).table_name).name) ); free( (((*yyvaluep).table_name).schema) ); }
-#line 2733 "bison_parser.cpp"
+#line 195 "bison_parser.y"
+                { arenaFree( (((*yyvaluep).table_name).name) ); arenaFree( (((*yyvaluep).table_name).schema) ); }
+#line 2819 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_index_name: /* opt_index_name  */
-#line 163 "bison_parser.y"
-                { free( (((*yyvaluep).sval)) ); }
-#line 2739 "bison_parser.cpp"
+#line 196 "bison_parser.y"
+                { arenaFree( (((*yyvaluep).sval)) ); }
+#line 2825 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_table_alias: /* table_alias  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).alias_t)); }
-#line 2745 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).alias_t)); }
+#line 2831 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_table_alias: /* opt_table_alias  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).alias_t)); }
-#line 2751 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).alias_t)); }
+#line 2837 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_alias: /* alias  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).alias_t)); }
-#line 2757 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).alias_t)); }
+#line 2843 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_alias: /* opt_alias  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).alias_t)); }
-#line 2763 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).alias_t)); }
+#line 2849 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_with_clause: /* opt_with_clause  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).with_description_vec)); }
-#line 2769 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).with_description_vec)); }
+#line 2855 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_with_clause: /* with_clause  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).with_description_vec)); }
-#line 2775 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).with_description_vec)); }
+#line 2861 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_with_description_list: /* with_description_list  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).with_description_vec)); }
-#line 2781 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).with_description_vec)); }
+#line 2867 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_with_description: /* with_description  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).with_description_t)); }
-#line 2787 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).with_description_t)); }
+#line 2873 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_join_clause: /* join_clause  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).table)); }
-#line 2793 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).table)); }
+#line 2879 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_opt_join_type: /* opt_join_type  */
-#line 161 "bison_parser.y"
+#line 193 "bison_parser.y"
                 { }
-#line 2799 "bison_parser.cpp"
+#line 2885 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_join_condition: /* join_condition  */
-#line 172 "bison_parser.y"
-                { delete (((*yyvaluep).expr)); }
-#line 2805 "bison_parser.cpp"
+#line 221 "bison_parser.y"
+                { arenaDelete(((*yyvaluep).expr)); }
+#line 2891 "bison_parser.cpp"
         break;
 
     case YYSYMBOL_ident_commalist: /* ident_commalist  */
-#line 164 "bison_parser.y"
+#line 197 "bison_parser.y"
                 {
-      if ((((*yyvaluep).str_vec)) != nullptr) {
+      if ((((*yyvaluep).str_vec)) != nullptr && Arena::current() == nullptr) {
         for (auto ptr : *(((*yyvaluep).str_vec))) {
-          delete ptr;
+          arenaFree(ptr);
         }
       }
-      delete (((*yyvaluep).str_vec));
+      arenaDelete(((*yyvaluep).str_vec));
     }
-#line 2818 "bison_parser.cpp"
+#line 2904 "bison_parser.cpp"
         break;
 
       default:
@@ -2911,18 +2997,14 @@ YYLTYPE yylloc = yyloc_default;
 
 
 /* User initialization code.  */
-#line 77 "bison_parser.y"
+#line 111 "bison_parser.y"
 {
   // Initialize
-  yylloc.first_column = 0;
-  yylloc.last_column = 0;
-  yylloc.first_line = 0;
-  yylloc.last_line = 0;
-  yylloc.total_column = 0;
-  yylloc.string_length = 0;
+  yylloc.first_offset = 0;
+  yylloc.last_offset = 0;
 }
 
-#line 2926 "bison_parser.cpp"
+#line 3008 "bison_parser.cpp"
 
   yylsp[0] = yylloc;
   goto yysetstate;
@@ -3133,265 +3215,263 @@ yyreduce:
   switch (yyn)
     {
   case 2: /* input: statement_list opt_semicolon  */
-#line 294 "bison_parser.y"
+#line 345 "bison_parser.y"
                                      {
   for (SQLStatement* stmt : *(yyvsp[-1].stmt_vec)) {
     // Transfers ownership of the statement.
     result->addStatement(stmt);
   }
 
+  // The parameters were collected in the order of the query, which defines their ids.
   unsigned param_id = 0;
-  for (void* param : yyloc.param_list) {
-    if (param != nullptr) {
-      Expr* expr = (Expr*)param;
-      expr->ival = param_id;
-      result->addParameter(expr);
-      ++param_id;
-    }
+  for (Expr* param : *PARSE_STATE->parameters) {
+    param->ival = param_id;
+    ++param_id;
   }
-    delete (yyvsp[-1].stmt_vec);
+  result->setParameters(*PARSE_STATE->parameters);
+    arenaDelete((yyvsp[-1].stmt_vec));
   }
-#line 3155 "bison_parser.cpp"
+#line 3235 "bison_parser.cpp"
     break;
 
   case 3: /* statement_list: statement  */
-#line 313 "bison_parser.y"
+#line 362 "bison_parser.y"
                            {
-  (yyvsp[0].statement)->stringLength = yylloc.string_length;
-  yylloc.string_length = 0;
-  (yyval.stmt_vec) = new std::vector<SQLStatement*>();
+  (yyvsp[0].statement)->stringLength = yylloc.last_offset - PARSE_STATE->statementOffset;
+  PARSE_STATE->statementOffset = yylloc.last_offset;
+  (yyval.stmt_vec) = arenaNew<std::vector<SQLStatement*>>();
   (yyval.stmt_vec)->push_back((yyvsp[0].statement));
 }
-#line 3166 "bison_parser.cpp"
+#line 3246 "bison_parser.cpp"
     break;
 
   case 4: /* statement_list: statement_list ';' statement  */
-#line 319 "bison_parser.y"
+#line 368 "bison_parser.y"
                                {
-  (yyvsp[0].statement)->stringLength = yylloc.string_length;
-  yylloc.string_length = 0;
+  (yyvsp[0].statement)->stringLength = yylloc.last_offset - PARSE_STATE->statementOffset;
+  PARSE_STATE->statementOffset = yylloc.last_offset;
   (yyvsp[-2].stmt_vec)->push_back((yyvsp[0].statement));
   (yyval.stmt_vec) = (yyvsp[-2].stmt_vec);
 }
-#line 3177 "bison_parser.cpp"
+#line 3257 "bison_parser.cpp"
     break;
 
   case 5: /* statement: prepare_statement opt_hints  */
-#line 326 "bison_parser.y"
+#line 375 "bison_parser.y"
                                         {
   (yyval.statement) = (yyvsp[-1].prep_stmt);
   (yyval.statement)->hints = (yyvsp[0].expr_vec);
 }
-#line 3186 "bison_parser.cpp"
+#line 3266 "bison_parser.cpp"
     break;
 
   case 6: /* statement: preparable_statement opt_hints  */
-#line 330 "bison_parser.y"
+#line 379 "bison_parser.y"
                                  {
   (yyval.statement) = (yyvsp[-1].statement);
   (yyval.statement)->hints = (yyvsp[0].expr_vec);
 }
-#line 3195 "bison_parser.cpp"
+#line 3275 "bison_parser.cpp"
     break;
 
   case 7: /* statement: show_statement  */
-#line 334 "bison_parser.y"
+#line 383 "bison_parser.y"
                  { (yyval.statement) = (yyvsp[0].show_stmt); }
-#line 3201 "bison_parser.cpp"
+#line 3281 "bison_parser.cpp"
     break;
 
   case 8: /* statement: import_statement  */
-#line 335 "bison_parser.y"
+#line 384 "bison_parser.y"
                    { (yyval.statement) = (yyvsp[0].import_stmt); }
-#line 3207 "bison_parser.cpp"
+#line 3287 "bison_parser.cpp"
     break;
 
   case 9: /* statement: export_statement  */
-#line 336 "bison_parser.y"
+#line 385 "bison_parser.y"
                    { (yyval.statement) = (yyvsp[0].export_stmt); }
-#line 3213 "bison_parser.cpp"
+#line 3293 "bison_parser.cpp"
     break;
 
   case 10: /* preparable_statement: select_statement  */
-#line 338 "bison_parser.y"
+#line 387 "bison_parser.y"
                                         { (yyval.statement) = (yyvsp[0].select_stmt); }
-#line 3219 "bison_parser.cpp"
+#line 3299 "bison_parser.cpp"
     break;
 
   case 11: /* preparable_statement: create_statement  */
-#line 339 "bison_parser.y"
+#line 388 "bison_parser.y"
                    { (yyval.statement) = (yyvsp[0].create_stmt); }
-#line 3225 "bison_parser.cpp"
+#line 3305 "bison_parser.cpp"
     break;
 
   case 12: /* preparable_statement: insert_statement  */
-#line 340 "bison_parser.y"
+#line 389 "bison_parser.y"
                    { (yyval.statement) = (yyvsp[0].insert_stmt); }
-#line 3231 "bison_parser.cpp"
+#line 3311 "bison_parser.cpp"
     break;
 
   case 13: /* preparable_statement: delete_statement  */
-#line 341 "bison_parser.y"
+#line 390 "bison_parser.y"
                    { (yyval.statement) = (yyvsp[0].delete_stmt); }
-#line 3237 "bison_parser.cpp"
+#line 3317 "bison_parser.cpp"
     break;
 
   case 14: /* preparable_statement: truncate_statement  */
-#line 342 "bison_parser.y"
+#line 391 "bison_parser.y"
                      { (yyval.statement) = (yyvsp[0].delete_stmt); }
-#line 3243 "bison_parser.cpp"
+#line 3323 "bison_parser.cpp"
     break;
 
   case 15: /* preparable_statement: update_statement  */
-#line 343 "bison_parser.y"
+#line 392 "bison_parser.y"
                    { (yyval.statement) = (yyvsp[0].update_stmt); }
-#line 3249 "bison_parser.cpp"
+#line 3329 "bison_parser.cpp"
     break;
 
   case 16: /* preparable_statement: drop_statement  */
-#line 344 "bison_parser.y"
+#line 393 "bison_parser.y"
                  { (yyval.statement) = (yyvsp[0].drop_stmt); }
-#line 3255 "bison_parser.cpp"
+#line 3335 "bison_parser.cpp"
     break;
 
   case 17: /* preparable_statement: alter_statement  */
-#line 345 "bison_parser.y"
+#line 394 "bison_parser.y"
                   { (yyval.statement) = (yyvsp[0].alter_stmt); }
-#line 3261 "bison_parser.cpp"
+#line 3341 "bison_parser.cpp"
     break;
 
   case 18: /* preparable_statement: execute_statement  */
-#line 346 "bison_parser.y"
+#line 395 "bison_parser.y"
                     { (yyval.statement) = (yyvsp[0].exec_stmt); }
-#line 3267 "bison_parser.cpp"
+#line 3347 "bison_parser.cpp"
     break;
 
   case 19: /* preparable_statement: transaction_statement  */
-#line 347 "bison_parser.y"
+#line 396 "bison_parser.y"
                         { (yyval.statement) = (yyvsp[0].transaction_stmt); }
-#line 3273 "bison_parser.cpp"
+#line 3353 "bison_parser.cpp"
     break;
 
   case 20: /* opt_hints: WITH HINT '(' hint_list ')'  */
-#line 353 "bison_parser.y"
+#line 402 "bison_parser.y"
                                         { (yyval.expr_vec) = (yyvsp[-1].expr_vec); }
-#line 3279 "bison_parser.cpp"
+#line 3359 "bison_parser.cpp"
     break;
 
   case 21: /* opt_hints: %empty  */
-#line 354 "bison_parser.y"
+#line 403 "bison_parser.y"
               { (yyval.expr_vec) = nullptr; }
-#line 3285 "bison_parser.cpp"
+#line 3365 "bison_parser.cpp"
     break;
 
   case 22: /* hint_list: hint  */
-#line 356 "bison_parser.y"
+#line 405 "bison_parser.y"
                  {
-  (yyval.expr_vec) = new std::vector<Expr*>();
+  (yyval.expr_vec) = arenaNew<std::vector<Expr*>>();
   (yyval.expr_vec)->push_back((yyvsp[0].expr));
 }
-#line 3294 "bison_parser.cpp"
+#line 3374 "bison_parser.cpp"
     break;
 
   case 23: /* hint_list: hint_list ',' hint  */
-#line 360 "bison_parser.y"
+#line 409 "bison_parser.y"
                      {
   (yyvsp[-2].expr_vec)->push_back((yyvsp[0].expr));
   (yyval.expr_vec) = (yyvsp[-2].expr_vec);
 }
-#line 3303 "bison_parser.cpp"
+#line 3383 "bison_parser.cpp"
     break;
 
   case 24: /* hint: IDENTIFIER  */
-#line 365 "bison_parser.y"
+#line 414 "bison_parser.y"
                   {
   (yyval.expr) = Expr::make(kExprHint);
   (yyval.expr)->name = (yyvsp[0].sval);
 }
-#line 3312 "bison_parser.cpp"
+#line 3392 "bison_parser.cpp"
     break;
 
   case 25: /* hint: IDENTIFIER '(' literal_list ')'  */
-#line 369 "bison_parser.y"
+#line 418 "bison_parser.y"
                                   {
   (yyval.expr) = Expr::make(kExprHint);
   (yyval.expr)->name = (yyvsp[-3].sval);
   (yyval.expr)->exprList = (yyvsp[-1].expr_vec);
 }
-#line 3322 "bison_parser.cpp"
+#line 3402 "bison_parser.cpp"
     break;
 
   case 26: /* transaction_statement: BEGIN opt_transaction_keyword  */
-#line 379 "bison_parser.y"
+#line 428 "bison_parser.y"
                                                       { (yyval.transaction_stmt) = new TransactionStatement(kBeginTransaction); }
-#line 3328 "bison_parser.cpp"
+#line 3408 "bison_parser.cpp"
     break;
 
   case 27: /* transaction_statement: ROLLBACK opt_transaction_keyword  */
-#line 380 "bison_parser.y"
+#line 429 "bison_parser.y"
                                    { (yyval.transaction_stmt) = new TransactionStatement(kRollbackTransaction); }
-#line 3334 "bison_parser.cpp"
+#line 3414 "bison_parser.cpp"
     break;
 
   case 28: /* transaction_statement: COMMIT opt_transaction_keyword  */
-#line 381 "bison_parser.y"
+#line 430 "bison_parser.y"
                                  { (yyval.transaction_stmt) = new TransactionStatement(kCommitTransaction); }
-#line 3340 "bison_parser.cpp"
+#line 3420 "bison_parser.cpp"
     break;
 
   case 31: /* prepare_statement: PREPARE IDENTIFIER FROM prepare_target_query  */
-#line 389 "bison_parser.y"
+#line 438 "bison_parser.y"
                                                                  {
   (yyval.prep_stmt) = new PrepareStatement();
   (yyval.prep_stmt)->name = (yyvsp[-2].sval);
   (yyval.prep_stmt)->query = (yyvsp[0].sval);
 }
-#line 3350 "bison_parser.cpp"
+#line 3430 "bison_parser.cpp"
     break;
 
   case 33: /* execute_statement: EXECUTE IDENTIFIER  */
-#line 397 "bison_parser.y"
+#line 446 "bison_parser.y"
                                                                   {
   (yyval.exec_stmt) = new ExecuteStatement();
   (yyval.exec_stmt)->name = (yyvsp[0].sval);
 }
-#line 3359 "bison_parser.cpp"
+#line 3439 "bison_parser.cpp"
     break;
 
   case 34: /* execute_statement: EXECUTE IDENTIFIER '(' opt_literal_list ')'  */
-#line 401 "bison_parser.y"
+#line 450 "bison_parser.y"
                                               {
   (yyval.exec_stmt) = new ExecuteStatement();
   (yyval.exec_stmt)->name = (yyvsp[-3].sval);
   (yyval.exec_stmt)->parameters = (yyvsp[-1].expr_vec);
 }
-#line 3369 "bison_parser.cpp"
+#line 3449 "bison_parser.cpp"
     break;
 
   case 35: /* import_statement: IMPORT FROM file_type FILE file_path INTO table_name  */
-#line 412 "bison_parser.y"
+#line 461 "bison_parser.y"
                                                                         {
   (yyval.import_stmt) = new ImportStatement((yyvsp[-4].import_type_t));
   (yyval.import_stmt)->filePath = (yyvsp[-2].sval);
   (yyval.import_stmt)->schema = (yyvsp[0].table_name).schema;
   (yyval.import_stmt)->tableName = (yyvsp[0].table_name).name;
 }
-#line 3380 "bison_parser.cpp"
+#line 3460 "bison_parser.cpp"
     break;
 
   case 36: /* import_statement: COPY table_name FROM file_path opt_file_type  */
-#line 418 "bison_parser.y"
+#line 467 "bison_parser.y"
                                                {
   (yyval.import_stmt) = new ImportStatement((yyvsp[0].import_type_t));
   (yyval.import_stmt)->filePath = (yyvsp[-1].sval);
   (yyval.import_stmt)->schema = (yyvsp[-3].table_name).schema;
   (yyval.import_stmt)->tableName = (yyvsp[-3].table_name).name;
 }
-#line 3391 "bison_parser.cpp"
+#line 3471 "bison_parser.cpp"
     break;
 
   case 37: /* file_type: IDENTIFIER  */
-#line 425 "bison_parser.y"
+#line 474 "bison_parser.y"
                        {
   if (strcasecmp((yyvsp[0].sval), "csv") == 0) {
     (yyval.import_type_t) = kImportCSV;
@@ -3400,106 +3480,106 @@ yyreduce:
   } else if (strcasecmp((yyvsp[0].sval), "binary") == 0 || strcasecmp((yyvsp[0].sval), "bin") == 0) {
     (yyval.import_type_t) = kImportBinary;
   } else {
-    free((yyvsp[0].sval));
+    arenaFree((yyvsp[0].sval));
     yyerror(&yyloc, result, scanner, "File type is unknown.");
     YYERROR;
   }
-  free((yyvsp[0].sval));
+  arenaFree((yyvsp[0].sval));
 }
-#line 3410 "bison_parser.cpp"
+#line 3490 "bison_parser.cpp"
     break;
 
   case 38: /* file_path: string_literal  */
-#line 440 "bison_parser.y"
+#line 489 "bison_parser.y"
                            {
-  (yyval.sval) = strdup((yyvsp[0].expr)->name);
-  delete (yyvsp[0].expr);
+  (yyval.sval) = arenaStrdup((yyvsp[0].expr)->name);
+  arenaDelete((yyvsp[0].expr));
 }
-#line 3419 "bison_parser.cpp"
+#line 3499 "bison_parser.cpp"
     break;
 
   case 39: /* opt_file_type: WITH FORMAT file_type  */
-#line 445 "bison_parser.y"
+#line 494 "bison_parser.y"
                                       { (yyval.import_type_t) = (yyvsp[0].import_type_t); }
-#line 3425 "bison_parser.cpp"
+#line 3505 "bison_parser.cpp"
     break;
 
   case 40: /* opt_file_type: %empty  */
-#line 446 "bison_parser.y"
+#line 495 "bison_parser.y"
               { (yyval.import_type_t) = kImportAuto; }
-#line 3431 "bison_parser.cpp"
+#line 3511 "bison_parser.cpp"
     break;
 
   case 41: /* export_statement: COPY table_name TO file_path opt_file_type  */
-#line 452 "bison_parser.y"
+#line 501 "bison_parser.y"
                                                               {
   (yyval.export_stmt) = new ExportStatement((yyvsp[0].import_type_t));
   (yyval.export_stmt)->filePath = (yyvsp[-1].sval);
   (yyval.export_stmt)->schema = (yyvsp[-3].table_name).schema;
   (yyval.export_stmt)->tableName = (yyvsp[-3].table_name).name;
 }
-#line 3442 "bison_parser.cpp"
+#line 3522 "bison_parser.cpp"
     break;
 
   case 42: /* show_statement: SHOW TABLES  */
-#line 464 "bison_parser.y"
+#line 513 "bison_parser.y"
                              { (yyval.show_stmt) = new ShowStatement(kShowTables); }
-#line 3448 "bison_parser.cpp"
+#line 3528 "bison_parser.cpp"
     break;
 
   case 43: /* show_statement: SHOW COLUMNS table_name  */
-#line 465 "bison_parser.y"
+#line 514 "bison_parser.y"
                           {
   (yyval.show_stmt) = new ShowStatement(kShowColumns);
   (yyval.show_stmt)->schema = (yyvsp[0].table_name).schema;
   (yyval.show_stmt)->name = (yyvsp[0].table_name).name;
 }
-#line 3458 "bison_parser.cpp"
+#line 3538 "bison_parser.cpp"
     break;
 
   case 44: /* show_statement: DESCRIBE table_name  */
-#line 470 "bison_parser.y"
+#line 519 "bison_parser.y"
                       {
   (yyval.show_stmt) = new ShowStatement(kShowColumns);
   (yyval.show_stmt)->schema = (yyvsp[0].table_name).schema;
   (yyval.show_stmt)->name = (yyvsp[0].table_name).name;
 }
-#line 3468 "bison_parser.cpp"
+#line 3548 "bison_parser.cpp"
     break;
 
   case 45: /* create_statement: CREATE TABLE opt_not_exists table_name FROM IDENTIFIER FILE file_path  */
-#line 481 "bison_parser.y"
+#line 530 "bison_parser.y"
                                                                                          {
   (yyval.create_stmt) = new CreateStatement(kCreateTableFromTbl);
   (yyval.create_stmt)->ifNotExists = (yyvsp[-5].bval);
   (yyval.create_stmt)->schema = (yyvsp[-4].table_name).schema;
   (yyval.create_stmt)->tableName = (yyvsp[-4].table_name).name;
   if (strcasecmp((yyvsp[-2].sval), "tbl") != 0) {
-    free((yyvsp[-2].sval));
+    arenaFree((yyvsp[-2].sval));
     yyerror(&yyloc, result, scanner, "File type is unknown.");
     YYERROR;
   }
-  free((yyvsp[-2].sval));
+  arenaFree((yyvsp[-2].sval));
   (yyval.create_stmt)->filePath = (yyvsp[0].sval);
 }
-#line 3486 "bison_parser.cpp"
+#line 3566 "bison_parser.cpp"
     break;
 
   case 46: /* create_statement: CREATE TABLE opt_not_exists table_name '(' table_elem_commalist ')'  */
-#line 494 "bison_parser.y"
+#line 543 "bison_parser.y"
                                                                       {
   (yyval.create_stmt) = new CreateStatement(kCreateTable);
   (yyval.create_stmt)->ifNotExists = (yyvsp[-4].bval);
   (yyval.create_stmt)->schema = (yyvsp[-3].table_name).schema;
   (yyval.create_stmt)->tableName = (yyvsp[-3].table_name).name;
   (yyval.create_stmt)->setColumnDefsAndConstraints((yyvsp[-1].table_element_vec));
-  delete (yyvsp[-1].table_element_vec);
+  arenaDelete((yyvsp[-1].table_element_vec));
 }
-#line 3499 "bison_parser.cpp"
+#line 3579 "bison_parser.cpp"
     break;
 
   case 47: /* create_statement: CREATE TABLE opt_not_exists table_name AS select_statement  */
-#line 502 "bison_parser.y"
+#line 551 "bison_parser.y"
                                                              {
   (yyval.create_stmt) = new CreateStatement(kCreateTable);
   (yyval.create_stmt)->ifNotExists = (yyvsp[-3].bval);
@@ -3507,11 +3587,11 @@ yyreduce:
   (yyval.create_stmt)->tableName = (yyvsp[-2].table_name).name;
   (yyval.create_stmt)->select = (yyvsp[0].select_stmt);
 }
-#line 3511 "bison_parser.cpp"
+#line 3591 "bison_parser.cpp"
     break;
 
   case 48: /* create_statement: CREATE INDEX opt_not_exists opt_index_name ON table_name '(' ident_commalist ')'  */
-#line 509 "bison_parser.y"
+#line 558 "bison_parser.y"
                                                                                    {
   (yyval.create_stmt) = new CreateStatement(kCreateIndex);
   (yyval.create_stmt)->indexName = (yyvsp[-5].sval);
@@ -3519,11 +3599,11 @@ yyreduce:
   (yyval.create_stmt)->tableName = (yyvsp[-3].table_name).name;
   (yyval.create_stmt)->indexColumns = (yyvsp[-1].str_vec);
 }
-#line 3523 "bison_parser.cpp"
+#line 3603 "bison_parser.cpp"
     break;
 
   case 49: /* create_statement: CREATE VIEW opt_not_exists table_name opt_column_list AS select_statement  */
-#line 516 "bison_parser.y"
+#line 565 "bison_parser.y"
                                                                             {
   (yyval.create_stmt) = new CreateStatement(kCreateView);
   (yyval.create_stmt)->ifNotExists = (yyvsp[-4].bval);
@@ -3532,351 +3612,351 @@ yyreduce:
   (yyval.create_stmt)->viewColumns = (yyvsp[-2].str_vec);
   (yyval.create_stmt)->select = (yyvsp[0].select_stmt);
 }
-#line 3536 "bison_parser.cpp"
+#line 3616 "bison_parser.cpp"
     break;
 
   case 50: /* opt_not_exists: IF NOT EXISTS  */
-#line 525 "bison_parser.y"
+#line 574 "bison_parser.y"
                                { (yyval.bval) = true; }
-#line 3542 "bison_parser.cpp"
+#line 3622 "bison_parser.cpp"
     break;
 
   case 51: /* opt_not_exists: %empty  */
-#line 526 "bison_parser.y"
+#line 575 "bison_parser.y"
               { (yyval.bval) = false; }
-#line 3548 "bison_parser.cpp"
+#line 3628 "bison_parser.cpp"
     break;
 
   case 52: /* table_elem_commalist: table_elem  */
-#line 528 "bison_parser.y"
+#line 577 "bison_parser.y"
                                   {
-  (yyval.table_element_vec) = new std::vector<TableElement*>();
+  (yyval.table_element_vec) = arenaNew<std::vector<TableElement*>>();
   (yyval.table_element_vec)->push_back((yyvsp[0].table_element_t));
 }
-#line 3557 "bison_parser.cpp"
+#line 3637 "bison_parser.cpp"
     break;
 
   case 53: /* table_elem_commalist: table_elem_commalist ',' table_elem  */
-#line 532 "bison_parser.y"
+#line 581 "bison_parser.y"
                                       {
   (yyvsp[-2].table_element_vec)->push_back((yyvsp[0].table_element_t));
   (yyval.table_element_vec) = (yyvsp[-2].table_element_vec);
 }
-#line 3566 "bison_parser.cpp"
+#line 3646 "bison_parser.cpp"
     break;
 
   case 54: /* table_elem: column_def  */
-#line 537 "bison_parser.y"
+#line 586 "bison_parser.y"
                         { (yyval.table_element_t) = (yyvsp[0].column_t); }
-#line 3572 "bison_parser.cpp"
+#line 3652 "bison_parser.cpp"
     break;
 
   case 55: /* table_elem: table_constraint  */
-#line 538 "bison_parser.y"
+#line 587 "bison_parser.y"
                    { (yyval.table_element_t) = (yyvsp[0].table_constraint_t); }
-#line 3578 "bison_parser.cpp"
+#line 3658 "bison_parser.cpp"
     break;
 
   case 56: /* column_def: IDENTIFIER column_type opt_column_constraints  */
-#line 540 "bison_parser.y"
+#line 589 "bison_parser.y"
                                                            {
   (yyval.column_t) = new ColumnDefinition((yyvsp[-2].sval), (yyvsp[-1].column_type_t), (yyvsp[0].column_constraint_vec));
   (yyval.column_t)->setNullableExplicit();
 }
-#line 3587 "bison_parser.cpp"
+#line 3667 "bison_parser.cpp"
     break;
 
   case 57: /* column_type: INT  */
-#line 545 "bison_parser.y"
+#line 594 "bison_parser.y"
                   { (yyval.column_type_t) = ColumnType{DataType::INT}; }
-#line 3593 "bison_parser.cpp"
+#line 3673 "bison_parser.cpp"
     break;
 
   case 58: /* column_type: CHAR '(' INTVAL ')'  */
-#line 546 "bison_parser.y"
+#line 595 "bison_parser.y"
                       { (yyval.column_type_t) = ColumnType{DataType::CHAR, (yyvsp[-1].ival)}; }
-#line 3599 "bison_parser.cpp"
+#line 3679 "bison_parser.cpp"
     break;
 
   case 59: /* column_type: CHARACTER_VARYING '(' INTVAL ')'  */
-#line 547 "bison_parser.y"
+#line 596 "bison_parser.y"
                                    { (yyval.column_type_t) = ColumnType{DataType::VARCHAR, (yyvsp[-1].ival)}; }
-#line 3605 "bison_parser.cpp"
+#line 3685 "bison_parser.cpp"
     break;
 
   case 60: /* column_type: DATE  */
-#line 548 "bison_parser.y"
+#line 597 "bison_parser.y"
        { (yyval.column_type_t) = ColumnType{DataType::DATE}; }
-#line 3611 "bison_parser.cpp"
+#line 3691 "bison_parser.cpp"
     break;
 
   case 61: /* column_type: DATETIME  */
-#line 549 "bison_parser.y"
+#line 598 "bison_parser.y"
            { (yyval.column_type_t) = ColumnType{DataType::DATETIME}; }
-#line 3617 "bison_parser.cpp"
+#line 3697 "bison_parser.cpp"
     break;
 
   case 62: /* column_type: DECIMAL opt_decimal_specification  */
-#line 550 "bison_parser.y"
+#line 599 "bison_parser.y"
                                     {
   (yyval.column_type_t) = ColumnType{DataType::DECIMAL, 0, (yyvsp[0].ival_pair)->first, (yyvsp[0].ival_pair)->second};
-  delete (yyvsp[0].ival_pair);
+  arenaDelete((yyvsp[0].ival_pair));
 }
-#line 3626 "bison_parser.cpp"
+#line 3706 "bison_parser.cpp"
     break;
 
   case 63: /* column_type: DOUBLE  */
-#line 554 "bison_parser.y"
+#line 603 "bison_parser.y"
          { (yyval.column_type_t) = ColumnType{DataType::DOUBLE}; }
-#line 3632 "bison_parser.cpp"
+#line 3712 "bison_parser.cpp"
     break;
 
   case 64: /* column_type: FLOAT  */
-#line 555 "bison_parser.y"
+#line 604 "bison_parser.y"
         { (yyval.column_type_t) = ColumnType{DataType::FLOAT}; }
-#line 3638 "bison_parser.cpp"
+#line 3718 "bison_parser.cpp"
     break;
 
   case 65: /* column_type: INTEGER  */
-#line 556 "bison_parser.y"
+#line 605 "bison_parser.y"
           { (yyval.column_type_t) = ColumnType{DataType::INT}; }
-#line 3644 "bison_parser.cpp"
+#line 3724 "bison_parser.cpp"
     break;
 
   case 66: /* column_type: LONG  */
-#line 557 "bison_parser.y"
+#line 606 "bison_parser.y"
        { (yyval.column_type_t) = ColumnType{DataType::LONG}; }
-#line 3650 "bison_parser.cpp"
+#line 3730 "bison_parser.cpp"
     break;
 
   case 67: /* column_type: REAL  */
-#line 558 "bison_parser.y"
+#line 607 "bison_parser.y"
        { (yyval.column_type_t) = ColumnType{DataType::REAL}; }
-#line 3656 "bison_parser.cpp"
+#line 3736 "bison_parser.cpp"
     break;
 
   case 68: /* column_type: SMALLINT  */
-#line 559 "bison_parser.y"
+#line 608 "bison_parser.y"
            { (yyval.column_type_t) = ColumnType{DataType::SMALLINT}; }
-#line 3662 "bison_parser.cpp"
+#line 3742 "bison_parser.cpp"
     break;
 
   case 69: /* column_type: TEXT  */
-#line 560 "bison_parser.y"
+#line 609 "bison_parser.y"
        { (yyval.column_type_t) = ColumnType{DataType::TEXT}; }
-#line 3668 "bison_parser.cpp"
+#line 3748 "bison_parser.cpp"
     break;
 
   case 70: /* column_type: TIME opt_time_precision  */
-#line 561 "bison_parser.y"
+#line 610 "bison_parser.y"
                           { (yyval.column_type_t) = ColumnType{DataType::TIME, 0, (yyvsp[0].ival)}; }
-#line 3674 "bison_parser.cpp"
+#line 3754 "bison_parser.cpp"
     break;
 
   case 71: /* column_type: VARCHAR '(' INTVAL ')'  */
-#line 562 "bison_parser.y"
+#line 611 "bison_parser.y"
                          { (yyval.column_type_t) = ColumnType{DataType::VARCHAR, (yyvsp[-1].ival)}; }
-#line 3680 "bison_parser.cpp"
+#line 3760 "bison_parser.cpp"
     break;
 
   case 72: /* opt_time_precision: '(' INTVAL ')'  */
-#line 564 "bison_parser.y"
+#line 613 "bison_parser.y"
                                     { (yyval.ival) = (yyvsp[-1].ival); }
-#line 3686 "bison_parser.cpp"
+#line 3766 "bison_parser.cpp"
     break;
 
   case 73: /* opt_time_precision: %empty  */
-#line 565 "bison_parser.y"
+#line 614 "bison_parser.y"
               { (yyval.ival) = 0; }
-#line 3692 "bison_parser.cpp"
+#line 3772 "bison_parser.cpp"
     break;
 
   case 74: /* opt_decimal_specification: '(' INTVAL ',' INTVAL ')'  */
-#line 567 "bison_parser.y"
-                                                      { (yyval.ival_pair) = new std::pair<int64_t, int64_t>{(yyvsp[-3].ival), (yyvsp[-1].ival)}; }
-#line 3698 "bison_parser.cpp"
+#line 616 "bison_parser.y"
+                                                      { (yyval.ival_pair) = arenaNew<std::pair<int64_t, int64_t>>((yyvsp[-3].ival), (yyvsp[-1].ival)); }
+#line 3778 "bison_parser.cpp"
     break;
 
   case 75: /* opt_decimal_specification: '(' INTVAL ')'  */
-#line 568 "bison_parser.y"
-                 { (yyval.ival_pair) = new std::pair<int64_t, int64_t>{(yyvsp[-1].ival), 0}; }
-#line 3704 "bison_parser.cpp"
+#line 617 "bison_parser.y"
+                 { (yyval.ival_pair) = arenaNew<std::pair<int64_t, int64_t>>((yyvsp[-1].ival), 0); }
+#line 3784 "bison_parser.cpp"
     break;
 
   case 76: /* opt_decimal_specification: %empty  */
-#line 569 "bison_parser.y"
-              { (yyval.ival_pair) = new std::pair<int64_t, int64_t>{0, 0}; }
-#line 3710 "bison_parser.cpp"
+#line 618 "bison_parser.y"
+              { (yyval.ival_pair) = arenaNew<std::pair<int64_t, int64_t>>(0, 0); }
+#line 3790 "bison_parser.cpp"
     break;
 
   case 77: /* opt_column_constraints: column_constraint_list  */
-#line 571 "bison_parser.y"
+#line 620 "bison_parser.y"
                                                 { (yyval.column_constraint_vec) = (yyvsp[0].column_constraint_vec); }
-#line 3716 "bison_parser.cpp"
+#line 3796 "bison_parser.cpp"
     break;
 
   case 78: /* opt_column_constraints: %empty  */
-#line 572 "bison_parser.y"
-              { (yyval.column_constraint_vec) = new std::vector<ConstraintType>(); }
-#line 3722 "bison_parser.cpp"
+#line 621 "bison_parser.y"
+              { (yyval.column_constraint_vec) = arenaNew<std::vector<ConstraintType>>(); }
+#line 3802 "bison_parser.cpp"
     break;
 
   case 79: /* column_constraint_list: column_constraint  */
-#line 574 "bison_parser.y"
+#line 623 "bison_parser.y"
                                            {
-  (yyval.column_constraint_vec) = new std::vector<ConstraintType>();
+  (yyval.column_constraint_vec) = arenaNew<std::vector<ConstraintType>>();
   (yyval.column_constraint_vec)->push_back((yyvsp[0].column_constraint_t));
 }
-#line 3731 "bison_parser.cpp"
+#line 3811 "bison_parser.cpp"
     break;
 
   case 80: /* column_constraint_list: column_constraint_list column_constraint  */
-#line 578 "bison_parser.y"
+#line 627 "bison_parser.y"
                                            {
   (yyvsp[-1].column_constraint_vec)->push_back((yyvsp[0].column_constraint_t));
   (yyval.column_constraint_vec) = (yyvsp[-1].column_constraint_vec);
 }
-#line 3740 "bison_parser.cpp"
+#line 3820 "bison_parser.cpp"
     break;
 
   case 81: /* column_constraint: PRIMARY KEY  */
-#line 583 "bison_parser.y"
+#line 632 "bison_parser.y"
                                 { (yyval.column_constraint_t) = ConstraintType::PrimaryKey; }
-#line 3746 "bison_parser.cpp"
+#line 3826 "bison_parser.cpp"
     break;
 
   case 82: /* column_constraint: UNIQUE  */
-#line 584 "bison_parser.y"
+#line 633 "bison_parser.y"
          { (yyval.column_constraint_t) = ConstraintType::Unique; }
-#line 3752 "bison_parser.cpp"
+#line 3832 "bison_parser.cpp"
     break;
 
   case 83: /* column_constraint: NULL  */
-#line 585 "bison_parser.y"
+#line 634 "bison_parser.y"
        { (yyval.column_constraint_t) = ConstraintType::Null; }
-#line 3758 "bison_parser.cpp"
+#line 3838 "bison_parser.cpp"
     break;
 
   case 84: /* column_constraint: NOT NULL  */
-#line 586 "bison_parser.y"
+#line 635 "bison_parser.y"
            { (yyval.column_constraint_t) = ConstraintType::NotNull; }
-#line 3764 "bison_parser.cpp"
+#line 3844 "bison_parser.cpp"
     break;
 
   case 85: /* table_constraint: PRIMARY KEY '(' ident_commalist ')'  */
-#line 588 "bison_parser.y"
+#line 637 "bison_parser.y"
                                                        { (yyval.table_constraint_t) = new TableConstraint(ConstraintType::PrimaryKey, (yyvsp[-1].str_vec)); }
-#line 3770 "bison_parser.cpp"
+#line 3850 "bison_parser.cpp"
     break;
 
   case 86: /* table_constraint: UNIQUE '(' ident_commalist ')'  */
-#line 589 "bison_parser.y"
+#line 638 "bison_parser.y"
                                  { (yyval.table_constraint_t) = new TableConstraint(ConstraintType::Unique, (yyvsp[-1].str_vec)); }
-#line 3776 "bison_parser.cpp"
+#line 3856 "bison_parser.cpp"
     break;
 
   case 87: /* drop_statement: DROP TABLE opt_exists table_name  */
-#line 597 "bison_parser.y"
+#line 646 "bison_parser.y"
                                                   {
   (yyval.drop_stmt) = new DropStatement(kDropTable);
   (yyval.drop_stmt)->ifExists = (yyvsp[-1].bval);
   (yyval.drop_stmt)->schema = (yyvsp[0].table_name).schema;
   (yyval.drop_stmt)->name = (yyvsp[0].table_name).name;
 }
-#line 3787 "bison_parser.cpp"
+#line 3867 "bison_parser.cpp"
     break;
 
   case 88: /* drop_statement: DROP VIEW opt_exists table_name  */
-#line 603 "bison_parser.y"
+#line 652 "bison_parser.y"
                                   {
   (yyval.drop_stmt) = new DropStatement(kDropView);
   (yyval.drop_stmt)->ifExists = (yyvsp[-1].bval);
   (yyval.drop_stmt)->schema = (yyvsp[0].table_name).schema;
   (yyval.drop_stmt)->name = (yyvsp[0].table_name).name;
 }
-#line 3798 "bison_parser.cpp"
+#line 3878 "bison_parser.cpp"
     break;
 
   case 89: /* drop_statement: DEALLOCATE PREPARE IDENTIFIER  */
-#line 609 "bison_parser.y"
+#line 658 "bison_parser.y"
                                 {
   (yyval.drop_stmt) = new DropStatement(kDropPreparedStatement);
   (yyval.drop_stmt)->ifExists = false;
   (yyval.drop_stmt)->name = (yyvsp[0].sval);
 }
-#line 3808 "bison_parser.cpp"
+#line 3888 "bison_parser.cpp"
     break;
 
   case 90: /* drop_statement: DROP INDEX opt_exists IDENTIFIER  */
-#line 615 "bison_parser.y"
+#line 664 "bison_parser.y"
                                    {
   (yyval.drop_stmt) = new DropStatement(kDropIndex);
   (yyval.drop_stmt)->ifExists = (yyvsp[-1].bval);
   (yyval.drop_stmt)->indexName = (yyvsp[0].sval);
 }
-#line 3818 "bison_parser.cpp"
+#line 3898 "bison_parser.cpp"
     break;
 
   case 91: /* opt_exists: IF EXISTS  */
-#line 621 "bison_parser.y"
+#line 670 "bison_parser.y"
                        { (yyval.bval) = true; }
-#line 3824 "bison_parser.cpp"
+#line 3904 "bison_parser.cpp"
     break;
 
   case 92: /* opt_exists: %empty  */
-#line 622 "bison_parser.y"
+#line 671 "bison_parser.y"
               { (yyval.bval) = false; }
-#line 3830 "bison_parser.cpp"
+#line 3910 "bison_parser.cpp"
     break;
 
   case 93: /* alter_statement: ALTER TABLE opt_exists table_name alter_action  */
-#line 629 "bison_parser.y"
+#line 678 "bison_parser.y"
                                                                  {
   (yyval.alter_stmt) = new AlterStatement((yyvsp[-1].table_name).name, (yyvsp[0].alter_action_t));
   (yyval.alter_stmt)->ifTableExists = (yyvsp[-2].bval);
   (yyval.alter_stmt)->schema = (yyvsp[-1].table_name).schema;
 }
-#line 3840 "bison_parser.cpp"
+#line 3920 "bison_parser.cpp"
     break;
 
   case 94: /* alter_action: drop_action  */
-#line 635 "bison_parser.y"
+#line 684 "bison_parser.y"
                            { (yyval.alter_action_t) = (yyvsp[0].drop_action_t); }
-#line 3846 "bison_parser.cpp"
+#line 3926 "bison_parser.cpp"
     break;
 
   case 95: /* drop_action: DROP COLUMN opt_exists IDENTIFIER  */
-#line 637 "bison_parser.y"
+#line 686 "bison_parser.y"
                                                 {
   (yyval.drop_action_t) = new DropColumnAction((yyvsp[0].sval));
   (yyval.drop_action_t)->ifExists = (yyvsp[-1].bval);
 }
-#line 3855 "bison_parser.cpp"
+#line 3935 "bison_parser.cpp"
     break;
 
   case 96: /* delete_statement: DELETE FROM table_name opt_where  */
-#line 647 "bison_parser.y"
+#line 696 "bison_parser.y"
                                                     {
   (yyval.delete_stmt) = new DeleteStatement();
   (yyval.delete_stmt)->schema = (yyvsp[-1].table_name).schema;
   (yyval.delete_stmt)->tableName = (yyvsp[-1].table_name).name;
   (yyval.delete_stmt)->expr = (yyvsp[0].expr);
 }
-#line 3866 "bison_parser.cpp"
+#line 3946 "bison_parser.cpp"
     break;
 
   case 97: /* truncate_statement: TRUNCATE table_name  */
-#line 654 "bison_parser.y"
+#line 703 "bison_parser.y"
                                          {
   (yyval.delete_stmt) = new DeleteStatement();
   (yyval.delete_stmt)->schema = (yyvsp[0].table_name).schema;
   (yyval.delete_stmt)->tableName = (yyvsp[0].table_name).name;
 }
-#line 3876 "bison_parser.cpp"
+#line 3956 "bison_parser.cpp"
     break;
 
   case 98: /* insert_statement: INSERT INTO table_name opt_column_list VALUES '(' literal_list ')'  */
-#line 665 "bison_parser.y"
+#line 714 "bison_parser.y"
                                                                                       {
   (yyval.insert_stmt) = new InsertStatement(kInsertValues);
   (yyval.insert_stmt)->schema = (yyvsp[-5].table_name).schema;
@@ -3884,11 +3964,23 @@ yyreduce:
   (yyval.insert_stmt)->columns = (yyvsp[-4].str_vec);
   (yyval.insert_stmt)->values = (yyvsp[-1].expr_vec);
 }
-#line 3888 "bison_parser.cpp"
+#line 3968 "bison_parser.cpp"
+    break;
+
+  case 99: /* insert_statement: INSERT INTO table_name opt_column_list VALUES values_list  */
+#line 721 "bison_parser.y"
+                                                            {
+  (yyval.insert_stmt) = new InsertStatement(kInsertValues);
+  (yyval.insert_stmt)->schema = (yyvsp[-3].table_name).schema;
+  (yyval.insert_stmt)->tableName = (yyvsp[-3].table_name).name;
+  (yyval.insert_stmt)->columns = (yyvsp[-2].str_vec);
+  (yyval.insert_stmt)->rows = (yyvsp[0].values_list);
+}
+#line 3980 "bison_parser.cpp"
     break;
 
-  case 99: /* insert_statement: INSERT INTO table_name opt_column_list select_no_paren  */
-#line 672 "bison_parser.y"
+  case 100: /* insert_statement: INSERT INTO table_name opt_column_list select_no_paren  */
+#line 728 "bison_parser.y"
                                                          {
   (yyval.insert_stmt) = new InsertStatement(kInsertSelect);
   (yyval.insert_stmt)->schema = (yyvsp[-2].table_name).schema;
@@ -3896,84 +3988,237 @@ yyreduce:
   (yyval.insert_stmt)->columns = (yyvsp[-1].str_vec);
   (yyval.insert_stmt)->select = (yyvsp[0].select_stmt);
 }
-#line 3900 "bison_parser.cpp"
+#line 3992 "bison_parser.cpp"
     break;
 
-  case 100: /* opt_column_list: '(' ident_commalist ')'  */
-#line 680 "bison_parser.y"
+  case 101: /* opt_column_list: '(' ident_commalist ')'  */
+#line 736 "bison_parser.y"
                                           { (yyval.str_vec) = (yyvsp[-1].str_vec); }
-#line 3906 "bison_parser.cpp"
+#line 3998 "bison_parser.cpp"
     break;
 
-  case 101: /* opt_column_list: %empty  */
-#line 681 "bison_parser.y"
+  case 102: /* opt_column_list: %empty  */
+#line 737 "bison_parser.y"
               { (yyval.str_vec) = nullptr; }
-#line 3912 "bison_parser.cpp"
+#line 4004 "bison_parser.cpp"
+    break;
+
+  case 103: /* values_list: values_rows ')'  */
+#line 740 "bison_parser.y"
+                              {
+  (yyval.values_list) = (yyvsp[-1].values_list);
+  if (!(yyval.values_list)->endRow()) {
+    yyerror(&(yylsp[0]), result, scanner, "VALUES lists must all be the same length.");
+    deleteValuesList((yyval.values_list));
+    YYERROR;
+  }
+}
+#line 4017 "bison_parser.cpp"
+    break;
+
+  case 104: /* values_rows: values_row_begin values_cell  */
+#line 749 "bison_parser.y"
+                                           {
+  // The first value of a row always fits.
+  (yyval.values_list) = (yyvsp[-1].values_list);
+  (yyval.values_list)->append((yyvsp[0].values_cell));
+}
+#line 4027 "bison_parser.cpp"
+    break;
+
+  case 105: /* values_rows: values_rows ',' values_cell  */
+#line 754 "bison_parser.y"
+                              {
+  (yyval.values_list) = (yyvsp[-2].values_list);
+  if (!(yyval.values_list)->append((yyvsp[0].values_cell))) {
+    yyerror(&(yylsp[0]), result, scanner, "VALUES lists must all be the same length.");
+    deleteValuesList((yyval.values_list));
+    YYERROR;
+  }
+}
+#line 4040 "bison_parser.cpp"
     break;
 
-  case 102: /* update_statement: UPDATE table_ref_name_no_alias SET update_clause_commalist opt_where  */
-#line 688 "bison_parser.y"
+  case 106: /* values_row_begin: '(' literal_list ')' ',' '('  */
+#line 763 "bison_parser.y"
+                                                {
+  (yyval.values_list) = arenaNew<ValuesList>();
+  (yyval.values_list)->appendLiterals((yyvsp[-3].expr_vec));
+  (yyval.values_list)->endRow();
+}
+#line 4050 "bison_parser.cpp"
+    break;
+
+  case 107: /* values_row_begin: values_rows ')' ',' '('  */
+#line 768 "bison_parser.y"
+                          {
+  (yyval.values_list) = (yyvsp[-3].values_list);
+  if (!(yyval.values_list)->endRow()) {
+    yyerror(&(yylsp[-2]), result, scanner, "VALUES lists must all be the same length.");
+    deleteValuesList((yyval.values_list));
+    YYERROR;
+  }
+}
+#line 4063 "bison_parser.cpp"
+    break;
+
+  case 108: /* values_cell: STRING  */
+#line 777 "bison_parser.y"
+                     {
+  (yyval.values_cell).type = kExprLiteralString;
+  (yyval.values_cell).isBool = false;
+  (yyval.values_cell).sval = (yyvsp[0].sval);
+}
+#line 4073 "bison_parser.cpp"
+    break;
+
+  case 109: /* values_cell: INTVAL  */
+#line 782 "bison_parser.y"
+         {
+  (yyval.values_cell).type = kExprLiteralInt;
+  (yyval.values_cell).isBool = false;
+  (yyval.values_cell).ival = (yyvsp[0].ival);
+}
+#line 4083 "bison_parser.cpp"
+    break;
+
+  case 110: /* values_cell: FLOATVAL  */
+#line 787 "bison_parser.y"
+           {
+  (yyval.values_cell).type = kExprLiteralFloat;
+  (yyval.values_cell).isBool = false;
+  (yyval.values_cell).fval = (yyvsp[0].fval);
+}
+#line 4093 "bison_parser.cpp"
+    break;
+
+  case 111: /* values_cell: TRUE  */
+#line 792 "bison_parser.y"
+       {
+  (yyval.values_cell).type = kExprLiteralInt;
+  (yyval.values_cell).isBool = true;
+  (yyval.values_cell).ival = 1;
+}
+#line 4103 "bison_parser.cpp"
+    break;
+
+  case 112: /* values_cell: FALSE  */
+#line 797 "bison_parser.y"
+        {
+  (yyval.values_cell).type = kExprLiteralInt;
+  (yyval.values_cell).isBool = true;
+  (yyval.values_cell).ival = 0;
+}
+#line 4113 "bison_parser.cpp"
+    break;
+
+  case 113: /* values_cell: NULL  */
+#line 802 "bison_parser.y"
+       {
+  (yyval.values_cell).type = kExprLiteralNull;
+  (yyval.values_cell).isBool = false;
+}
+#line 4122 "bison_parser.cpp"
+    break;
+
+  case 114: /* values_cell: DATE STRING  */
+#line 806 "bison_parser.y"
+              {
+  if (!isValidDate((yyvsp[0].sval))) {
+    arenaFree((yyvsp[0].sval));
+    yyerror(&yyloc, result, scanner, "Found incorrect date format. Expected format: YYYY-MM-DD");
+    YYERROR;
+  }
+  (yyval.values_cell).type = kExprLiteralDate;
+  (yyval.values_cell).isBool = false;
+  (yyval.values_cell).sval = (yyvsp[0].sval);
+}
+#line 4137 "bison_parser.cpp"
+    break;
+
+  case 115: /* values_cell: interval_literal  */
+#line 816 "bison_parser.y"
+                   {
+  (yyval.values_cell).type = kExprLiteralInterval;
+  (yyval.values_cell).isBool = false;
+  (yyval.values_cell).expr = (yyvsp[0].expr);
+}
+#line 4147 "bison_parser.cpp"
+    break;
+
+  case 116: /* values_cell: param_expr  */
+#line 821 "bison_parser.y"
+             {
+  (yyval.values_cell).type = kExprParameter;
+  (yyval.values_cell).isBool = false;
+  (yyval.values_cell).expr = (yyvsp[0].expr);
+}
+#line 4157 "bison_parser.cpp"
+    break;
+
+  case 117: /* update_statement: UPDATE table_ref_name_no_alias SET update_clause_commalist opt_where  */
+#line 832 "bison_parser.y"
                                                                                         {
   (yyval.update_stmt) = new UpdateStatement();
   (yyval.update_stmt)->table = (yyvsp[-3].table);
   (yyval.update_stmt)->updates = (yyvsp[-1].update_vec);
   (yyval.update_stmt)->where = (yyvsp[0].expr);
 }
-#line 3923 "bison_parser.cpp"
+#line 4168 "bison_parser.cpp"
     break;
 
-  case 103: /* update_clause_commalist: update_clause  */
-#line 695 "bison_parser.y"
+  case 118: /* update_clause_commalist: update_clause  */
+#line 839 "bison_parser.y"
                                         {
-  (yyval.update_vec) = new std::vector<UpdateClause*>();
+  (yyval.update_vec) = arenaNew<std::vector<UpdateClause*>>();
   (yyval.update_vec)->push_back((yyvsp[0].update_t));
 }
-#line 3932 "bison_parser.cpp"
+#line 4177 "bison_parser.cpp"
     break;
 
-  case 104: /* update_clause_commalist: update_clause_commalist ',' update_clause  */
-#line 699 "bison_parser.y"
+  case 119: /* update_clause_commalist: update_clause_commalist ',' update_clause  */
+#line 843 "bison_parser.y"
                                             {
   (yyvsp[-2].update_vec)->push_back((yyvsp[0].update_t));
   (yyval.update_vec) = (yyvsp[-2].update_vec);
 }
-#line 3941 "bison_parser.cpp"
+#line 4186 "bison_parser.cpp"
     break;
 
-  case 105: /* update_clause: IDENTIFIER '=' expr  */
-#line 704 "bison_parser.y"
+  case 120: /* update_clause: IDENTIFIER '=' expr  */
+#line 848 "bison_parser.y"
                                     {
   (yyval.update_t) = new UpdateClause();
   (yyval.update_t)->column = (yyvsp[-2].sval);
   (yyval.update_t)->value = (yyvsp[0].expr);
 }
-#line 3951 "bison_parser.cpp"
+#line 4196 "bison_parser.cpp"
     break;
 
-  case 106: /* select_statement: opt_with_clause select_with_paren  */
-#line 714 "bison_parser.y"
+  case 121: /* select_statement: opt_with_clause select_with_paren  */
+#line 858 "bison_parser.y"
                                                      {
   (yyval.select_stmt) = (yyvsp[0].select_stmt);
   (yyval.select_stmt)->withDescriptions = (yyvsp[-1].with_description_vec);
 }
-#line 3960 "bison_parser.cpp"
+#line 4205 "bison_parser.cpp"
     break;
 
-  case 107: /* select_statement: opt_with_clause select_no_paren  */
-#line 718 "bison_parser.y"
+  case 122: /* select_statement: opt_with_clause select_no_paren  */
+#line 862 "bison_parser.y"
                                   {
   (yyval.select_stmt) = (yyvsp[0].select_stmt);
   (yyval.select_stmt)->withDescriptions = (yyvsp[-1].with_description_vec);
 }
-#line 3969 "bison_parser.cpp"
+#line 4214 "bison_parser.cpp"
     break;
 
-  case 108: /* select_statement: opt_with_clause select_with_paren set_operator select_within_set_operation opt_order opt_limit  */
-#line 722 "bison_parser.y"
+  case 123: /* select_statement: opt_with_clause select_with_paren set_operator select_within_set_operation opt_order opt_limit  */
+#line 866 "bison_parser.y"
                                                                                                  {
   (yyval.select_stmt) = (yyvsp[-4].select_stmt);
   if ((yyval.select_stmt)->setOperations == nullptr) {
-    (yyval.select_stmt)->setOperations = new std::vector<SetOperation*>();
+    (yyval.select_stmt)->setOperations = arenaNew<std::vector<SetOperation*>>();
   }
   (yyval.select_stmt)->setOperations->push_back((yyvsp[-3].set_operator_t));
   (yyval.select_stmt)->setOperations->back()->nestedSelectStatement = (yyvsp[-2].select_stmt);
@@ -3981,120 +4226,120 @@ yyreduce:
   (yyval.select_stmt)->setOperations->back()->resultLimit = (yyvsp[0].limit);
   (yyval.select_stmt)->withDescriptions = (yyvsp[-5].with_description_vec);
 }
-#line 3985 "bison_parser.cpp"
+#line 4230 "bison_parser.cpp"
     break;
 
-  case 111: /* select_within_set_operation_no_parentheses: select_clause  */
-#line 736 "bison_parser.y"
+  case 126: /* select_within_set_operation_no_parentheses: select_clause  */
+#line 880 "bison_parser.y"
                                                            { (yyval.select_stmt) = (yyvsp[0].select_stmt); }
-#line 3991 "bison_parser.cpp"
+#line 4236 "bison_parser.cpp"
     break;
 
-  case 112: /* select_within_set_operation_no_parentheses: select_clause set_operator select_within_set_operation  */
-#line 737 "bison_parser.y"
+  case 127: /* select_within_set_operation_no_parentheses: select_clause set_operator select_within_set_operation  */
+#line 881 "bison_parser.y"
                                                          {
   (yyval.select_stmt) = (yyvsp[-2].select_stmt);
   if ((yyval.select_stmt)->setOperations == nullptr) {
-    (yyval.select_stmt)->setOperations = new std::vector<SetOperation*>();
+    (yyval.select_stmt)->setOperations = arenaNew<std::vector<SetOperation*>>();
   }
   (yyval.select_stmt)->setOperations->push_back((yyvsp[-1].set_operator_t));
   (yyval.select_stmt)->setOperations->back()->nestedSelectStatement = (yyvsp[0].select_stmt);
 }
-#line 4004 "bison_parser.cpp"
+#line 4249 "bison_parser.cpp"
     break;
 
-  case 113: /* select_with_paren: '(' select_no_paren ')'  */
-#line 746 "bison_parser.y"
+  case 128: /* select_with_paren: '(' select_no_paren ')'  */
+#line 890 "bison_parser.y"
                                             { (yyval.select_stmt) = (yyvsp[-1].select_stmt); }
-#line 4010 "bison_parser.cpp"
+#line 4255 "bison_parser.cpp"
     break;
 
-  case 114: /* select_with_paren: '(' select_with_paren ')'  */
-#line 747 "bison_parser.y"
+  case 129: /* select_with_paren: '(' select_with_paren ')'  */
+#line 891 "bison_parser.y"
                             { (yyval.select_stmt) = (yyvsp[-1].select_stmt); }
-#line 4016 "bison_parser.cpp"
+#line 4261 "bison_parser.cpp"
     break;
 
-  case 115: /* select_no_paren: select_clause opt_order opt_limit  */
-#line 749 "bison_parser.y"
+  case 130: /* select_no_paren: select_clause opt_order opt_limit  */
+#line 893 "bison_parser.y"
                                                     {
   (yyval.select_stmt) = (yyvsp[-2].select_stmt);
   (yyval.select_stmt)->order = (yyvsp[-1].order_vec);
 
   // Limit could have been set by TOP.
   if ((yyvsp[0].limit) != nullptr) {
-    delete (yyval.select_stmt)->limit;
+    arenaDelete((yyval.select_stmt)->limit);
     (yyval.select_stmt)->limit = (yyvsp[0].limit);
   }
 }
-#line 4031 "bison_parser.cpp"
+#line 4276 "bison_parser.cpp"
     break;
 
-  case 116: /* select_no_paren: select_clause set_operator select_within_set_operation opt_order opt_limit  */
-#line 759 "bison_parser.y"
+  case 131: /* select_no_paren: select_clause set_operator select_within_set_operation opt_order opt_limit  */
+#line 903 "bison_parser.y"
                                                                              {
   (yyval.select_stmt) = (yyvsp[-4].select_stmt);
   if ((yyval.select_stmt)->setOperations == nullptr) {
-    (yyval.select_stmt)->setOperations = new std::vector<SetOperation*>();
+    (yyval.select_stmt)->setOperations = arenaNew<std::vector<SetOperation*>>();
   }
   (yyval.select_stmt)->setOperations->push_back((yyvsp[-3].set_operator_t));
   (yyval.select_stmt)->setOperations->back()->nestedSelectStatement = (yyvsp[-2].select_stmt);
   (yyval.select_stmt)->setOperations->back()->resultOrder = (yyvsp[-1].order_vec);
   (yyval.select_stmt)->setOperations->back()->resultLimit = (yyvsp[0].limit);
 }
-#line 4046 "bison_parser.cpp"
+#line 4291 "bison_parser.cpp"
     break;
 
-  case 117: /* set_operator: set_type opt_all  */
-#line 770 "bison_parser.y"
+  case 132: /* set_operator: set_type opt_all  */
+#line 914 "bison_parser.y"
                                 {
   (yyval.set_operator_t) = (yyvsp[-1].set_operator_t);
   (yyval.set_operator_t)->isAll = (yyvsp[0].bval);
 }
-#line 4055 "bison_parser.cpp"
+#line 4300 "bison_parser.cpp"
     break;
 
-  case 118: /* set_type: UNION  */
-#line 775 "bison_parser.y"
+  case 133: /* set_type: UNION  */
+#line 919 "bison_parser.y"
                  {
   (yyval.set_operator_t) = new SetOperation();
   (yyval.set_operator_t)->setType = SetType::kSetUnion;
 }
-#line 4064 "bison_parser.cpp"
+#line 4309 "bison_parser.cpp"
     break;
 
-  case 119: /* set_type: INTERSECT  */
-#line 779 "bison_parser.y"
+  case 134: /* set_type: INTERSECT  */
+#line 923 "bison_parser.y"
             {
   (yyval.set_operator_t) = new SetOperation();
   (yyval.set_operator_t)->setType = SetType::kSetIntersect;
 }
-#line 4073 "bison_parser.cpp"
+#line 4318 "bison_parser.cpp"
     break;
 
-  case 120: /* set_type: EXCEPT  */
-#line 783 "bison_parser.y"
+  case 135: /* set_type: EXCEPT  */
+#line 927 "bison_parser.y"
          {
   (yyval.set_operator_t) = new SetOperation();
   (yyval.set_operator_t)->setType = SetType::kSetExcept;
 }
-#line 4082 "bison_parser.cpp"
+#line 4327 "bison_parser.cpp"
     break;
 
-  case 121: /* opt_all: ALL  */
-#line 788 "bison_parser.y"
+  case 136: /* opt_all: ALL  */
+#line 932 "bison_parser.y"
               { (yyval.bval) = true; }
-#line 4088 "bison_parser.cpp"
+#line 4333 "bison_parser.cpp"
     break;
 
-  case 122: /* opt_all: %empty  */
-#line 789 "bison_parser.y"
+  case 137: /* opt_all: %empty  */
+#line 933 "bison_parser.y"
               { (yyval.bval) = false; }
-#line 4094 "bison_parser.cpp"
+#line 4339 "bison_parser.cpp"
     break;
 
-  case 123: /* select_clause: SELECT opt_top opt_distinct select_list opt_from_clause opt_where opt_group  */
-#line 791 "bison_parser.y"
+  case 138: /* select_clause: SELECT opt_top opt_distinct select_list opt_from_clause opt_where opt_group  */
+#line 935 "bison_parser.y"
                                                                                             {
   (yyval.select_stmt) = new SelectStatement();
   (yyval.select_stmt)->limit = (yyvsp[-5].limit);
@@ -4104,698 +4349,699 @@ yyreduce:
   (yyval.select_stmt)->whereClause = (yyvsp[-1].expr);
   (yyval.select_stmt)->groupBy = (yyvsp[0].group_t);
 }
-#line 4108 "bison_parser.cpp"
+#line 4353 "bison_parser.cpp"
     break;
 
-  case 124: /* opt_distinct: DISTINCT  */
-#line 801 "bison_parser.y"
+  case 139: /* opt_distinct: DISTINCT  */
+#line 945 "bison_parser.y"
                         { (yyval.bval) = true; }
-#line 4114 "bison_parser.cpp"
+#line 4359 "bison_parser.cpp"
     break;
 
-  case 125: /* opt_distinct: %empty  */
-#line 802 "bison_parser.y"
+  case 140: /* opt_distinct: %empty  */
+#line 946 "bison_parser.y"
               { (yyval.bval) = false; }
-#line 4120 "bison_parser.cpp"
+#line 4365 "bison_parser.cpp"
     break;
 
-  case 127: /* opt_from_clause: from_clause  */
-#line 806 "bison_parser.y"
+  case 142: /* opt_from_clause: from_clause  */
+#line 950 "bison_parser.y"
                               { (yyval.table) = (yyvsp[0].table); }
-#line 4126 "bison_parser.cpp"
+#line 4371 "bison_parser.cpp"
     break;
 
-  case 128: /* opt_from_clause: %empty  */
-#line 807 "bison_parser.y"
+  case 143: /* opt_from_clause: %empty  */
+#line 951 "bison_parser.y"
               { (yyval.table) = nullptr; }
-#line 4132 "bison_parser.cpp"
+#line 4377 "bison_parser.cpp"
     break;
 
-  case 129: /* from_clause: FROM table_ref  */
-#line 809 "bison_parser.y"
+  case 144: /* from_clause: FROM table_ref  */
+#line 953 "bison_parser.y"
                              { (yyval.table) = (yyvsp[0].table); }
-#line 4138 "bison_parser.cpp"
+#line 4383 "bison_parser.cpp"
     break;
 
-  case 130: /* opt_where: WHERE expr  */
-#line 811 "bison_parser.y"
+  case 145: /* opt_where: WHERE expr  */
+#line 955 "bison_parser.y"
                        { (yyval.expr) = (yyvsp[0].expr); }
-#line 4144 "bison_parser.cpp"
+#line 4389 "bison_parser.cpp"
     break;
 
-  case 131: /* opt_where: %empty  */
-#line 812 "bison_parser.y"
+  case 146: /* opt_where: %empty  */
+#line 956 "bison_parser.y"
               { (yyval.expr) = nullptr; }
-#line 4150 "bison_parser.cpp"
+#line 4395 "bison_parser.cpp"
     break;
 
-  case 132: /* opt_group: GROUP BY expr_list opt_having  */
-#line 814 "bison_parser.y"
+  case 147: /* opt_group: GROUP BY expr_list opt_having  */
+#line 958 "bison_parser.y"
                                           {
   (yyval.group_t) = new GroupByDescription();
   (yyval.group_t)->columns = (yyvsp[-1].expr_vec);
   (yyval.group_t)->having = (yyvsp[0].expr);
 }
-#line 4160 "bison_parser.cpp"
+#line 4405 "bison_parser.cpp"
     break;
 
-  case 133: /* opt_group: %empty  */
-#line 819 "bison_parser.y"
+  case 148: /* opt_group: %empty  */
+#line 963 "bison_parser.y"
               { (yyval.group_t) = nullptr; }
-#line 4166 "bison_parser.cpp"
+#line 4411 "bison_parser.cpp"
     break;
 
-  case 134: /* opt_having: HAVING expr  */
-#line 821 "bison_parser.y"
+  case 149: /* opt_having: HAVING expr  */
+#line 965 "bison_parser.y"
                          { (yyval.expr) = (yyvsp[0].expr); }
-#line 4172 "bison_parser.cpp"
+#line 4417 "bison_parser.cpp"
     break;
 
-  case 135: /* opt_having: %empty  */
-#line 822 "bison_parser.y"
+  case 150: /* opt_having: %empty  */
+#line 966 "bison_parser.y"
               { (yyval.expr) = nullptr; }
-#line 4178 "bison_parser.cpp"
+#line 4423 "bison_parser.cpp"
     break;
 
-  case 136: /* opt_order: ORDER BY order_list  */
-#line 824 "bison_parser.y"
+  case 151: /* opt_order: ORDER BY order_list  */
+#line 968 "bison_parser.y"
                                 { (yyval.order_vec) = (yyvsp[0].order_vec); }
-#line 4184 "bison_parser.cpp"
+#line 4429 "bison_parser.cpp"
     break;
 
-  case 137: /* opt_order: %empty  */
-#line 825 "bison_parser.y"
+  case 152: /* opt_order: %empty  */
+#line 969 "bison_parser.y"
               { (yyval.order_vec) = nullptr; }
-#line 4190 "bison_parser.cpp"
+#line 4435 "bison_parser.cpp"
     break;
 
-  case 138: /* order_list: order_desc  */
-#line 827 "bison_parser.y"
+  case 153: /* order_list: order_desc  */
+#line 971 "bison_parser.y"
                         {
-  (yyval.order_vec) = new std::vector<OrderDescription*>();
+  (yyval.order_vec) = arenaNew<std::vector<OrderDescription*>>();
   (yyval.order_vec)->push_back((yyvsp[0].order));
 }
-#line 4199 "bison_parser.cpp"
+#line 4444 "bison_parser.cpp"
     break;
 
-  case 139: /* order_list: order_list ',' order_desc  */
-#line 831 "bison_parser.y"
+  case 154: /* order_list: order_list ',' order_desc  */
+#line 975 "bison_parser.y"
                             {
   (yyvsp[-2].order_vec)->push_back((yyvsp[0].order));
   (yyval.order_vec) = (yyvsp[-2].order_vec);
 }
-#line 4208 "bison_parser.cpp"
+#line 4453 "bison_parser.cpp"
     break;
 
-  case 140: /* order_desc: expr opt_order_type  */
-#line 836 "bison_parser.y"
+  case 155: /* order_desc: expr opt_order_type  */
+#line 980 "bison_parser.y"
                                  { (yyval.order) = new OrderDescription((yyvsp[0].order_type), (yyvsp[-1].expr)); }
-#line 4214 "bison_parser.cpp"
+#line 4459 "bison_parser.cpp"
     break;
 
-  case 141: /* opt_order_type: ASC  */
-#line 838 "bison_parser.y"
+  case 156: /* opt_order_type: ASC  */
+#line 982 "bison_parser.y"
                      { (yyval.order_type) = kOrderAsc; }
-#line 4220 "bison_parser.cpp"
+#line 4465 "bison_parser.cpp"
     break;
 
-  case 142: /* opt_order_type: DESC  */
-#line 839 "bison_parser.y"
+  case 157: /* opt_order_type: DESC  */
+#line 983 "bison_parser.y"
        { (yyval.order_type) = kOrderDesc; }
-#line 4226 "bison_parser.cpp"
+#line 4471 "bison_parser.cpp"
     break;
 
-  case 143: /* opt_order_type: %empty  */
-#line 840 "bison_parser.y"
+  case 158: /* opt_order_type: %empty  */
+#line 984 "bison_parser.y"
               { (yyval.order_type) = kOrderAsc; }
-#line 4232 "bison_parser.cpp"
+#line 4477 "bison_parser.cpp"
     break;
 
-  case 144: /* opt_top: TOP int_literal  */
-#line 844 "bison_parser.y"
+  case 159: /* opt_top: TOP int_literal  */
+#line 988 "bison_parser.y"
                           { (yyval.limit) = new LimitDescription((yyvsp[0].expr), nullptr); }
-#line 4238 "bison_parser.cpp"
+#line 4483 "bison_parser.cpp"
     break;
 
-  case 145: /* opt_top: %empty  */
-#line 845 "bison_parser.y"
+  case 160: /* opt_top: %empty  */
+#line 989 "bison_parser.y"
               { (yyval.limit) = nullptr; }
-#line 4244 "bison_parser.cpp"
+#line 4489 "bison_parser.cpp"
     break;
 
-  case 146: /* opt_limit: LIMIT expr  */
-#line 847 "bison_parser.y"
+  case 161: /* opt_limit: LIMIT expr  */
+#line 991 "bison_parser.y"
                        { (yyval.limit) = new LimitDescription((yyvsp[0].expr), nullptr); }
-#line 4250 "bison_parser.cpp"
+#line 4495 "bison_parser.cpp"
     break;
 
-  case 147: /* opt_limit: OFFSET expr  */
-#line 848 "bison_parser.y"
+  case 162: /* opt_limit: OFFSET expr  */
+#line 992 "bison_parser.y"
               { (yyval.limit) = new LimitDescription(nullptr, (yyvsp[0].expr)); }
-#line 4256 "bison_parser.cpp"
+#line 4501 "bison_parser.cpp"
     break;
 
-  case 148: /* opt_limit: LIMIT expr OFFSET expr  */
-#line 849 "bison_parser.y"
+  case 163: /* opt_limit: LIMIT expr OFFSET expr  */
+#line 993 "bison_parser.y"
                          { (yyval.limit) = new LimitDescription((yyvsp[-2].expr), (yyvsp[0].expr)); }
-#line 4262 "bison_parser.cpp"
+#line 4507 "bison_parser.cpp"
     break;
 
-  case 149: /* opt_limit: LIMIT ALL  */
-#line 850 "bison_parser.y"
+  case 164: /* opt_limit: LIMIT ALL  */
+#line 994 "bison_parser.y"
             { (yyval.limit) = new LimitDescription(nullptr, nullptr); }
-#line 4268 "bison_parser.cpp"
+#line 4513 "bison_parser.cpp"
     break;
 
-  case 150: /* opt_limit: LIMIT ALL OFFSET expr  */
-#line 851 "bison_parser.y"
+  case 165: /* opt_limit: LIMIT ALL OFFSET expr  */
+#line 995 "bison_parser.y"
                         { (yyval.limit) = new LimitDescription(nullptr, (yyvsp[0].expr)); }
-#line 4274 "bison_parser.cpp"
+#line 4519 "bison_parser.cpp"
     break;
 
-  case 151: /* opt_limit: %empty  */
-#line 852 "bison_parser.y"
+  case 166: /* opt_limit: %empty  */
+#line 996 "bison_parser.y"
               { (yyval.limit) = nullptr; }
-#line 4280 "bison_parser.cpp"
+#line 4525 "bison_parser.cpp"
     break;
 
-  case 152: /* expr_list: expr_alias  */
-#line 857 "bison_parser.y"
+  case 167: /* expr_list: expr_alias  */
+#line 1001 "bison_parser.y"
                        {
-  (yyval.expr_vec) = new std::vector<Expr*>();
+  (yyval.expr_vec) = arenaNew<std::vector<Expr*>>();
   (yyval.expr_vec)->push_back((yyvsp[0].expr));
 }
-#line 4289 "bison_parser.cpp"
+#line 4534 "bison_parser.cpp"
     break;
 
-  case 153: /* expr_list: expr_list ',' expr_alias  */
-#line 861 "bison_parser.y"
+  case 168: /* expr_list: expr_list ',' expr_alias  */
+#line 1005 "bison_parser.y"
                            {
   (yyvsp[-2].expr_vec)->push_back((yyvsp[0].expr));
   (yyval.expr_vec) = (yyvsp[-2].expr_vec);
 }
-#line 4298 "bison_parser.cpp"
+#line 4543 "bison_parser.cpp"
     break;
 
-  case 154: /* opt_literal_list: literal_list  */
-#line 866 "bison_parser.y"
+  case 169: /* opt_literal_list: literal_list  */
+#line 1010 "bison_parser.y"
                                 { (yyval.expr_vec) = (yyvsp[0].expr_vec); }
-#line 4304 "bison_parser.cpp"
+#line 4549 "bison_parser.cpp"
     break;
 
-  case 155: /* opt_literal_list: %empty  */
-#line 867 "bison_parser.y"
+  case 170: /* opt_literal_list: %empty  */
+#line 1011 "bison_parser.y"
               { (yyval.expr_vec) = nullptr; }
-#line 4310 "bison_parser.cpp"
+#line 4555 "bison_parser.cpp"
     break;
 
-  case 156: /* literal_list: literal  */
-#line 869 "bison_parser.y"
+  case 171: /* literal_list: literal  */
+#line 1013 "bison_parser.y"
                        {
-  (yyval.expr_vec) = new std::vector<Expr*>();
+  (yyval.expr_vec) = arenaNew<std::vector<Expr*>>();
   (yyval.expr_vec)->push_back((yyvsp[0].expr));
 }
-#line 4319 "bison_parser.cpp"
+#line 4564 "bison_parser.cpp"
     break;
 
-  case 157: /* literal_list: literal_list ',' literal  */
-#line 873 "bison_parser.y"
+  case 172: /* literal_list: literal_list ',' literal  */
+#line 1017 "bison_parser.y"
                            {
   (yyvsp[-2].expr_vec)->push_back((yyvsp[0].expr));
   (yyval.expr_vec) = (yyvsp[-2].expr_vec);
 }
-#line 4328 "bison_parser.cpp"
+#line 4573 "bison_parser.cpp"
     break;
 
-  case 158: /* expr_alias: expr opt_alias  */
-#line 878 "bison_parser.y"
+  case 173: /* expr_alias: expr opt_alias  */
+#line 1022 "bison_parser.y"
                             {
   (yyval.expr) = (yyvsp[-1].expr);
   if ((yyvsp[0].alias_t)) {
-    (yyval.expr)->alias = strdup((yyvsp[0].alias_t)->name);
-    delete (yyvsp[0].alias_t);
+    (yyval.expr)->alias = arenaStrdup((yyvsp[0].alias_t)->name);
+    arenaDelete((yyvsp[0].alias_t));
   }
 }
-#line 4340 "bison_parser.cpp"
+#line 4585 "bison_parser.cpp"
     break;
 
-  case 164: /* operand: '(' expr ')'  */
-#line 888 "bison_parser.y"
+  case 179: /* operand: '(' expr ')'  */
+#line 1032 "bison_parser.y"
                        { (yyval.expr) = (yyvsp[-1].expr); }
-#line 4346 "bison_parser.cpp"
+#line 4591 "bison_parser.cpp"
     break;
 
-  case 174: /* operand: '(' select_no_paren ')'  */
-#line 890 "bison_parser.y"
+  case 189: /* operand: '(' select_no_paren ')'  */
+#line 1034 "bison_parser.y"
                                          {
   (yyval.expr) = Expr::makeSelect((yyvsp[-1].select_stmt));
 }
-#line 4354 "bison_parser.cpp"
+#line 4599 "bison_parser.cpp"
     break;
 
-  case 177: /* unary_expr: '-' operand  */
-#line 896 "bison_parser.y"
+  case 192: /* unary_expr: '-' operand  */
+#line 1040 "bison_parser.y"
                          { (yyval.expr) = Expr::makeOpUnary(kOpUnaryMinus, (yyvsp[0].expr)); }
-#line 4360 "bison_parser.cpp"
+#line 4605 "bison_parser.cpp"
     break;
 
-  case 178: /* unary_expr: NOT operand  */
-#line 897 "bison_parser.y"
+  case 193: /* unary_expr: NOT operand  */
+#line 1041 "bison_parser.y"
               { (yyval.expr) = Expr::makeOpUnary(kOpNot, (yyvsp[0].expr)); }
-#line 4366 "bison_parser.cpp"
+#line 4611 "bison_parser.cpp"
     break;
 
-  case 179: /* unary_expr: operand ISNULL  */
-#line 898 "bison_parser.y"
+  case 194: /* unary_expr: operand ISNULL  */
+#line 1042 "bison_parser.y"
                  { (yyval.expr) = Expr::makeOpUnary(kOpIsNull, (yyvsp[-1].expr)); }
-#line 4372 "bison_parser.cpp"
+#line 4617 "bison_parser.cpp"
     break;
 
-  case 180: /* unary_expr: operand IS NULL  */
-#line 899 "bison_parser.y"
+  case 195: /* unary_expr: operand IS NULL  */
+#line 1043 "bison_parser.y"
                   { (yyval.expr) = Expr::makeOpUnary(kOpIsNull, (yyvsp[-2].expr)); }
-#line 4378 "bison_parser.cpp"
+#line 4623 "bison_parser.cpp"
     break;
 
-  case 181: /* unary_expr: operand IS NOT NULL  */
-#line 900 "bison_parser.y"
+  case 196: /* unary_expr: operand IS NOT NULL  */
+#line 1044 "bison_parser.y"
                       { (yyval.expr) = Expr::makeOpUnary(kOpNot, Expr::makeOpUnary(kOpIsNull, (yyvsp[-3].expr))); }
-#line 4384 "bison_parser.cpp"
+#line 4629 "bison_parser.cpp"
     break;
 
-  case 183: /* binary_expr: operand '-' operand  */
-#line 902 "bison_parser.y"
+  case 198: /* binary_expr: operand '-' operand  */
+#line 1046 "bison_parser.y"
                                               { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpMinus, (yyvsp[0].expr)); }
-#line 4390 "bison_parser.cpp"
+#line 4635 "bison_parser.cpp"
     break;
 
-  case 184: /* binary_expr: operand '+' operand  */
-#line 903 "bison_parser.y"
+  case 199: /* binary_expr: operand '+' operand  */
+#line 1047 "bison_parser.y"
                       { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpPlus, (yyvsp[0].expr)); }
-#line 4396 "bison_parser.cpp"
+#line 4641 "bison_parser.cpp"
     break;
 
-  case 185: /* binary_expr: operand '/' operand  */
-#line 904 "bison_parser.y"
+  case 200: /* binary_expr: operand '/' operand  */
+#line 1048 "bison_parser.y"
                       { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpSlash, (yyvsp[0].expr)); }
-#line 4402 "bison_parser.cpp"
+#line 4647 "bison_parser.cpp"
     break;
 
-  case 186: /* binary_expr: operand '*' operand  */
-#line 905 "bison_parser.y"
+  case 201: /* binary_expr: operand '*' operand  */
+#line 1049 "bison_parser.y"
                       { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpAsterisk, (yyvsp[0].expr)); }
-#line 4408 "bison_parser.cpp"
+#line 4653 "bison_parser.cpp"
     break;
 
-  case 187: /* binary_expr: operand '%' operand  */
-#line 906 "bison_parser.y"
+  case 202: /* binary_expr: operand '%' operand  */
+#line 1050 "bison_parser.y"
                       { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpPercentage, (yyvsp[0].expr)); }
-#line 4414 "bison_parser.cpp"
+#line 4659 "bison_parser.cpp"
     break;
 
-  case 188: /* binary_expr: operand '^' operand  */
-#line 907 "bison_parser.y"
+  case 203: /* binary_expr: operand '^' operand  */
+#line 1051 "bison_parser.y"
                       { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpCaret, (yyvsp[0].expr)); }
-#line 4420 "bison_parser.cpp"
+#line 4665 "bison_parser.cpp"
     break;
 
-  case 189: /* binary_expr: operand LIKE operand  */
-#line 908 "bison_parser.y"
+  case 204: /* binary_expr: operand LIKE operand  */
+#line 1052 "bison_parser.y"
                        { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpLike, (yyvsp[0].expr)); }
-#line 4426 "bison_parser.cpp"
+#line 4671 "bison_parser.cpp"
     break;
 
-  case 190: /* binary_expr: operand NOT LIKE operand  */
-#line 909 "bison_parser.y"
+  case 205: /* binary_expr: operand NOT LIKE operand  */
+#line 1053 "bison_parser.y"
                            { (yyval.expr) = Expr::makeOpBinary((yyvsp[-3].expr), kOpNotLike, (yyvsp[0].expr)); }
-#line 4432 "bison_parser.cpp"
+#line 4677 "bison_parser.cpp"
     break;
 
-  case 191: /* binary_expr: operand ILIKE operand  */
-#line 910 "bison_parser.y"
+  case 206: /* binary_expr: operand ILIKE operand  */
+#line 1054 "bison_parser.y"
                         { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpILike, (yyvsp[0].expr)); }
-#line 4438 "bison_parser.cpp"
+#line 4683 "bison_parser.cpp"
     break;
 
-  case 192: /* binary_expr: operand CONCAT operand  */
-#line 911 "bison_parser.y"
+  case 207: /* binary_expr: operand CONCAT operand  */
+#line 1055 "bison_parser.y"
                          { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpConcat, (yyvsp[0].expr)); }
-#line 4444 "bison_parser.cpp"
+#line 4689 "bison_parser.cpp"
     break;
 
-  case 193: /* logic_expr: expr AND expr  */
-#line 913 "bison_parser.y"
-                           { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpAnd, (yyvsp[0].expr)); }
-#line 4450 "bison_parser.cpp"
+  case 208: /* logic_expr: expr AND expr  */
+#line 1057 "bison_parser.y"
+                           { (yyval.expr) = makeLogicalOperator((yyvsp[-2].expr), kOpAnd, (yyvsp[0].expr), PARSE_STATE->flattenLogicalOperators); }
+#line 4695 "bison_parser.cpp"
     break;
 
-  case 194: /* logic_expr: expr OR expr  */
-#line 914 "bison_parser.y"
-               { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpOr, (yyvsp[0].expr)); }
-#line 4456 "bison_parser.cpp"
+  case 209: /* logic_expr: expr OR expr  */
+#line 1058 "bison_parser.y"
+               { (yyval.expr) = makeLogicalOperator((yyvsp[-2].expr), kOpOr, (yyvsp[0].expr), PARSE_STATE->flattenLogicalOperators); }
+#line 4701 "bison_parser.cpp"
     break;
 
-  case 195: /* in_expr: operand IN '(' expr_list ')'  */
-#line 916 "bison_parser.y"
+  case 210: /* in_expr: operand IN '(' expr_list ')'  */
+#line 1060 "bison_parser.y"
                                        { (yyval.expr) = Expr::makeInOperator((yyvsp[-4].expr), (yyvsp[-1].expr_vec)); }
-#line 4462 "bison_parser.cpp"
+#line 4707 "bison_parser.cpp"
     break;
 
-  case 196: /* in_expr: operand NOT IN '(' expr_list ')'  */
-#line 917 "bison_parser.y"
+  case 211: /* in_expr: operand NOT IN '(' expr_list ')'  */
+#line 1061 "bison_parser.y"
                                    { (yyval.expr) = Expr::makeOpUnary(kOpNot, Expr::makeInOperator((yyvsp[-5].expr), (yyvsp[-1].expr_vec))); }
-#line 4468 "bison_parser.cpp"
+#line 4713 "bison_parser.cpp"
     break;
 
-  case 197: /* in_expr: operand IN '(' select_no_paren ')'  */
-#line 918 "bison_parser.y"
+  case 212: /* in_expr: operand IN '(' select_no_paren ')'  */
+#line 1062 "bison_parser.y"
                                      { (yyval.expr) = Expr::makeInOperator((yyvsp[-4].expr), (yyvsp[-1].select_stmt)); }
-#line 4474 "bison_parser.cpp"
+#line 4719 "bison_parser.cpp"
     break;
 
-  case 198: /* in_expr: operand NOT IN '(' select_no_paren ')'  */
-#line 919 "bison_parser.y"
+  case 213: /* in_expr: operand NOT IN '(' select_no_paren ')'  */
+#line 1063 "bison_parser.y"
                                          { (yyval.expr) = Expr::makeOpUnary(kOpNot, Expr::makeInOperator((yyvsp[-5].expr), (yyvsp[-1].select_stmt))); }
-#line 4480 "bison_parser.cpp"
+#line 4725 "bison_parser.cpp"
     break;
 
-  case 199: /* case_expr: CASE expr case_list END  */
-#line 923 "bison_parser.y"
+  case 214: /* case_expr: CASE expr case_list END  */
+#line 1067 "bison_parser.y"
                                     { (yyval.expr) = Expr::makeCase((yyvsp[-2].expr), (yyvsp[-1].expr), nullptr); }
-#line 4486 "bison_parser.cpp"
+#line 4731 "bison_parser.cpp"
     break;
 
-  case 200: /* case_expr: CASE expr case_list ELSE expr END  */
-#line 924 "bison_parser.y"
+  case 215: /* case_expr: CASE expr case_list ELSE expr END  */
+#line 1068 "bison_parser.y"
                                     { (yyval.expr) = Expr::makeCase((yyvsp[-4].expr), (yyvsp[-3].expr), (yyvsp[-1].expr)); }
-#line 4492 "bison_parser.cpp"
+#line 4737 "bison_parser.cpp"
     break;
 
-  case 201: /* case_expr: CASE case_list END  */
-#line 925 "bison_parser.y"
+  case 216: /* case_expr: CASE case_list END  */
+#line 1069 "bison_parser.y"
                      { (yyval.expr) = Expr::makeCase(nullptr, (yyvsp[-1].expr), nullptr); }
-#line 4498 "bison_parser.cpp"
+#line 4743 "bison_parser.cpp"
     break;
 
-  case 202: /* case_expr: CASE case_list ELSE expr END  */
-#line 926 "bison_parser.y"
+  case 217: /* case_expr: CASE case_list ELSE expr END  */
+#line 1070 "bison_parser.y"
                                { (yyval.expr) = Expr::makeCase(nullptr, (yyvsp[-3].expr), (yyvsp[-1].expr)); }
-#line 4504 "bison_parser.cpp"
+#line 4749 "bison_parser.cpp"
     break;
 
-  case 203: /* case_list: WHEN expr THEN expr  */
-#line 928 "bison_parser.y"
+  case 218: /* case_list: WHEN expr THEN expr  */
+#line 1072 "bison_parser.y"
                                 { (yyval.expr) = Expr::makeCaseList(Expr::makeCaseListElement((yyvsp[-2].expr), (yyvsp[0].expr))); }
-#line 4510 "bison_parser.cpp"
+#line 4755 "bison_parser.cpp"
     break;
 
-  case 204: /* case_list: case_list WHEN expr THEN expr  */
-#line 929 "bison_parser.y"
+  case 219: /* case_list: case_list WHEN expr THEN expr  */
+#line 1073 "bison_parser.y"
                                 { (yyval.expr) = Expr::caseListAppend((yyvsp[-4].expr), Expr::makeCaseListElement((yyvsp[-2].expr), (yyvsp[0].expr))); }
-#line 4516 "bison_parser.cpp"
+#line 4761 "bison_parser.cpp"
     break;
 
-  case 205: /* exists_expr: EXISTS '(' select_no_paren ')'  */
-#line 931 "bison_parser.y"
+  case 220: /* exists_expr: EXISTS '(' select_no_paren ')'  */
+#line 1075 "bison_parser.y"
                                              { (yyval.expr) = Expr::makeExists((yyvsp[-1].select_stmt)); }
-#line 4522 "bison_parser.cpp"
+#line 4767 "bison_parser.cpp"
     break;
 
-  case 206: /* exists_expr: NOT EXISTS '(' select_no_paren ')'  */
-#line 932 "bison_parser.y"
+  case 221: /* exists_expr: NOT EXISTS '(' select_no_paren ')'  */
+#line 1076 "bison_parser.y"
                                      { (yyval.expr) = Expr::makeOpUnary(kOpNot, Expr::makeExists((yyvsp[-1].select_stmt))); }
-#line 4528 "bison_parser.cpp"
+#line 4773 "bison_parser.cpp"
     break;
 
-  case 207: /* comp_expr: operand '=' operand  */
-#line 934 "bison_parser.y"
+  case 222: /* comp_expr: operand '=' operand  */
+#line 1078 "bison_parser.y"
                                 { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpEquals, (yyvsp[0].expr)); }
-#line 4534 "bison_parser.cpp"
+#line 4779 "bison_parser.cpp"
     break;
 
-  case 208: /* comp_expr: operand EQUALS operand  */
-#line 935 "bison_parser.y"
+  case 223: /* comp_expr: operand EQUALS operand  */
+#line 1079 "bison_parser.y"
                          { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpEquals, (yyvsp[0].expr)); }
-#line 4540 "bison_parser.cpp"
+#line 4785 "bison_parser.cpp"
     break;
 
-  case 209: /* comp_expr: operand NOTEQUALS operand  */
-#line 936 "bison_parser.y"
+  case 224: /* comp_expr: operand NOTEQUALS operand  */
+#line 1080 "bison_parser.y"
                             { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpNotEquals, (yyvsp[0].expr)); }
-#line 4546 "bison_parser.cpp"
+#line 4791 "bison_parser.cpp"
     break;
 
-  case 210: /* comp_expr: operand '<' operand  */
-#line 937 "bison_parser.y"
+  case 225: /* comp_expr: operand '<' operand  */
+#line 1081 "bison_parser.y"
                       { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpLess, (yyvsp[0].expr)); }
-#line 4552 "bison_parser.cpp"
+#line 4797 "bison_parser.cpp"
     break;
 
-  case 211: /* comp_expr: operand '>' operand  */
-#line 938 "bison_parser.y"
+  case 226: /* comp_expr: operand '>' operand  */
+#line 1082 "bison_parser.y"
                       { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpGreater, (yyvsp[0].expr)); }
-#line 4558 "bison_parser.cpp"
+#line 4803 "bison_parser.cpp"
     break;
 
-  case 212: /* comp_expr: operand LESSEQ operand  */
-#line 939 "bison_parser.y"
+  case 227: /* comp_expr: operand LESSEQ operand  */
+#line 1083 "bison_parser.y"
                          { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpLessEq, (yyvsp[0].expr)); }
-#line 4564 "bison_parser.cpp"
+#line 4809 "bison_parser.cpp"
     break;
 
-  case 213: /* comp_expr: operand GREATEREQ operand  */
-#line 940 "bison_parser.y"
+  case 228: /* comp_expr: operand GREATEREQ operand  */
+#line 1084 "bison_parser.y"
                             { (yyval.expr) = Expr::makeOpBinary((yyvsp[-2].expr), kOpGreaterEq, (yyvsp[0].expr)); }
-#line 4570 "bison_parser.cpp"
+#line 4815 "bison_parser.cpp"
     break;
 
-  case 214: /* function_expr: IDENTIFIER '(' ')'  */
-#line 942 "bison_parser.y"
-                                   { (yyval.expr) = Expr::makeFunctionRef((yyvsp[-2].sval), new std::vector<Expr*>(), false); }
-#line 4576 "bison_parser.cpp"
+  case 229: /* function_expr: IDENTIFIER '(' ')'  */
+#line 1086 "bison_parser.y"
+                                   { (yyval.expr) = Expr::makeFunctionRef((yyvsp[-2].sval), arenaNew<std::vector<Expr*>>(), false); }
+#line 4821 "bison_parser.cpp"
     break;
 
-  case 215: /* function_expr: IDENTIFIER '(' opt_distinct expr_list ')'  */
-#line 943 "bison_parser.y"
+  case 230: /* function_expr: IDENTIFIER '(' opt_distinct expr_list ')'  */
+#line 1087 "bison_parser.y"
                                             { (yyval.expr) = Expr::makeFunctionRef((yyvsp[-4].sval), (yyvsp[-1].expr_vec), (yyvsp[-2].bval)); }
-#line 4582 "bison_parser.cpp"
+#line 4827 "bison_parser.cpp"
     break;
 
-  case 216: /* extract_expr: EXTRACT '(' datetime_field FROM expr ')'  */
-#line 945 "bison_parser.y"
+  case 231: /* extract_expr: EXTRACT '(' datetime_field FROM expr ')'  */
+#line 1089 "bison_parser.y"
                                                         { (yyval.expr) = Expr::makeExtract((yyvsp[-3].datetime_field), (yyvsp[-1].expr)); }
-#line 4588 "bison_parser.cpp"
+#line 4833 "bison_parser.cpp"
     break;
 
-  case 217: /* cast_expr: CAST '(' expr AS column_type ')'  */
-#line 947 "bison_parser.y"
+  case 232: /* cast_expr: CAST '(' expr AS column_type ')'  */
+#line 1091 "bison_parser.y"
                                              { (yyval.expr) = Expr::makeCast((yyvsp[-3].expr), (yyvsp[-1].column_type_t)); }
-#line 4594 "bison_parser.cpp"
+#line 4839 "bison_parser.cpp"
     break;
 
-  case 218: /* datetime_field: SECOND  */
-#line 949 "bison_parser.y"
+  case 233: /* datetime_field: SECOND  */
+#line 1093 "bison_parser.y"
                         { (yyval.datetime_field) = kDatetimeSecond; }
-#line 4600 "bison_parser.cpp"
+#line 4845 "bison_parser.cpp"
     break;
 
-  case 219: /* datetime_field: MINUTE  */
-#line 950 "bison_parser.y"
+  case 234: /* datetime_field: MINUTE  */
+#line 1094 "bison_parser.y"
          { (yyval.datetime_field) = kDatetimeMinute; }
-#line 4606 "bison_parser.cpp"
+#line 4851 "bison_parser.cpp"
     break;
 
-  case 220: /* datetime_field: HOUR  */
-#line 951 "bison_parser.y"
+  case 235: /* datetime_field: HOUR  */
+#line 1095 "bison_parser.y"
        { (yyval.datetime_field) = kDatetimeHour; }
-#line 4612 "bison_parser.cpp"
+#line 4857 "bison_parser.cpp"
     break;
 
-  case 221: /* datetime_field: DAY  */
-#line 952 "bison_parser.y"
+  case 236: /* datetime_field: DAY  */
+#line 1096 "bison_parser.y"
       { (yyval.datetime_field) = kDatetimeDay; }
-#line 4618 "bison_parser.cpp"
+#line 4863 "bison_parser.cpp"
     break;
 
-  case 222: /* datetime_field: MONTH  */
-#line 953 "bison_parser.y"
+  case 237: /* datetime_field: MONTH  */
+#line 1097 "bison_parser.y"
         { (yyval.datetime_field) = kDatetimeMonth; }
-#line 4624 "bison_parser.cpp"
+#line 4869 "bison_parser.cpp"
     break;
 
-  case 223: /* datetime_field: YEAR  */
-#line 954 "bison_parser.y"
+  case 238: /* datetime_field: YEAR  */
+#line 1098 "bison_parser.y"
        { (yyval.datetime_field) = kDatetimeYear; }
-#line 4630 "bison_parser.cpp"
+#line 4875 "bison_parser.cpp"
     break;
 
-  case 224: /* datetime_field_plural: SECONDS  */
-#line 956 "bison_parser.y"
+  case 239: /* datetime_field_plural: SECONDS  */
+#line 1100 "bison_parser.y"
                                 { (yyval.datetime_field) = kDatetimeSecond; }
-#line 4636 "bison_parser.cpp"
+#line 4881 "bison_parser.cpp"
     break;
 
-  case 225: /* datetime_field_plural: MINUTES  */
-#line 957 "bison_parser.y"
+  case 240: /* datetime_field_plural: MINUTES  */
+#line 1101 "bison_parser.y"
           { (yyval.datetime_field) = kDatetimeMinute; }
-#line 4642 "bison_parser.cpp"
+#line 4887 "bison_parser.cpp"
     break;
 
-  case 226: /* datetime_field_plural: HOURS  */
-#line 958 "bison_parser.y"
+  case 241: /* datetime_field_plural: HOURS  */
+#line 1102 "bison_parser.y"
         { (yyval.datetime_field) = kDatetimeHour; }
-#line 4648 "bison_parser.cpp"
+#line 4893 "bison_parser.cpp"
     break;
 
-  case 227: /* datetime_field_plural: DAYS  */
-#line 959 "bison_parser.y"
+  case 242: /* datetime_field_plural: DAYS  */
+#line 1103 "bison_parser.y"
        { (yyval.datetime_field) = kDatetimeDay; }
-#line 4654 "bison_parser.cpp"
+#line 4899 "bison_parser.cpp"
     break;
 
-  case 228: /* datetime_field_plural: MONTHS  */
-#line 960 "bison_parser.y"
+  case 243: /* datetime_field_plural: MONTHS  */
+#line 1104 "bison_parser.y"
          { (yyval.datetime_field) = kDatetimeMonth; }
-#line 4660 "bison_parser.cpp"
+#line 4905 "bison_parser.cpp"
     break;
 
-  case 229: /* datetime_field_plural: YEARS  */
-#line 961 "bison_parser.y"
+  case 244: /* datetime_field_plural: YEARS  */
+#line 1105 "bison_parser.y"
         { (yyval.datetime_field) = kDatetimeYear; }
-#line 4666 "bison_parser.cpp"
+#line 4911 "bison_parser.cpp"
     break;
 
-  case 232: /* array_expr: ARRAY '[' expr_list ']'  */
-#line 965 "bison_parser.y"
+  case 247: /* array_expr: ARRAY '[' expr_list ']'  */
+#line 1109 "bison_parser.y"
                                      { (yyval.expr) = Expr::makeArray((yyvsp[-1].expr_vec)); }
-#line 4672 "bison_parser.cpp"
+#line 4917 "bison_parser.cpp"
     break;
 
-  case 233: /* array_index: operand '[' int_literal ']'  */
-#line 967 "bison_parser.y"
-                                          { (yyval.expr) = Expr::makeArrayIndex((yyvsp[-3].expr), (yyvsp[-1].expr)->ival); }
-#line 4678 "bison_parser.cpp"
+  case 248: /* array_index: operand '[' int_literal ']'  */
+#line 1111 "bison_parser.y"
+                                          {
+  (yyval.expr) = Expr::makeArrayIndex((yyvsp[-3].expr), (yyvsp[-1].expr)->ival);
+  arenaDelete((yyvsp[-1].expr));
+}
+#line 4926 "bison_parser.cpp"
     break;
 
-  case 234: /* between_expr: operand BETWEEN operand AND operand  */
-#line 969 "bison_parser.y"
+  case 249: /* between_expr: operand BETWEEN operand AND operand  */
+#line 1116 "bison_parser.y"
                                                    { (yyval.expr) = Expr::makeBetween((yyvsp[-4].expr), (yyvsp[-2].expr), (yyvsp[0].expr)); }
-#line 4684 "bison_parser.cpp"
+#line 4932 "bison_parser.cpp"
     break;
 
-  case 235: /* column_name: IDENTIFIER  */
-#line 971 "bison_parser.y"
+  case 250: /* column_name: IDENTIFIER  */
+#line 1118 "bison_parser.y"
                          { (yyval.expr) = Expr::makeColumnRef((yyvsp[0].sval)); }
-#line 4690 "bison_parser.cpp"
+#line 4938 "bison_parser.cpp"
     break;
 
-  case 236: /* column_name: IDENTIFIER '.' IDENTIFIER  */
-#line 972 "bison_parser.y"
+  case 251: /* column_name: IDENTIFIER '.' IDENTIFIER  */
+#line 1119 "bison_parser.y"
                             { (yyval.expr) = Expr::makeColumnRef((yyvsp[-2].sval), (yyvsp[0].sval)); }
-#line 4696 "bison_parser.cpp"
+#line 4944 "bison_parser.cpp"
     break;
 
-  case 237: /* column_name: '*'  */
-#line 973 "bison_parser.y"
+  case 252: /* column_name: '*'  */
+#line 1120 "bison_parser.y"
       { (yyval.expr) = Expr::makeStar(); }
-#line 4702 "bison_parser.cpp"
+#line 4950 "bison_parser.cpp"
     break;
 
-  case 238: /* column_name: IDENTIFIER '.' '*'  */
-#line 974 "bison_parser.y"
+  case 253: /* column_name: IDENTIFIER '.' '*'  */
+#line 1121 "bison_parser.y"
                      { (yyval.expr) = Expr::makeStar((yyvsp[-2].sval)); }
-#line 4708 "bison_parser.cpp"
+#line 4956 "bison_parser.cpp"
     break;
 
-  case 246: /* string_literal: STRING  */
-#line 978 "bison_parser.y"
+  case 261: /* string_literal: STRING  */
+#line 1125 "bison_parser.y"
                         { (yyval.expr) = Expr::makeLiteral((yyvsp[0].sval)); }
-#line 4714 "bison_parser.cpp"
+#line 4962 "bison_parser.cpp"
     break;
 
-  case 247: /* bool_literal: TRUE  */
-#line 980 "bison_parser.y"
+  case 262: /* bool_literal: TRUE  */
+#line 1127 "bison_parser.y"
                     { (yyval.expr) = Expr::makeLiteral(true); }
-#line 4720 "bison_parser.cpp"
+#line 4968 "bison_parser.cpp"
     break;
 
-  case 248: /* bool_literal: FALSE  */
-#line 981 "bison_parser.y"
+  case 263: /* bool_literal: FALSE  */
+#line 1128 "bison_parser.y"
         { (yyval.expr) = Expr::makeLiteral(false); }
-#line 4726 "bison_parser.cpp"
+#line 4974 "bison_parser.cpp"
     break;
 
-  case 249: /* num_literal: FLOATVAL  */
-#line 983 "bison_parser.y"
+  case 264: /* num_literal: FLOATVAL  */
+#line 1130 "bison_parser.y"
                        { (yyval.expr) = Expr::makeLiteral((yyvsp[0].fval)); }
-#line 4732 "bison_parser.cpp"
+#line 4980 "bison_parser.cpp"
     break;
 
-  case 251: /* int_literal: INTVAL  */
-#line 986 "bison_parser.y"
+  case 266: /* int_literal: INTVAL  */
+#line 1133 "bison_parser.y"
                      { (yyval.expr) = Expr::makeLiteral((yyvsp[0].ival)); }
-#line 4738 "bison_parser.cpp"
+#line 4986 "bison_parser.cpp"
     break;
 
-  case 252: /* null_literal: NULL  */
-#line 988 "bison_parser.y"
+  case 267: /* null_literal: NULL  */
+#line 1135 "bison_parser.y"
                     { (yyval.expr) = Expr::makeNullLiteral(); }
-#line 4744 "bison_parser.cpp"
+#line 4992 "bison_parser.cpp"
     break;
 
-  case 253: /* date_literal: DATE STRING  */
-#line 990 "bison_parser.y"
+  case 268: /* date_literal: DATE STRING  */
+#line 1137 "bison_parser.y"
                            {
-  int day{0}, month{0}, year{0}, chars_parsed{0};
-  // If the whole string is parsed, chars_parsed points to the terminating null byte after the last character
-  if (sscanf((yyvsp[0].sval), "%4d-%2d-%2d%n", &day, &month, &year, &chars_parsed) != 3 || (yyvsp[0].sval)[chars_parsed] != 0) {
-    free((yyvsp[0].sval));
+  if (!isValidDate((yyvsp[0].sval))) {
+    arenaFree((yyvsp[0].sval));
     yyerror(&yyloc, result, scanner, "Found incorrect date format. Expected format: YYYY-MM-DD");
     YYERROR;
   }
   (yyval.expr) = Expr::makeDateLiteral((yyvsp[0].sval));
 }
-#line 4759 "bison_parser.cpp"
+#line 5005 "bison_parser.cpp"
     break;
 
-  case 254: /* interval_literal: int_literal duration_field  */
-#line 1001 "bison_parser.y"
+  case 269: /* interval_literal: int_literal duration_field  */
+#line 1146 "bison_parser.y"
                                               {
   (yyval.expr) = Expr::makeIntervalLiteral((yyvsp[-1].expr)->ival, (yyvsp[0].datetime_field));
-  delete (yyvsp[-1].expr);
+  arenaDelete((yyvsp[-1].expr));
 }
-#line 4768 "bison_parser.cpp"
+#line 5014 "bison_parser.cpp"
     break;
 
-  case 255: /* interval_literal: INTERVAL STRING datetime_field  */
-#line 1005 "bison_parser.y"
+  case 270: /* interval_literal: INTERVAL STRING datetime_field  */
+#line 1150 "bison_parser.y"
                                  {
   int duration{0}, chars_parsed{0};
   // If the whole string is parsed, chars_parsed points to the terminating null byte after the last character
   if (sscanf((yyvsp[-1].sval), "%d%n", &duration, &chars_parsed) != 1 || (yyvsp[-1].sval)[chars_parsed] != 0) {
-    free((yyvsp[-1].sval));
+    arenaFree((yyvsp[-1].sval));
     yyerror(&yyloc, result, scanner, "Found incorrect interval format. Expected format: INTEGER");
     YYERROR;
   }
-  free((yyvsp[-1].sval));
+  arenaFree((yyvsp[-1].sval));
   (yyval.expr) = Expr::makeIntervalLiteral(duration, (yyvsp[0].datetime_field));
 }
-#line 4784 "bison_parser.cpp"
+#line 5030 "bison_parser.cpp"
     break;
 
-  case 256: /* interval_literal: INTERVAL STRING  */
-#line 1016 "bison_parser.y"
+  case 271: /* interval_literal: INTERVAL STRING  */
+#line 1161 "bison_parser.y"
                   {
   int duration{0}, chars_parsed{0};
   // 'seconds' and 'minutes' are the longest accepted interval qualifiers (7 chars) + null byte
   char unit_string[8];
   // If the whole string is parsed, chars_parsed points to the terminating null byte after the last character
   if (sscanf((yyvsp[0].sval), "%d %7s%n", &duration, unit_string, &chars_parsed) != 2 || (yyvsp[0].sval)[chars_parsed] != 0) {
-    free((yyvsp[0].sval));
+    arenaFree((yyvsp[0].sval));
     yyerror(&yyloc, result, scanner, "Found incorrect interval format. Expected format: INTEGER INTERVAL_QUALIIFIER");
     YYERROR;
   }
-  free((yyvsp[0].sval));
+  arenaFree((yyvsp[0].sval));
 
   DatetimeField unit;
   if (strcasecmp(unit_string, "second") == 0 || strcasecmp(unit_string, "seconds") == 0) {
@@ -4816,61 +5062,61 @@ yyreduce:
   }
   (yyval.expr) = Expr::makeIntervalLiteral(duration, unit);
 }
-#line 4820 "bison_parser.cpp"
+#line 5066 "bison_parser.cpp"
     break;
 
-  case 257: /* param_expr: '?'  */
-#line 1048 "bison_parser.y"
+  case 272: /* param_expr: '?'  */
+#line 1193 "bison_parser.y"
                  {
-  (yyval.expr) = Expr::makeParameter(yylloc.total_column);
-  (yyval.expr)->ival2 = yyloc.param_list.size();
-  yyloc.param_list.push_back((yyval.expr));
+  (yyval.expr) = Expr::makeParameter(yylloc.last_offset);
+  (yyval.expr)->ival2 = PARSE_STATE->parameters->size();
+  PARSE_STATE->parameters->push_back((yyval.expr));
 }
-#line 4830 "bison_parser.cpp"
+#line 5076 "bison_parser.cpp"
     break;
 
-  case 259: /* table_ref: table_ref_commalist ',' table_ref_atomic  */
-#line 1057 "bison_parser.y"
+  case 274: /* table_ref: table_ref_commalist ',' table_ref_atomic  */
+#line 1202 "bison_parser.y"
                                                                         {
   (yyvsp[-2].table_vec)->push_back((yyvsp[0].table));
   auto tbl = new TableRef(kTableCrossProduct);
   tbl->list = (yyvsp[-2].table_vec);
   (yyval.table) = tbl;
 }
-#line 4841 "bison_parser.cpp"
+#line 5087 "bison_parser.cpp"
     break;
 
-  case 263: /* nonjoin_table_ref_atomic: '(' select_statement ')' opt_table_alias  */
-#line 1066 "bison_parser.y"
+  case 278: /* nonjoin_table_ref_atomic: '(' select_statement ')' opt_table_alias  */
+#line 1211 "bison_parser.y"
                                                                                      {
   auto tbl = new TableRef(kTableSelect);
   tbl->select = (yyvsp[-2].select_stmt);
   tbl->alias = (yyvsp[0].alias_t);
   (yyval.table) = tbl;
 }
-#line 4852 "bison_parser.cpp"
+#line 5098 "bison_parser.cpp"
     break;
 
-  case 264: /* table_ref_commalist: table_ref_atomic  */
-#line 1073 "bison_parser.y"
+  case 279: /* table_ref_commalist: table_ref_atomic  */
+#line 1218 "bison_parser.y"
                                        {
-  (yyval.table_vec) = new std::vector<TableRef*>();
+  (yyval.table_vec) = arenaNew<std::vector<TableRef*>>();
   (yyval.table_vec)->push_back((yyvsp[0].table));
 }
-#line 4861 "bison_parser.cpp"
+#line 5107 "bison_parser.cpp"
     break;
 
-  case 265: /* table_ref_commalist: table_ref_commalist ',' table_ref_atomic  */
-#line 1077 "bison_parser.y"
+  case 280: /* table_ref_commalist: table_ref_commalist ',' table_ref_atomic  */
+#line 1222 "bison_parser.y"
                                            {
   (yyvsp[-2].table_vec)->push_back((yyvsp[0].table));
   (yyval.table_vec) = (yyvsp[-2].table_vec);
 }
-#line 4870 "bison_parser.cpp"
+#line 5116 "bison_parser.cpp"
     break;
 
-  case 266: /* table_ref_name: table_name opt_table_alias  */
-#line 1082 "bison_parser.y"
+  case 281: /* table_ref_name: table_name opt_table_alias  */
+#line 1227 "bison_parser.y"
                                             {
   auto tbl = new TableRef(kTableName);
   tbl->schema = (yyvsp[-1].table_name).schema;
@@ -4878,121 +5124,121 @@ yyreduce:
   tbl->alias = (yyvsp[0].alias_t);
   (yyval.table) = tbl;
 }
-#line 4882 "bison_parser.cpp"
+#line 5128 "bison_parser.cpp"
     break;
 
-  case 267: /* table_ref_name_no_alias: table_name  */
-#line 1090 "bison_parser.y"
+  case 282: /* table_ref_name_no_alias: table_name  */
+#line 1235 "bison_parser.y"
                                      {
   (yyval.table) = new TableRef(kTableName);
   (yyval.table)->schema = (yyvsp[0].table_name).schema;
   (yyval.table)->name = (yyvsp[0].table_name).name;
 }
-#line 4892 "bison_parser.cpp"
+#line 5138 "bison_parser.cpp"
     break;
 
-  case 268: /* table_name: IDENTIFIER  */
-#line 1096 "bison_parser.y"
+  case 283: /* table_name: IDENTIFIER  */
+#line 1241 "bison_parser.y"
                         {
   (yyval.table_name).schema = nullptr;
   (yyval.table_name).name = (yyvsp[0].sval);
 }
-#line 4901 "bison_parser.cpp"
+#line 5147 "bison_parser.cpp"
     break;
 
-  case 269: /* table_name: IDENTIFIER '.' IDENTIFIER  */
-#line 1100 "bison_parser.y"
+  case 284: /* table_name: IDENTIFIER '.' IDENTIFIER  */
+#line 1245 "bison_parser.y"
                             {
   (yyval.table_name).schema = (yyvsp[-2].sval);
   (yyval.table_name).name = (yyvsp[0].sval);
 }
-#line 4910 "bison_parser.cpp"
+#line 5156 "bison_parser.cpp"
     break;
 
-  case 270: /* opt_index_name: IDENTIFIER  */
-#line 1105 "bison_parser.y"
+  case 285: /* opt_index_name: IDENTIFIER  */
+#line 1250 "bison_parser.y"
                             { (yyval.sval) = (yyvsp[0].sval); }
-#line 4916 "bison_parser.cpp"
+#line 5162 "bison_parser.cpp"
     break;
 
-  case 271: /* opt_index_name: %empty  */
-#line 1106 "bison_parser.y"
+  case 286: /* opt_index_name: %empty  */
+#line 1251 "bison_parser.y"
               { (yyval.sval) = nullptr; }
-#line 4922 "bison_parser.cpp"
+#line 5168 "bison_parser.cpp"
     break;
 
-  case 273: /* table_alias: AS IDENTIFIER '(' ident_commalist ')'  */
-#line 1108 "bison_parser.y"
+  case 288: /* table_alias: AS IDENTIFIER '(' ident_commalist ')'  */
+#line 1253 "bison_parser.y"
                                                             { (yyval.alias_t) = new Alias((yyvsp[-3].sval), (yyvsp[-1].str_vec)); }
-#line 4928 "bison_parser.cpp"
+#line 5174 "bison_parser.cpp"
     break;
 
-  case 275: /* opt_table_alias: %empty  */
-#line 1110 "bison_parser.y"
+  case 290: /* opt_table_alias: %empty  */
+#line 1255 "bison_parser.y"
                                             { (yyval.alias_t) = nullptr; }
-#line 4934 "bison_parser.cpp"
+#line 5180 "bison_parser.cpp"
     break;
 
-  case 276: /* alias: AS IDENTIFIER  */
-#line 1112 "bison_parser.y"
+  case 291: /* alias: AS IDENTIFIER  */
+#line 1257 "bison_parser.y"
                       { (yyval.alias_t) = new Alias((yyvsp[0].sval)); }
-#line 4940 "bison_parser.cpp"
+#line 5186 "bison_parser.cpp"
     break;
 
-  case 277: /* alias: IDENTIFIER  */
-#line 1113 "bison_parser.y"
+  case 292: /* alias: IDENTIFIER  */
+#line 1258 "bison_parser.y"
              { (yyval.alias_t) = new Alias((yyvsp[0].sval)); }
-#line 4946 "bison_parser.cpp"
+#line 5192 "bison_parser.cpp"
     break;
 
-  case 279: /* opt_alias: %empty  */
-#line 1115 "bison_parser.y"
+  case 294: /* opt_alias: %empty  */
+#line 1260 "bison_parser.y"
                                 { (yyval.alias_t) = nullptr; }
-#line 4952 "bison_parser.cpp"
+#line 5198 "bison_parser.cpp"
     break;
 
-  case 281: /* opt_with_clause: %empty  */
-#line 1121 "bison_parser.y"
+  case 296: /* opt_with_clause: %empty  */
+#line 1266 "bison_parser.y"
                                             { (yyval.with_description_vec) = nullptr; }
-#line 4958 "bison_parser.cpp"
+#line 5204 "bison_parser.cpp"
     break;
 
-  case 282: /* with_clause: WITH with_description_list  */
-#line 1123 "bison_parser.y"
+  case 297: /* with_clause: WITH with_description_list  */
+#line 1268 "bison_parser.y"
                                          { (yyval.with_description_vec) = (yyvsp[0].with_description_vec); }
-#line 4964 "bison_parser.cpp"
+#line 5210 "bison_parser.cpp"
     break;
 
-  case 283: /* with_description_list: with_description  */
-#line 1125 "bison_parser.y"
+  case 298: /* with_description_list: with_description  */
+#line 1270 "bison_parser.y"
                                          {
-  (yyval.with_description_vec) = new std::vector<WithDescription*>();
+  (yyval.with_description_vec) = arenaNew<std::vector<WithDescription*>>();
   (yyval.with_description_vec)->push_back((yyvsp[0].with_description_t));
 }
-#line 4973 "bison_parser.cpp"
+#line 5219 "bison_parser.cpp"
     break;
 
-  case 284: /* with_description_list: with_description_list ',' with_description  */
-#line 1129 "bison_parser.y"
+  case 299: /* with_description_list: with_description_list ',' with_description  */
+#line 1274 "bison_parser.y"
                                              {
   (yyvsp[-2].with_description_vec)->push_back((yyvsp[0].with_description_t));
   (yyval.with_description_vec) = (yyvsp[-2].with_description_vec);
 }
-#line 4982 "bison_parser.cpp"
+#line 5228 "bison_parser.cpp"
     break;
 
-  case 285: /* with_description: IDENTIFIER AS select_with_paren  */
-#line 1134 "bison_parser.y"
+  case 300: /* with_description: IDENTIFIER AS select_with_paren  */
+#line 1279 "bison_parser.y"
                                                    {
   (yyval.with_description_t) = new WithDescription();
   (yyval.with_description_t)->alias = (yyvsp[-2].sval);
   (yyval.with_description_t)->select = (yyvsp[0].select_stmt);
 }
-#line 4992 "bison_parser.cpp"
+#line 5238 "bison_parser.cpp"
     break;
 
-  case 286: /* join_clause: table_ref_atomic NATURAL JOIN nonjoin_table_ref_atomic  */
-#line 1144 "bison_parser.y"
+  case 301: /* join_clause: table_ref_atomic NATURAL JOIN nonjoin_table_ref_atomic  */
+#line 1289 "bison_parser.y"
                                                                      {
   (yyval.table) = new TableRef(kTableJoin);
   (yyval.table)->join = new JoinDefinition();
@@ -5000,11 +5246,11 @@ yyreduce:
   (yyval.table)->join->left = (yyvsp[-3].table);
   (yyval.table)->join->right = (yyvsp[0].table);
 }
-#line 5004 "bison_parser.cpp"
+#line 5250 "bison_parser.cpp"
     break;
 
-  case 287: /* join_clause: table_ref_atomic opt_join_type JOIN table_ref_atomic ON join_condition  */
-#line 1151 "bison_parser.y"
+  case 302: /* join_clause: table_ref_atomic opt_join_type JOIN table_ref_atomic ON join_condition  */
+#line 1296 "bison_parser.y"
                                                                          {
   (yyval.table) = new TableRef(kTableJoin);
   (yyval.table)->join = new JoinDefinition();
@@ -5013,109 +5259,109 @@ yyreduce:
   (yyval.table)->join->right = (yyvsp[-2].table);
   (yyval.table)->join->condition = (yyvsp[0].expr);
 }
-#line 5017 "bison_parser.cpp"
+#line 5263 "bison_parser.cpp"
     break;
 
-  case 288: /* join_clause: table_ref_atomic opt_join_type JOIN table_ref_atomic USING '(' column_name ')'  */
-#line 1159 "bison_parser.y"
+  case 303: /* join_clause: table_ref_atomic opt_join_type JOIN table_ref_atomic USING '(' column_name ')'  */
+#line 1304 "bison_parser.y"
                                                                                  {
   (yyval.table) = new TableRef(kTableJoin);
   (yyval.table)->join = new JoinDefinition();
   (yyval.table)->join->type = (JoinType)(yyvsp[-6].join_type);
   (yyval.table)->join->left = (yyvsp[-7].table);
   (yyval.table)->join->right = (yyvsp[-4].table);
-  auto left_col = Expr::makeColumnRef(strdup((yyvsp[-1].expr)->name));
-  if ((yyvsp[-1].expr)->alias != nullptr) left_col->alias = strdup((yyvsp[-1].expr)->alias);
-  if ((yyvsp[-7].table)->getName() != nullptr) left_col->table = strdup((yyvsp[-7].table)->getName());
-  auto right_col = Expr::makeColumnRef(strdup((yyvsp[-1].expr)->name));
-  if ((yyvsp[-1].expr)->alias != nullptr) right_col->alias = strdup((yyvsp[-1].expr)->alias);
-  if ((yyvsp[-4].table)->getName() != nullptr) right_col->table = strdup((yyvsp[-4].table)->getName());
+  auto left_col = Expr::makeColumnRef(arenaStrdup((yyvsp[-1].expr)->name));
+  if ((yyvsp[-1].expr)->alias != nullptr) left_col->alias = arenaStrdup((yyvsp[-1].expr)->alias);
+  if ((yyvsp[-7].table)->getName() != nullptr) left_col->table = arenaStrdup((yyvsp[-7].table)->getName());
+  auto right_col = Expr::makeColumnRef(arenaStrdup((yyvsp[-1].expr)->name));
+  if ((yyvsp[-1].expr)->alias != nullptr) right_col->alias = arenaStrdup((yyvsp[-1].expr)->alias);
+  if ((yyvsp[-4].table)->getName() != nullptr) right_col->table = arenaStrdup((yyvsp[-4].table)->getName());
   (yyval.table)->join->condition = Expr::makeOpBinary(left_col, kOpEquals, right_col);
-  delete (yyvsp[-1].expr);
+  arenaDelete((yyvsp[-1].expr));
 }
-#line 5037 "bison_parser.cpp"
+#line 5283 "bison_parser.cpp"
     break;
 
-  case 289: /* opt_join_type: INNER  */
-#line 1175 "bison_parser.y"
+  case 304: /* opt_join_type: INNER  */
+#line 1320 "bison_parser.y"
                       { (yyval.join_type) = kJoinInner; }
-#line 5043 "bison_parser.cpp"
+#line 5289 "bison_parser.cpp"
     break;
 
-  case 290: /* opt_join_type: LEFT OUTER  */
-#line 1176 "bison_parser.y"
+  case 305: /* opt_join_type: LEFT OUTER  */
+#line 1321 "bison_parser.y"
              { (yyval.join_type) = kJoinLeft; }
-#line 5049 "bison_parser.cpp"
+#line 5295 "bison_parser.cpp"
     break;
 
-  case 291: /* opt_join_type: LEFT  */
-#line 1177 "bison_parser.y"
+  case 306: /* opt_join_type: LEFT  */
+#line 1322 "bison_parser.y"
        { (yyval.join_type) = kJoinLeft; }
-#line 5055 "bison_parser.cpp"
+#line 5301 "bison_parser.cpp"
     break;
 
-  case 292: /* opt_join_type: RIGHT OUTER  */
-#line 1178 "bison_parser.y"
+  case 307: /* opt_join_type: RIGHT OUTER  */
+#line 1323 "bison_parser.y"
               { (yyval.join_type) = kJoinRight; }
-#line 5061 "bison_parser.cpp"
+#line 5307 "bison_parser.cpp"
     break;
 
-  case 293: /* opt_join_type: RIGHT  */
-#line 1179 "bison_parser.y"
+  case 308: /* opt_join_type: RIGHT  */
+#line 1324 "bison_parser.y"
         { (yyval.join_type) = kJoinRight; }
-#line 5067 "bison_parser.cpp"
+#line 5313 "bison_parser.cpp"
     break;
 
-  case 294: /* opt_join_type: FULL OUTER  */
-#line 1180 "bison_parser.y"
+  case 309: /* opt_join_type: FULL OUTER  */
+#line 1325 "bison_parser.y"
              { (yyval.join_type) = kJoinFull; }
-#line 5073 "bison_parser.cpp"
+#line 5319 "bison_parser.cpp"
     break;
 
-  case 295: /* opt_join_type: OUTER  */
-#line 1181 "bison_parser.y"
+  case 310: /* opt_join_type: OUTER  */
+#line 1326 "bison_parser.y"
         { (yyval.join_type) = kJoinFull; }
-#line 5079 "bison_parser.cpp"
+#line 5325 "bison_parser.cpp"
     break;
 
-  case 296: /* opt_join_type: FULL  */
-#line 1182 "bison_parser.y"
+  case 311: /* opt_join_type: FULL  */
+#line 1327 "bison_parser.y"
        { (yyval.join_type) = kJoinFull; }
-#line 5085 "bison_parser.cpp"
+#line 5331 "bison_parser.cpp"
     break;
 
-  case 297: /* opt_join_type: CROSS  */
-#line 1183 "bison_parser.y"
+  case 312: /* opt_join_type: CROSS  */
+#line 1328 "bison_parser.y"
         { (yyval.join_type) = kJoinCross; }
-#line 5091 "bison_parser.cpp"
+#line 5337 "bison_parser.cpp"
     break;
 
-  case 298: /* opt_join_type: %empty  */
-#line 1184 "bison_parser.y"
+  case 313: /* opt_join_type: %empty  */
+#line 1329 "bison_parser.y"
                        { (yyval.join_type) = kJoinInner; }
-#line 5097 "bison_parser.cpp"
+#line 5343 "bison_parser.cpp"
     break;
 
-  case 302: /* ident_commalist: IDENTIFIER  */
-#line 1195 "bison_parser.y"
+  case 317: /* ident_commalist: IDENTIFIER  */
+#line 1340 "bison_parser.y"
                              {
-  (yyval.str_vec) = new std::vector<char*>();
+  (yyval.str_vec) = arenaNew<std::vector<char*>>();
   (yyval.str_vec)->push_back((yyvsp[0].sval));
 }
-#line 5106 "bison_parser.cpp"
+#line 5352 "bison_parser.cpp"
     break;
 
-  case 303: /* ident_commalist: ident_commalist ',' IDENTIFIER  */
-#line 1199 "bison_parser.y"
+  case 318: /* ident_commalist: ident_commalist ',' IDENTIFIER  */
+#line 1344 "bison_parser.y"
                                  {
   (yyvsp[-2].str_vec)->push_back((yyvsp[0].sval));
   (yyval.str_vec) = (yyvsp[-2].str_vec);
 }
-#line 5115 "bison_parser.cpp"
+#line 5361 "bison_parser.cpp"
     break;
 
 
-#line 5119 "bison_parser.cpp"
+#line 5365 "bison_parser.cpp"
 
       default: break;
     }
@@ -5344,11 +5590,11 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 1205 "bison_parser.y"
+#line 1350 "bison_parser.y"
 
-// clang-format on
-/*********************************
+    // clang-format on
+    /*********************************
  ** Section 4: Additional C code
  *********************************/
 
-/* empty */
+    /* empty */
@@ -18,14 +18,47 @@
 
 #include <stdio.h>
 #include <string.h>
+#include "../util/LineIndex.h"
+#include "simd_lexer.h"
 
   using namespace hsql;
 
+// State of the current parse that is shared with the lexer, see parser_typedef.h.
+#define PARSE_STATE (static_cast<ParseState*>(hsql_get_extra(scanner)))
+
   int yyerror(YYLTYPE * llocp, SQLParserResult * result, yyscan_t scanner, const char* msg) {
     result->setIsValid(false);
-    result->setErrorDetails(strdup(msg), llocp->first_line, llocp->first_column);
+    // Line and column are only computed for the error, from the offsets of the preceding input.
+    const LineIndex lines(PARSE_STATE->input, llocp->first_offset);
+    result->setErrorDetails(strdup(msg), lines.line(llocp->first_offset), lines.column(llocp->first_offset));
     return 0;
   }
+
+  // Tokens are read from the hand-written lexer if the parse uses one (see ParserContext::setLexer).
+  static int hsql_next_token(YYSTYPE * lvalp, YYLTYPE * llocp, yyscan_t scanner) {
+    SimdLexer* lexer = PARSE_STATE->lexer;
+    return lexer != nullptr ? lexer->next(lvalp, llocp) : hsql_lex(lvalp, llocp, scanner);
+  }
+#undef yylex
+#define yylex hsql_next_token
+
+  // Frees the rows of a multi-row VALUES list, e.g. after an error.
+  static void deleteValuesList(ValuesList * rows) {
+    if (rows != nullptr && Arena::current() == nullptr) rows->deleteExpressions();
+    arenaDelete(rows);
+  }
+
+  // Returns a binary AND / OR node, or a flat one (see ParserContext::setFlattenLogicalOperators).
+  static Expr* makeLogicalOperator(Expr * expr1, OperatorType op, Expr * expr2, bool flatten) {
+    return flatten ? Expr::makeOpNary(expr1, op, expr2) : Expr::makeOpBinary(expr1, op, expr2);
+  }
+
+  // Returns true if the string of a date literal has the format YYYY-MM-DD.
+  static bool isValidDate(const char* date) {
+    int day{0}, month{0}, year{0}, chars_parsed{0};
+    // If the whole string is parsed, chars_parsed points to the terminating null byte after the last character
+    return sscanf(date, "%4d-%2d-%2d%n", &day, &month, &year, &chars_parsed) == 3 && date[chars_parsed] == 0;
+  }
   // clang-format off
 %}
 // clang-format on
@@ -43,20 +76,21 @@
 #include "../sql/statements.h"
 #include "parser_typedef.h"
 
-// Auto update column and line number
+// Auto update the location of each token
 #define YY_USER_ACTION                        \
-  yylloc->first_line = yylloc->last_line;     \
-  yylloc->first_column = yylloc->last_column; \
-  for (int i = 0; yytext[i] != '\0'; i++) {   \
-    yylloc->total_column++;                   \
-    yylloc->string_length++;                  \
-    if (yytext[i] == '\n') {                  \
-      yylloc->last_line++;                    \
-      yylloc->last_column = 0;                \
-    } else {                                  \
-      yylloc->last_column++;                  \
-    }                                         \
-  }
+  yylloc->first_offset = yylloc->last_offset; \
+  yylloc->last_offset += yyleng;
+
+// A rule spans from the first to the last character of its components
+#define YYLLOC_DEFAULT(Current, Rhs, N)                                              \
+  do {                                                                               \
+    if (N) {                                                                         \
+      (Current).first_offset = YYRHSLOC(Rhs, 1).first_offset;                        \
+      (Current).last_offset = YYRHSLOC(Rhs, N).last_offset;                         \
+    } else {                                                                         \
+      (Current).first_offset = (Current).last_offset = YYRHSLOC(Rhs, 0).last_offset; \
+    }                                                                                \
+  } while (0)
 }
 
 // Define the names of the created files (defined in Makefile)
@@ -76,12 +110,8 @@
 
 %initial-action {
   // Initialize
-  @$.first_column = 0;
-  @$.last_column = 0;
-  @$.first_line = 0;
-  @$.last_line = 0;
-  @$.total_column = 0;
-  @$.string_length = 0;
+  @$.first_offset = 0;
+  @$.last_offset = 0;
 };
 
 
@@ -139,6 +169,8 @@
   hsql::TableName table_name;
   hsql::TableRef* table;
   hsql::UpdateClause* update_t;
+  hsql::ValuesCell values_cell;
+  hsql::ValuesList* values_list;
   hsql::WithDescription* with_description_t;
 
   std::vector<char*>* str_vec;
@@ -159,17 +191,34 @@
      *********************************/
     // clang-format off
     %destructor { } <fval> <ival> <bval> <join_type> <order_type> <datetime_field> <column_type_t> <column_constraint_t> <import_type_t> <column_constraint_vec>
-    %destructor { free( ($$.name) ); free( ($$.schema) ); } <table_name>
-    %destructor { free( ($$) ); } <sval>
+    // In arena mode the destructors are no-ops, all semantic values are released with the arena.
+    %destructor { arenaFree( ($$.name) ); arenaFree( ($$.schema) ); } <table_name>
+    %destructor { arenaFree( ($$) ); } <sval>
+    %destructor {
+      if (($$) != nullptr && Arena::current() == nullptr) {
+        for (auto ptr : *($$)) {
+          arenaFree(ptr);
+        }
+      }
+      arenaDelete($$);
+    } <str_vec>
     %destructor {
-      if (($$) != nullptr) {
+      if (($$) != nullptr && Arena::current() == nullptr) {
         for (auto ptr : *($$)) {
           delete ptr;
         }
       }
-      delete ($$);
-    } <str_vec> <table_vec> <table_element_vec> <update_vec> <expr_vec> <order_vec> <stmt_vec>
-    %destructor { delete ($$); } <*>
+      arenaDelete($$);
+    } <table_vec> <table_element_vec> <update_vec> <expr_vec> <order_vec> <stmt_vec>
+    %destructor {
+      if (($$).type == kExprLiteralString || ($$).type == kExprLiteralDate) {
+        arenaFree( (($$).sval) );
+      } else if (($$).type == kExprLiteralInterval || ($$).type == kExprParameter) {
+        arenaDelete( (($$).expr) );
+      }
+    } <values_cell>
+    %destructor { deleteValuesList($$); } <values_list>
+    %destructor { arenaDelete($$); } <*>
 
 
     /*********************************
@@ -259,6 +308,8 @@
     %type <order_vec>              opt_order order_list
     %type <with_description_vec>   opt_with_clause with_clause with_description_list
     %type <update_vec>             update_clause_commalist
+    %type <values_cell>            values_cell
+    %type <values_list>            values_list values_rows values_row_begin
     %type <table_element_vec>      table_elem_commalist
 
     /******************************
@@ -297,28 +348,26 @@ input : statement_list opt_semicolon {
     result->addStatement(stmt);
   }
 
+  // The parameters were collected in the order of the query, which defines their ids.
   unsigned param_id = 0;
-  for (void* param : yyloc.param_list) {
-    if (param != nullptr) {
-      Expr* expr = (Expr*)param;
-      expr->ival = param_id;
-      result->addParameter(expr);
-      ++param_id;
-    }
+  for (Expr* param : *PARSE_STATE->parameters) {
+    param->ival = param_id;
+    ++param_id;
   }
-    delete $1;
+  result->setParameters(*PARSE_STATE->parameters);
+    arenaDelete($1);
   };
 
 // clang-format on
 statement_list : statement {
-  $1->stringLength = yylloc.string_length;
-  yylloc.string_length = 0;
-  $$ = new std::vector<SQLStatement*>();
+  $1->stringLength = yylloc.last_offset - PARSE_STATE->statementOffset;
+  PARSE_STATE->statementOffset = yylloc.last_offset;
+  $$ = arenaNew<std::vector<SQLStatement*>>();
   $$->push_back($1);
 }
 | statement_list ';' statement {
-  $3->stringLength = yylloc.string_length;
-  yylloc.string_length = 0;
+  $3->stringLength = yylloc.last_offset - PARSE_STATE->statementOffset;
+  PARSE_STATE->statementOffset = yylloc.last_offset;
   $1->push_back($3);
   $$ = $1;
 };
@@ -354,7 +403,7 @@ opt_hints : WITH HINT '(' hint_list ')' { $$ = $4; }
 | /* empty */ { $$ = nullptr; };
 
 hint_list : hint {
-  $$ = new std::vector<Expr*>();
+  $$ = arenaNew<std::vector<Expr*>>();
   $$->push_back($1);
 }
 | hint_list ',' hint {
@@ -430,16 +479,16 @@ file_type : IDENTIFIER {
   } else if (strcasecmp($1, "binary") == 0 || strcasecmp($1, "bin") == 0) {
     $$ = kImportBinary;
   } else {
-    free($1);
+    arenaFree($1);
     yyerror(&yyloc, result, scanner, "File type is unknown.");
     YYERROR;
   }
-  free($1);
+  arenaFree($1);
 };
 
 file_path : string_literal {
-  $$ = strdup($1->name);
-  delete $1;
+  $$ = arenaStrdup($1->name);
+  arenaDelete($1);
 };
 
 opt_file_type : WITH FORMAT file_type { $$ = $3; }
@@ -484,11 +533,11 @@ create_statement : CREATE TABLE opt_not_exists table_name FROM IDENTIFIER FILE f
   $$->schema = $4.schema;
   $$->tableName = $4.name;
   if (strcasecmp($6, "tbl") != 0) {
-    free($6);
+    arenaFree($6);
     yyerror(&yyloc, result, scanner, "File type is unknown.");
     YYERROR;
   }
-  free($6);
+  arenaFree($6);
   $$->filePath = $8;
 }
 | CREATE TABLE opt_not_exists table_name '(' table_elem_commalist ')' {
@@ -497,7 +546,7 @@ create_statement : CREATE TABLE opt_not_exists table_name FROM IDENTIFIER FILE f
   $$->schema = $4.schema;
   $$->tableName = $4.name;
   $$->setColumnDefsAndConstraints($6);
-  delete $6;
+  arenaDelete($6);
 }
 | CREATE TABLE opt_not_exists table_name AS select_statement {
   $$ = new CreateStatement(kCreateTable);
@@ -526,7 +575,7 @@ opt_not_exists : IF NOT EXISTS { $$ = true; }
 | /* empty */ { $$ = false; };
 
 table_elem_commalist : table_elem {
-  $$ = new std::vector<TableElement*>();
+  $$ = arenaNew<std::vector<TableElement*>>();
   $$->push_back($1);
 }
 | table_elem_commalist ',' table_elem {
@@ -549,7 +598,7 @@ column_type : INT { $$ = ColumnType{DataType::INT}; }
 | DATETIME { $$ = ColumnType{DataType::DATETIME}; }
 | DECIMAL opt_decimal_specification {
   $$ = ColumnType{DataType::DECIMAL, 0, $2->first, $2->second};
-  delete $2;
+  arenaDelete($2);
 }
 | DOUBLE { $$ = ColumnType{DataType::DOUBLE}; }
 | FLOAT { $$ = ColumnType{DataType::FLOAT}; }
@@ -564,15 +613,15 @@ column_type : INT { $$ = ColumnType{DataType::INT}; }
 opt_time_precision : '(' INTVAL ')' { $$ = $2; }
 | /* empty */ { $$ = 0; };
 
-opt_decimal_specification : '(' INTVAL ',' INTVAL ')' { $$ = new std::pair<int64_t, int64_t>{$2, $4}; }
-| '(' INTVAL ')' { $$ = new std::pair<int64_t, int64_t>{$2, 0}; }
-| /* empty */ { $$ = new std::pair<int64_t, int64_t>{0, 0}; };
+opt_decimal_specification : '(' INTVAL ',' INTVAL ')' { $$ = arenaNew<std::pair<int64_t, int64_t>>($2, $4); }
+| '(' INTVAL ')' { $$ = arenaNew<std::pair<int64_t, int64_t>>($2, 0); }
+| /* empty */ { $$ = arenaNew<std::pair<int64_t, int64_t>>(0, 0); };
 
 opt_column_constraints : column_constraint_list { $$ = $1; }
-| /* empty */ { $$ = new std::vector<ConstraintType>(); };
+| /* empty */ { $$ = arenaNew<std::vector<ConstraintType>>(); };
 
 column_constraint_list : column_constraint {
-  $$ = new std::vector<ConstraintType>();
+  $$ = arenaNew<std::vector<ConstraintType>>();
   $$->push_back($1);
 }
 | column_constraint_list column_constraint {
@@ -669,6 +718,13 @@ insert_statement : INSERT INTO table_name opt_column_list VALUES '(' literal_lis
   $$->columns = $4;
   $$->values = $7;
 }
+| INSERT INTO table_name opt_column_list VALUES values_list {
+  $$ = new InsertStatement(kInsertValues);
+  $$->schema = $3.schema;
+  $$->tableName = $3.name;
+  $$->columns = $4;
+  $$->rows = $6;
+}
 | INSERT INTO table_name opt_column_list select_no_paren {
   $$ = new InsertStatement(kInsertSelect);
   $$->schema = $3.schema;
@@ -680,6 +736,94 @@ insert_statement : INSERT INTO table_name opt_column_list VALUES '(' literal_lis
 opt_column_list : '(' ident_commalist ')' { $$ = $2; }
 | /* empty */ { $$ = nullptr; };
 
+// Rows after the first one are appended to their columns without creating an expression per value.
+values_list : values_rows ')' {
+  $$ = $1;
+  if (!$$->endRow()) {
+    yyerror(&@2, result, scanner, "VALUES lists must all be the same length.");
+    deleteValuesList($$);
+    YYERROR;
+  }
+};
+
+values_rows : values_row_begin values_cell {
+  // The first value of a row always fits.
+  $$ = $1;
+  $$->append($2);
+}
+| values_rows ',' values_cell {
+  $$ = $1;
+  if (!$$->append($3)) {
+    yyerror(&@3, result, scanner, "VALUES lists must all be the same length.");
+    deleteValuesList($$);
+    YYERROR;
+  }
+};
+
+values_row_begin : '(' literal_list ')' ',' '(' {
+  $$ = arenaNew<ValuesList>();
+  $$->appendLiterals($2);
+  $$->endRow();
+}
+| values_rows ')' ',' '(' {
+  $$ = $1;
+  if (!$$->endRow()) {
+    yyerror(&@2, result, scanner, "VALUES lists must all be the same length.");
+    deleteValuesList($$);
+    YYERROR;
+  }
+};
+
+values_cell : STRING {
+  $$.type = kExprLiteralString;
+  $$.isBool = false;
+  $$.sval = $1;
+}
+| INTVAL {
+  $$.type = kExprLiteralInt;
+  $$.isBool = false;
+  $$.ival = $1;
+}
+| FLOATVAL {
+  $$.type = kExprLiteralFloat;
+  $$.isBool = false;
+  $$.fval = $1;
+}
+| TRUE {
+  $$.type = kExprLiteralInt;
+  $$.isBool = true;
+  $$.ival = 1;
+}
+| FALSE {
+  $$.type = kExprLiteralInt;
+  $$.isBool = true;
+  $$.ival = 0;
+}
+| NULL {
+  $$.type = kExprLiteralNull;
+  $$.isBool = false;
+}
+| DATE STRING {
+  if (!isValidDate($2)) {
+    arenaFree($2);
+    yyerror(&yyloc, result, scanner, "Found incorrect date format. Expected format: YYYY-MM-DD");
+    YYERROR;
+  }
+  $$.type = kExprLiteralDate;
+  $$.isBool = false;
+  $$.sval = $2;
+}
+| interval_literal {
+  $$.type = kExprLiteralInterval;
+  $$.isBool = false;
+  $$.expr = $1;
+}
+| param_expr {
+  $$.type = kExprParameter;
+  $$.isBool = false;
+  $$.expr = $1;
+};
+
 /******************************
  * Update Statement
  * UPDATE students SET grade = 1.3, name='Felix Fürstenberg' WHERE name = 'Max Mustermann';
@@ -693,7 +837,7 @@ update_statement : UPDATE table_ref_name_no_alias SET update_clause_commalist op
 };
 
 update_clause_commalist : update_clause {
-  $$ = new std::vector<UpdateClause*>();
+  $$ = arenaNew<std::vector<UpdateClause*>>();
   $$->push_back($1);
 }
 | update_clause_commalist ',' update_clause {
@@ -722,7 +866,7 @@ select_statement : opt_with_clause select_with_paren {
 | opt_with_clause select_with_paren set_operator select_within_set_operation opt_order opt_limit {
   $$ = $2;
   if ($$->setOperations == nullptr) {
-    $$->setOperations = new std::vector<SetOperation*>();
+    $$->setOperations = arenaNew<std::vector<SetOperation*>>();
   }
   $$->setOperations->push_back($3);
   $$->setOperations->back()->nestedSelectStatement = $4;
@@ -737,7 +881,7 @@ select_within_set_operation_no_parentheses : select_clause { $$ = $1; }
 | select_clause set_operator select_within_set_operation {
   $$ = $1;
   if ($$->setOperations == nullptr) {
-    $$->setOperations = new std::vector<SetOperation*>();
+    $$->setOperations = arenaNew<std::vector<SetOperation*>>();
   }
   $$->setOperations->push_back($2);
   $$->setOperations->back()->nestedSelectStatement = $3;
@@ -752,14 +896,14 @@ select_no_paren : select_clause opt_order opt_limit {
 
   // Limit could have been set by TOP.
   if ($3 != nullptr) {
-    delete $$->limit;
+    arenaDelete($$->limit);
     $$->limit = $3;
   }
 }
 | select_clause set_operator select_within_set_operation opt_order opt_limit {
   $$ = $1;
   if ($$->setOperations == nullptr) {
-    $$->setOperations = new std::vector<SetOperation*>();
+    $$->setOperations = arenaNew<std::vector<SetOperation*>>();
   }
   $$->setOperations->push_back($2);
   $$->setOperations->back()->nestedSelectStatement = $3;
@@ -825,7 +969,7 @@ opt_order : ORDER BY order_list { $$ = $3; }
 | /* empty */ { $$ = nullptr; };
 
 order_list : order_desc {
-  $$ = new std::vector<OrderDescription*>();
+  $$ = arenaNew<std::vector<OrderDescription*>>();
   $$->push_back($1);
 }
 | order_list ',' order_desc {
@@ -855,7 +999,7 @@ opt_limit : LIMIT expr { $$ = new LimitDescription($2, nullptr); }
  * Expressions
  ******************************/
 expr_list : expr_alias {
-  $$ = new std::vector<Expr*>();
+  $$ = arenaNew<std::vector<Expr*>>();
   $$->push_back($1);
 }
 | expr_list ',' expr_alias {
@@ -867,7 +1011,7 @@ opt_literal_list : literal_list { $$ = $1; }
 | /* empty */ { $$ = nullptr; };
 
 literal_list : literal {
-  $$ = new std::vector<Expr*>();
+  $$ = arenaNew<std::vector<Expr*>>();
   $$->push_back($1);
 }
 | literal_list ',' literal {
@@ -878,8 +1022,8 @@ literal_list : literal {
 expr_alias : expr opt_alias {
   $$ = $1;
   if ($2) {
-    $$->alias = strdup($2->name);
-    delete $2;
+    $$->alias = arenaStrdup($2->name);
+    arenaDelete($2);
   }
 };
 
@@ -910,8 +1054,8 @@ binary_expr : comp_expr | operand '-' operand { $$ = Expr::makeOpBinary($1, kOpM
 | operand ILIKE operand { $$ = Expr::makeOpBinary($1, kOpILike, $3); }
 | operand CONCAT operand { $$ = Expr::makeOpBinary($1, kOpConcat, $3); };
 
-logic_expr : expr AND expr { $$ = Expr::makeOpBinary($1, kOpAnd, $3); }
-| expr OR expr { $$ = Expr::makeOpBinary($1, kOpOr, $3); };
+logic_expr : expr AND expr { $$ = makeLogicalOperator($1, kOpAnd, $3, PARSE_STATE->flattenLogicalOperators); }
+| expr OR expr { $$ = makeLogicalOperator($1, kOpOr, $3, PARSE_STATE->flattenLogicalOperators); };
 
 in_expr : operand IN '(' expr_list ')' { $$ = Expr::makeInOperator($1, $4); }
 | operand NOT IN '(' expr_list ')' { $$ = Expr::makeOpUnary(kOpNot, Expr::makeInOperator($1, $5)); }
@@ -939,7 +1083,7 @@ comp_expr : operand '=' operand { $$ = Expr::makeOpBinary($1, kOpEquals, $3); }
 | operand LESSEQ operand { $$ = Expr::makeOpBinary($1, kOpLessEq, $3); }
 | operand GREATEREQ operand { $$ = Expr::makeOpBinary($1, kOpGreaterEq, $3); };
 
-function_expr : IDENTIFIER '(' ')' { $$ = Expr::makeFunctionRef($1, new std::vector<Expr*>(), false); }
+function_expr : IDENTIFIER '(' ')' { $$ = Expr::makeFunctionRef($1, arenaNew<std::vector<Expr*>>(), false); }
 | IDENTIFIER '(' opt_distinct expr_list ')' { $$ = Expr::makeFunctionRef($1, $4, $3); };
 
 extract_expr : EXTRACT '(' datetime_field FROM expr ')' { $$ = Expr::makeExtract($3, $5); };
@@ -964,7 +1108,10 @@ duration_field : datetime_field | datetime_field_plural;
 
 array_expr : ARRAY '[' expr_list ']' { $$ = Expr::makeArray($3); };
 
-array_index : operand '[' int_literal ']' { $$ = Expr::makeArrayIndex($1, $3->ival); };
+array_index : operand '[' int_literal ']' {
+  $$ = Expr::makeArrayIndex($1, $3->ival);
+  arenaDelete($3);
+};
 
 between_expr : operand BETWEEN operand AND operand { $$ = Expr::makeBetween($1, $3, $5); };
 
@@ -988,10 +1135,8 @@ int_literal : INTVAL { $$ = Expr::makeLiteral($1); };
 null_literal : NULL { $$ = Expr::makeNullLiteral(); };
 
 date_literal : DATE STRING {
-  int day{0}, month{0}, year{0}, chars_parsed{0};
-  // If the whole string is parsed, chars_parsed points to the terminating null byte after the last character
-  if (sscanf($2, "%4d-%2d-%2d%n", &day, &month, &year, &chars_parsed) != 3 || $2[chars_parsed] != 0) {
-    free($2);
+  if (!isValidDate($2)) {
+    arenaFree($2);
     yyerror(&yyloc, result, scanner, "Found incorrect date format. Expected format: YYYY-MM-DD");
     YYERROR;
   }
@@ -1000,17 +1145,17 @@ date_literal : DATE STRING {
 
 interval_literal : int_literal duration_field {
   $$ = Expr::makeIntervalLiteral($1->ival, $2);
-  delete $1;
+  arenaDelete($1);
 }
 | INTERVAL STRING datetime_field {
   int duration{0}, chars_parsed{0};
   // If the whole string is parsed, chars_parsed points to the terminating null byte after the last character
   if (sscanf($2, "%d%n", &duration, &chars_parsed) != 1 || $2[chars_parsed] != 0) {
-    free($2);
+    arenaFree($2);
     yyerror(&yyloc, result, scanner, "Found incorrect interval format. Expected format: INTEGER");
     YYERROR;
   }
-  free($2);
+  arenaFree($2);
   $$ = Expr::makeIntervalLiteral(duration, $3);
 }
 | INTERVAL STRING {
@@ -1019,11 +1164,11 @@ interval_literal : int_literal duration_field {
   char unit_string[8];
   // If the whole string is parsed, chars_parsed points to the terminating null byte after the last character
   if (sscanf($2, "%d %7s%n", &duration, unit_string, &chars_parsed) != 2 || $2[chars_parsed] != 0) {
-    free($2);
+    arenaFree($2);
     yyerror(&yyloc, result, scanner, "Found incorrect interval format. Expected format: INTEGER INTERVAL_QUALIIFIER");
     YYERROR;
   }
-  free($2);
+  arenaFree($2);
 
   DatetimeField unit;
   if (strcasecmp(unit_string, "second") == 0 || strcasecmp(unit_string, "seconds") == 0) {
@@ -1046,9 +1191,9 @@ interval_literal : int_literal duration_field {
 };
 
 param_expr : '?' {
-  $$ = Expr::makeParameter(yylloc.total_column);
-  $$->ival2 = yyloc.param_list.size();
-  yyloc.param_list.push_back($$);
+  $$ = Expr::makeParameter(yylloc.last_offset);
+  $$->ival2 = PARSE_STATE->parameters->size();
+  PARSE_STATE->parameters->push_back($$);
 };
 
 /******************************
@@ -1071,7 +1216,7 @@ nonjoin_table_ref_atomic : table_ref_name | '(' select_statement ')' opt_table_a
 };
 
 table_ref_commalist : table_ref_atomic {
-  $$ = new std::vector<TableRef*>();
+  $$ = arenaNew<std::vector<TableRef*>>();
   $$->push_back($1);
 }
 | table_ref_commalist ',' table_ref_atomic {
@@ -1123,7 +1268,7 @@ opt_with_clause : with_clause | /* empty */ { $$ = nullptr; };
 with_clause : WITH with_description_list { $$ = $2; };
 
 with_description_list : with_description {
-  $$ = new std::vector<WithDescription*>();
+  $$ = arenaNew<std::vector<WithDescription*>>();
   $$->push_back($1);
 }
 | with_description_list ',' with_description {
@@ -1162,14 +1307,14 @@ join_clause : table_ref_atomic NATURAL JOIN nonjoin_table_ref_atomic {
   $$->join->type = (JoinType)$2;
   $$->join->left = $1;
   $$->join->right = $4;
-  auto left_col = Expr::makeColumnRef(strdup($7->name));
-  if ($7->alias != nullptr) left_col->alias = strdup($7->alias);
-  if ($1->getName() != nullptr) left_col->table = strdup($1->getName());
-  auto right_col = Expr::makeColumnRef(strdup($7->name));
-  if ($7->alias != nullptr) right_col->alias = strdup($7->alias);
-  if ($4->getName() != nullptr) right_col->table = strdup($4->getName());
+  auto left_col = Expr::makeColumnRef(arenaStrdup($7->name));
+  if ($7->alias != nullptr) left_col->alias = arenaStrdup($7->alias);
+  if ($1->getName() != nullptr) left_col->table = arenaStrdup($1->getName());
+  auto right_col = Expr::makeColumnRef(arenaStrdup($7->name));
+  if ($7->alias != nullptr) right_col->alias = arenaStrdup($7->alias);
+  if ($4->getName() != nullptr) right_col->table = arenaStrdup($4->getName());
   $$->join->condition = Expr::makeOpBinary(left_col, kOpEquals, right_col);
-  delete $7;
+  arenaDelete($7);
 };
 
 opt_join_type : INNER { $$ = kJoinInner; }
@@ -1193,7 +1338,7 @@ opt_semicolon : ';' | /* empty */
     ;
 
 ident_commalist : IDENTIFIER {
-  $$ = new std::vector<char*>();
+  $$ = arenaNew<std::vector<char*>>();
   $$->push_back($1);
 }
 | ident_commalist ',' IDENTIFIER {
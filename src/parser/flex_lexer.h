@@ -455,8 +455,7 @@ void yyfree(void*, yyscan_t yyscanner);
 
 #ifdef YY_HEADER_EXPORT_START_CONDITIONS
 #define INITIAL 0
-#define singlequotedstring 1
-#define COMMENT 2
+#define COMMENT 1
 
 #endif
 
@@ -1,5 +1,129 @@
 from __future__ import print_function
-import math
+
+# Generates sql_keywords.h from sql_keywords.txt and prints the keyword token
+# declarations for bison_parser.y.
+#
+# The lexer matches keywords with its identifier rule and classifies them with
+# the perfect hash in sql_keywords.h instead of one flex rule per keyword.
+# Run this script after editing sql_keywords.txt.
+
+
+# FNV-1a over the keyword with every character folded by `| 0x20`.
+# The lookup in sql_keywords.h has to compute exactly the same function.
+FNV_OFFSET = 2166136261
+FNV_PRIME = 16777619
+GOLDEN_RATIO = 0x9E3779B1
+MASK = 0xFFFFFFFF
+
+
+def fold(keyword):
+	return [ord(c) | 0x20 for c in keyword]
+
+
+def keyword_hash(keyword):
+	h = FNV_OFFSET
+	for c in fold(keyword):
+		h = ((h ^ c) * FNV_PRIME) & MASK
+	return h
+
+
+def slot(h, displacement, slot_bits):
+	return (((h ^ displacement) * GOLDEN_RATIO) & MASK) >> (32 - slot_bits)
+
+
+# Hash-and-displace: keywords are grouped into buckets by their hash. For each
+# bucket, largest first, search a displacement that moves all of its keywords
+# into free slots.
+def build_perfect_hash(keywords, bucket_bits, slot_bits):
+	buckets = [[] for _ in range(1 << bucket_bits)]
+	for keyword in keywords:
+		buckets[keyword_hash(keyword) & ((1 << bucket_bits) - 1)].append(keyword)
+
+	slots = [None] * (1 << slot_bits)
+	displacements = [0] * (1 << bucket_bits)
+	order = sorted(range(len(buckets)), key=lambda b: len(buckets[b]), reverse=True)
+	for b in order:
+		if not buckets[b]:
+			break
+
+		for displacement in range(1 << 16):
+			positions = [slot(keyword_hash(k), displacement, slot_bits) for k in buckets[b]]
+			if len(set(positions)) == len(positions) and all(slots[p] is None for p in positions):
+				break
+		else:
+			return None
+
+		displacements[b] = displacement
+		for keyword, position in zip(buckets[b], positions):
+			slots[position] = keyword
+
+	return displacements, slots
+
+
+def write_header(keywords, path):
+	bucket_bits = 6
+	slot_bits = 8
+	result = build_perfect_hash(keywords, bucket_bits, slot_bits)
+	assert result is not None, "no perfect hash found, increase the number of buckets"
+	displacements, slots = result
+
+	max_length = max(len(keyword) for keyword in keywords)
+	assert max_length < 16, "keywords have to fit into KeywordEntry::name"
+
+	with open(path, 'w') as out:
+		out.write("// Generated by keywordlist_generator.py from sql_keywords.txt. Do not edit.\n")
+		out.write("#ifndef __SQLPARSER__SQL_KEYWORDS_H__\n")
+		out.write("#define __SQLPARSER__SQL_KEYWORDS_H__\n\n")
+		out.write("#include <stddef.h>\n")
+		out.write("#include <stdint.h>\n")
+		out.write("#include \"bison_parser.h\"\n\n")
+		out.write("namespace hsql {\n\n")
+		out.write("struct KeywordEntry {\n")
+		out.write("  // Keyword with all characters folded by `| 0x20`.\n")
+		out.write("  char name[16];\n")
+		out.write("  uint8_t length;\n")
+		out.write("  int16_t token;\n")
+		out.write("};\n\n")
+		out.write("static const size_t kMaxKeywordLength = %d;\n\n" % max_length)
+
+		out.write("static const uint16_t kKeywordDisplacements[%d] = {" % len(displacements))
+		for i, displacement in enumerate(displacements):
+			out.write("\n    " if i % 16 == 0 else " ")
+			out.write("%d" % displacement)
+			if i + 1 < len(displacements):
+				out.write(",")
+		out.write("};\n\n")
+
+		out.write("static const KeywordEntry kKeywordSlots[%d] = {\n" % len(slots))
+		for keyword in slots:
+			if keyword is None:
+				out.write("    {\"\", 0, 0},\n")
+			else:
+				folded = "".join(chr(c) for c in fold(keyword))
+				out.write("    {\"%s\", %d, SQL_%s},\n" % (folded, len(keyword), keyword))
+		out.write("};\n\n")
+
+		out.write("// Returns the token of the keyword text[0..length) (case-insensitive) or 0 if it is no keyword.\n")
+		out.write("// text may only contain letters, digits and underscores; folding them by `| 0x20` maps exactly\n")
+		out.write("// the upper and lower case variant of a letter to the same character.\n")
+		out.write("inline int lookupKeyword(const char* text, size_t length) {\n")
+		out.write("  if (length > kMaxKeywordLength) return 0;\n\n")
+		out.write("  uint32_t hash = %du;\n" % FNV_OFFSET)
+		out.write("  for (size_t i = 0; i < length; ++i) {\n")
+		out.write("    hash = (hash ^ (static_cast<unsigned char>(text[i]) | 0x20)) * %du;\n" % FNV_PRIME)
+		out.write("  }\n\n")
+		out.write("  const uint32_t displacement = kKeywordDisplacements[hash & %d];\n" % (len(displacements) - 1))
+		out.write("  const KeywordEntry& entry = kKeywordSlots[((hash ^ displacement) * 0x%Xu) >> %d];\n" %
+		          (GOLDEN_RATIO, 32 - slot_bits))
+		out.write("  if (entry.length != length) return 0;\n\n")
+		out.write("  unsigned char difference = 0;\n")
+		out.write("  for (size_t i = 0; i < length; ++i) {\n")
+		out.write("    difference |= (static_cast<unsigned char>(text[i]) | 0x20) ^ static_cast<unsigned char>(entry.name[i]);\n")
+		out.write("  }\n")
+		out.write("  return difference == 0 ? entry.token : 0;\n")
+		out.write("}\n\n")
+		out.write("}  // namespace hsql\n\n")
+		out.write("#endif\n")
 
 
 with open("sql_keywords.txt", 'r') as fh:
@@ -11,17 +135,7 @@ with open("sql_keywords.txt", 'r') as fh:
 	#################
 	# Flex
 
-	max_len = len(max(keywords, key=lambda x: len(x))) + 1
-	max_len = 4 * int(math.ceil(max_len / 4.0))
-
-	for keyword in keywords:
-		len_diff = (max_len) - len(keyword)
-		num_tabs = int(math.floor(len_diff / 4.0))
-
-		if len_diff % 4 != 0: num_tabs += 1
-
-		tabs = ''.join(['\t' for _ in range(num_tabs)])
-		print("%s%sTOKEN(%s)" % (keyword, tabs, keyword))
+	write_header(keywords, "sql_keywords.h")
 
 	#
 	#################
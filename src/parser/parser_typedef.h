@@ -1,7 +1,10 @@
 #ifndef __PARSER_TYPEDEF_H__
 #define __PARSER_TYPEDEF_H__
 
+#include <stddef.h>
+#include <type_traits>
 #include <vector>
+#include "../util/Arena.h"
 
 #ifndef YYtypeDEF_YY_SCANNER_T
 #define YYtypeDEF_YY_SCANNER_T
@@ -11,23 +14,74 @@ typedef void* yyscan_t;
 #define YYSTYPE HSQL_STYPE
 #define YYLTYPE HSQL_LTYPE
 
+// Locations are byte offsets into the input. Lines and columns are only computed
+// from them when an error is reported (see LineIndex).
 struct HSQL_CUST_LTYPE {
-  int first_line;
-  int first_column;
-  int last_line;
-  int last_column;
+  // Offset of the first character.
+  size_t first_offset;
 
-  int total_column;
-
-  // Length of the string in the SQL query string
-  int string_length;
-
-  // Parameters.
-  // int param_id;
-  std::vector<void*> param_list;
+  // Offset behind the last character.
+  size_t last_offset;
 };
 
+// Bison copies locations on every shift and reduction, keep them trivially copyable.
+static_assert(std::is_trivially_copyable<HSQL_CUST_LTYPE>::value, "Location type must be trivially copyable");
+
 #define HSQL_LTYPE HSQL_CUST_LTYPE
 #define HSQL_LTYPE_IS_DECLARED 1
 
+namespace hsql {
+
+struct Expr;
+class SimdLexer;
+
+// State of a single parse that is shared by the lexer and parser actions.
+// Attached to the scanner as its extra data (yyextra) for the duration of the parse.
+struct ParseState {
+  // Start of the buffer the lexer scans.
+  const char* input;
+
+  // Copy of the input in the result's arena, or nullptr if the result is not in arena mode.
+  // Identifiers and string literals are null-terminated slices of this copy.
+  char* source;
+
+  // Parameters ('?') in the order they were parsed. Numbered and handed to the result
+  // once the input was parsed successfully. Kept out of the location type so that
+  // bison can copy locations trivially.
+  std::vector<Expr*>* parameters;
+
+  // Offset at which the current statement starts, used for SQLStatement::stringLength.
+  size_t statementOffset;
+
+  // Hand-written lexer that replaces the flex scanner for this parse, or nullptr.
+  SimdLexer* lexer;
+
+  // Build flat AND and OR nodes (see Expr::makeOpNary) instead of binary ones.
+  bool flattenLogicalOperators;
+
+  // Returns the length characters at text (which points into the input) as a null-terminated string.
+  // In arena mode the string is a slice of the source copy. The terminator overwrites the character
+  // behind the token, which is never part of another identifier or literal.
+  char* tokenString(const char* text, size_t length) {
+    if (source == nullptr) return arenaStrndup(text, length);
+    char* slice = source + (text - input);
+    slice[length] = '\0';
+    return slice;
+  }
+
+  // Like tokenString(), but replaces each escaped quote ('') by a single quote while copying.
+  char* unescapedString(const char* text, size_t length) {
+    char* string = source == nullptr ? arenaStringBuffer(length) : source + (text - input);
+    size_t out = 0;
+    for (size_t in = 0; in < length; ++in, ++out) {
+      string[out] = text[in];
+      if (text[in] == '\'') ++in;
+    }
+    string[out] = '\0';
+    return string;
+  }
+};
+
+}  // namespace hsql
+
 #endif
\ No newline at end of file
@@ -0,0 +1,432 @@
+#include "simd_lexer.h"
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <climits>
+#include "sql_keywords.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define HSQL_SIMD_LEXER_X86 1
+#include <immintrin.h>
+#endif
+
+namespace hsql {
+
+namespace {
+
+// Character classes of the rules in flex_lexer.l.
+enum CharClass : uint8_t {
+  kWhitespace = 1,        // [ \t\n]
+  kLetter = 2,            // [A-Za-z]
+  kIdentifierChar = 4,    // [A-Za-z0-9_]
+  kDigit = 8,             // [0-9]
+  kSingleCharToken = 16,  // [-+*/(){},.;<>=^%:?[\]|]
+};
+
+struct CharClasses {
+  uint8_t classes[256];
+
+  CharClasses() : classes() {
+    for (const char* c = " \t\n"; *c; ++c) classes[static_cast<uint8_t>(*c)] |= kWhitespace;
+    for (int c = 0; c < 26; ++c) {
+      classes['A' + c] |= kLetter | kIdentifierChar;
+      classes['a' + c] |= kLetter | kIdentifierChar;
+    }
+    for (int c = '0'; c <= '9'; ++c) classes[c] |= kDigit | kIdentifierChar;
+    classes[static_cast<uint8_t>('_')] |= kIdentifierChar;
+    for (const char* c = "-+*/(){},.;<>=^%:?[]|"; *c; ++c) classes[static_cast<uint8_t>(*c)] |= kSingleCharToken;
+  }
+
+  bool is(char c, CharClass charClass) const { return classes[static_cast<uint8_t>(c)] & charClass; }
+};
+
+const CharClasses kCharClasses;
+
+// Folds the case of letters, see lookupKeyword().
+bool equalsFolded(const char* text, const char* lowercase, size_t length) {
+  for (size_t i = 0; i < length; ++i) {
+    if ((text[i] | 0x20) != lowercase[i]) return false;
+  }
+  return true;
+}
+
+const char kLlongMin[] = "-9223372036854775808";
+
+// Scalar kernels
+
+const char* skipWhitespaceScalar(const char* begin, const char* end) {
+  while (begin < end && kCharClasses.is(*begin, kWhitespace)) ++begin;
+  return begin;
+}
+
+const char* skipIdentifierScalar(const char* begin, const char* end) {
+  while (begin < end && kCharClasses.is(*begin, kIdentifierChar)) ++begin;
+  return begin;
+}
+
+const char* findCharScalar(const char* begin, const char* end, char c) {
+  const void* found = memchr(begin, c, end - begin);
+  return found != nullptr ? static_cast<const char*>(found) : end;
+}
+
+const char* findQuoteScalar(const char* begin, const char* end) { return findCharScalar(begin, end, '\''); }
+
+const char* findNewlineScalar(const char* begin, const char* end) { return findCharScalar(begin, end, '\n'); }
+
+const char* findQuotedIdentifierEndScalar(const char* begin, const char* end) {
+  while (begin < end && *begin != '"' && *begin != '\n') ++begin;
+  return begin;
+}
+
+#ifdef HSQL_SIMD_LEXER_X86
+
+// SSE4.2 kernels. PCMPESTRI compares a block of 16 characters against a set of up to
+// 16 characters or 8 ranges and returns the index of the first (non-)matching character.
+// Blocks are only loaded while they lie within the input; the rest is scanned by the scalar kernels.
+
+template <int kMode>
+__attribute__((target("sse4.2"))) const char* scanSse42(const char* set, int setLength, const char* begin,
+                                                         const char* end) {
+  const __m128i needles = _mm_loadu_si128(reinterpret_cast<const __m128i*>(set));
+  while (end - begin >= 16) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+    const int index = _mm_cmpestri(needles, setLength, block, 16, kMode);
+    if (index < 16) return begin + index;
+    begin += 16;
+  }
+  return begin;
+}
+
+const char kWhitespaceSet[16] = {' ', '\t', '\n'};
+const char kIdentifierRanges[16] = {'A', 'Z', 'a', 'z', '0', '9', '_', '_'};
+const char kQuoteSet[16] = {'\''};
+const char kNewlineSet[16] = {'\n'};
+const char kQuotedIdentifierEndSet[16] = {'"', '\n'};
+
+const char* skipWhitespaceSse42(const char* begin, const char* end) {
+  begin = scanSse42<_SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_NEGATIVE_POLARITY>(kWhitespaceSet, 3, begin, end);
+  return skipWhitespaceScalar(begin, end);
+}
+
+const char* skipIdentifierSse42(const char* begin, const char* end) {
+  begin = scanSse42<_SIDD_UBYTE_OPS | _SIDD_CMP_RANGES | _SIDD_NEGATIVE_POLARITY>(kIdentifierRanges, 8, begin, end);
+  return skipIdentifierScalar(begin, end);
+}
+
+const char* findQuoteSse42(const char* begin, const char* end) {
+  begin = scanSse42<_SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY>(kQuoteSet, 1, begin, end);
+  return findQuoteScalar(begin, end);
+}
+
+const char* findNewlineSse42(const char* begin, const char* end) {
+  begin = scanSse42<_SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY>(kNewlineSet, 1, begin, end);
+  return findNewlineScalar(begin, end);
+}
+
+const char* findQuotedIdentifierEndSse42(const char* begin, const char* end) {
+  begin = scanSse42<_SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY>(kQuotedIdentifierEndSet, 2, begin, end);
+  return findQuotedIdentifierEndScalar(begin, end);
+}
+
+// AVX2 kernels. Each computes a mask of the characters of a 32 character block that end the run.
+
+__attribute__((target("avx2"))) const char* skipWhitespaceAvx2(const char* begin, const char* end) {
+  const __m256i space = _mm256_set1_epi8(' ');
+  const __m256i tab = _mm256_set1_epi8('\t');
+  const __m256i newline = _mm256_set1_epi8('\n');
+  while (end - begin >= 32) {
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin));
+    const __m256i whitespace = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(block, space), _mm256_cmpeq_epi8(block, tab)), _mm256_cmpeq_epi8(block, newline));
+    const uint32_t mask = ~static_cast<uint32_t>(_mm256_movemask_epi8(whitespace));
+    if (mask != 0) return begin + __builtin_ctz(mask);
+    begin += 32;
+  }
+  return skipWhitespaceScalar(begin, end);
+}
+
+__attribute__((target("avx2"))) const char* skipIdentifierAvx2(const char* begin, const char* end) {
+  // The comparisons are signed, characters >= 0x80 are negative and thus never letters or digits.
+  const __m256i caseBit = _mm256_set1_epi8(0x20);
+  const __m256i beforeA = _mm256_set1_epi8('a' - 1);
+  const __m256i afterZ = _mm256_set1_epi8('z' + 1);
+  const __m256i before0 = _mm256_set1_epi8('0' - 1);
+  const __m256i after9 = _mm256_set1_epi8('9' + 1);
+  const __m256i underscore = _mm256_set1_epi8('_');
+  while (end - begin >= 32) {
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin));
+    const __m256i folded = _mm256_or_si256(block, caseBit);
+    const __m256i letter = _mm256_and_si256(_mm256_cmpgt_epi8(folded, beforeA), _mm256_cmpgt_epi8(afterZ, folded));
+    const __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(block, before0), _mm256_cmpgt_epi8(after9, block));
+    const __m256i identifier = _mm256_or_si256(_mm256_or_si256(letter, digit), _mm256_cmpeq_epi8(block, underscore));
+    const uint32_t mask = ~static_cast<uint32_t>(_mm256_movemask_epi8(identifier));
+    if (mask != 0) return begin + __builtin_ctz(mask);
+    begin += 32;
+  }
+  return skipIdentifierScalar(begin, end);
+}
+
+__attribute__((target("avx2"))) const char* findCharAvx2(const char* begin, const char* end, char c) {
+  const __m256i needle = _mm256_set1_epi8(c);
+  while (end - begin >= 32) {
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin));
+    const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle)));
+    if (mask != 0) return begin + __builtin_ctz(mask);
+    begin += 32;
+  }
+  return findCharScalar(begin, end, c);
+}
+
+const char* findQuoteAvx2(const char* begin, const char* end) { return findCharAvx2(begin, end, '\''); }
+
+const char* findNewlineAvx2(const char* begin, const char* end) { return findCharAvx2(begin, end, '\n'); }
+
+__attribute__((target("avx2"))) const char* findQuotedIdentifierEndAvx2(const char* begin, const char* end) {
+  const __m256i quote = _mm256_set1_epi8('"');
+  const __m256i newline = _mm256_set1_epi8('\n');
+  while (end - begin >= 32) {
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin));
+    const __m256i found = _mm256_or_si256(_mm256_cmpeq_epi8(block, quote), _mm256_cmpeq_epi8(block, newline));
+    const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(found));
+    if (mask != 0) return begin + __builtin_ctz(mask);
+    begin += 32;
+  }
+  return findQuotedIdentifierEndScalar(begin, end);
+}
+
+#endif
+
+}  // namespace
+
+SimdLexer::SimdLexer(char* input, size_t length, ParseState* state, SimdLevel level)
+    : input_(input),
+      end_(input + length),
+      current_(input),
+      tokenBegin_(input),
+      hasError_(false),
+      state_(state),
+      kernels_(kernels(level)) {}
+
+size_t SimdLexer::tokenOffset() const { return tokenBegin_ - input_; }
+
+bool SimdLexer::hasError() const { return hasError_; }
+
+SimdLevel SimdLexer::detectSimdLevel() {
+#ifdef HSQL_SIMD_LEXER_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) return kSimdAvx2;
+  if (__builtin_cpu_supports("sse4.2")) return kSimdSse42;
+#endif
+  return kSimdNone;
+}
+
+const SimdLexer::Kernels& SimdLexer::kernels(SimdLevel level) {
+  static const Kernels scalar = {skipWhitespaceScalar, skipIdentifierScalar, findQuoteScalar, findNewlineScalar,
+                                 findQuotedIdentifierEndScalar};
+#ifdef HSQL_SIMD_LEXER_X86
+  static const Kernels sse42 = {skipWhitespaceSse42, skipIdentifierSse42, findQuoteSse42, findNewlineSse42,
+                                findQuotedIdentifierEndSse42};
+  static const Kernels avx2 = {skipWhitespaceAvx2, skipIdentifierAvx2, findQuoteAvx2, findNewlineAvx2,
+                               findQuotedIdentifierEndAvx2};
+  if (level == kSimdAvx2) return avx2;
+  if (level == kSimdSse42) return sse42;
+#endif
+  return scalar;
+}
+
+void SimdLexer::advance(HSQL_LTYPE* location, size_t length) {
+  location->first_offset = current_ - input_;
+  current_ += length;
+  location->last_offset = current_ - input_;
+}
+
+int SimdLexer::next(HSQL_STYPE* value, HSQL_LTYPE* location) {
+  while (current_ < end_) {
+    tokenBegin_ = current_;
+    const char c = *current_;
+    const bool hasNext = current_ + 1 < end_;
+    const char nextChar = hasNext ? current_[1] : '\0';
+
+    if (kCharClasses.is(c, kWhitespace)) {
+      // Most runs are a single space, only call the kernel for longer ones.
+      const char* run = current_ + 1;
+      if (hasNext && kCharClasses.is(nextChar, kWhitespace)) run = kernels_.skipWhitespace(run + 1, end_);
+      advance(location, run - current_);
+      continue;
+    }
+
+    if (kCharClasses.is(c, kLetter)) return scanIdentifier(value, location);
+    if (kCharClasses.is(c, kDigit) || (c == '.' && kCharClasses.is(nextChar, kDigit))) {
+      return scanNumber(value, location);
+    }
+
+    switch (c) {
+      case '-':
+        if (nextChar == '-') {
+          // Comments end at the next newline, which is skipped as well.
+          advance(location, 2);
+          const char* newline = kernels_.findNewline(current_, end_);
+          if (newline > current_) advance(location, newline - current_);
+          if (newline == end_) return 0;
+          advance(location, 1);
+          continue;
+        }
+        if (static_cast<size_t>(end_ - current_) >= sizeof(kLlongMin) - 1 &&
+            memcmp(current_, kLlongMin, sizeof(kLlongMin) - 1) == 0) {
+          // See the LLONG_MIN rule in flex_lexer.l.
+          advance(location, sizeof(kLlongMin) - 1);
+          value->ival = LLONG_MIN;
+          return SQL_INTVAL;
+        }
+        break;
+      case '=':
+        if (nextChar == '=') {
+          advance(location, 2);
+          return SQL_EQUALS;
+        }
+        break;
+      case '!':
+        if (nextChar == '=') {
+          advance(location, 2);
+          return SQL_NOTEQUALS;
+        }
+        break;
+      case '<':
+        if (nextChar == '>' || nextChar == '=') {
+          advance(location, 2);
+          return nextChar == '>' ? SQL_NOTEQUALS : SQL_LESSEQ;
+        }
+        break;
+      case '>':
+        if (nextChar == '=') {
+          advance(location, 2);
+          return SQL_GREATEREQ;
+        }
+        break;
+      case '|':
+        if (nextChar == '|') {
+          advance(location, 2);
+          return SQL_CONCAT;
+        }
+        break;
+      case '"': {
+        // Quoted identifiers are not empty and do not contain newlines.
+        const char* quote = kernels_.findQuotedIdentifierEnd(current_ + 1, end_);
+        if (quote == end_ || *quote != '"' || quote == current_ + 1) return unknownCharacter(location);
+        const char* text = current_ + 1;
+        advance(location, quote + 1 - current_);
+        value->sval = state_ != nullptr ? state_->tokenString(text, quote - text) : nullptr;
+        return SQL_IDENTIFIER;
+      }
+      case '\'':
+        return scanString(value, location);
+    }
+
+    if (kCharClasses.is(c, kSingleCharToken)) {
+      advance(location, 1);
+      return c;
+    }
+    return unknownCharacter(location);
+  }
+  return 0;
+}
+
+int SimdLexer::scanIdentifier(HSQL_STYPE* value, HSQL_LTYPE* location) {
+  const char* text = current_;
+
+  // Identifiers are short, scan a few characters before calling the kernel.
+  const char* end = current_ + 1;
+  const char* limit = end_ - end > 8 ? end + 8 : end_;
+  while (end < limit && kCharClasses.is(*end, kIdentifierChar)) ++end;
+  if (end == limit) end = kernels_.skipIdentifier(end, end_);
+  size_t length = end - text;
+
+  // CHARACTER[ \t\n]+VARYING is a single token.
+  if (length == 9 && equalsFolded(text, "character", 9) && end < end_ && kCharClasses.is(*end, kWhitespace)) {
+    const char* varying = kernels_.skipWhitespace(end, end_);
+    if (end_ - varying >= 7 && equalsFolded(varying, "varying", 7)) {
+      advance(location, varying + 7 - text);
+      return SQL_CHARACTER_VARYING;
+    }
+  }
+
+  advance(location, length);
+  const int keyword = lookupKeyword(text, length);
+  if (keyword != 0) return keyword;
+
+  value->sval = state_ != nullptr ? state_->tokenString(text, length) : nullptr;
+  return SQL_IDENTIFIER;
+}
+
+int SimdLexer::scanNumber(HSQL_STYPE* value, HSQL_LTYPE* location) {
+  char* text = current_;
+  char* end = text;
+  while (end < end_ && kCharClasses.is(*end, kDigit)) ++end;
+  const bool isFloat = end < end_ && *end == '.';
+  if (isFloat) {
+    ++end;
+    while (end < end_ && kCharClasses.is(*end, kDigit)) ++end;
+  }
+  advance(location, end - text);
+
+  // Terminate the number for the conversion like flex does. At the end of the input, this
+  // overwrites the first padding byte.
+  const char hold = *end;
+  *end = '\0';
+  int token = isFloat ? SQL_FLOATVAL : SQL_INTVAL;
+  if (isFloat) {
+    value->fval = atof(text);
+  } else {
+    errno = 0;
+    value->ival = strtoll(text, nullptr, 0);
+    if (errno) {
+      // The parser rejects the invalid token, also behind a complete statement, where the end
+      // of the input would be accepted.
+      fprintf(stderr, "[SQL-Lexer-Error] Integer cannot be parsed - is it out of range?\n");
+      hasError_ = true;
+      token = SQL_HSQL_UNDEF;
+    }
+  }
+  *end = hold;
+  return token;
+}
+
+int SimdLexer::scanString(HSQL_STYPE* value, HSQL_LTYPE* location) {
+  const char* text = current_ + 1;
+  bool escaped = false;
+
+  // The closing quote is the first quote that is not followed by another one.
+  const char* quote = kernels_.findQuote(text, end_);
+  while (quote + 1 < end_ && quote[1] == '\'') {
+    escaped = true;
+    quote = kernels_.findQuote(quote + 2, end_);
+  }
+
+  if (quote == end_) {
+    advance(location, end_ - current_);
+    fprintf(stderr, "[SQL-Lexer-Error] Unterminated string\n");
+    hasError_ = true;
+    return 0;
+  }
+
+  const size_t length = quote - text;
+  advance(location, quote + 1 - current_);
+  if (state_ == nullptr) {
+    value->sval = nullptr;
+  } else {
+    value->sval = escaped ? state_->unescapedString(text, length) : state_->tokenString(text, length);
+  }
+  return SQL_STRING;
+}
+
+int SimdLexer::unknownCharacter(HSQL_LTYPE* location) {
+  const char c = *current_;
+  advance(location, 1);
+  fprintf(stderr, "[SQL-Lexer-Error] Unknown Character: %c\n", c);
+  hasError_ = true;
+  return 0;
+}
+
+}  // namespace hsql
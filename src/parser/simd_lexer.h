@@ -0,0 +1,74 @@
+#ifndef __SQLPARSER__SIMD_LEXER_H__
+#define __SQLPARSER__SIMD_LEXER_H__
+
+#include <stddef.h>
+#include "bison_parser.h"
+
+namespace hsql {
+
+// Instruction set used by the SimdLexer to scan runs of characters.
+enum SimdLevel {
+  kSimdNone,   // Scalar code only
+  kSimdSse42,  // 16 bytes at a time with the SSE4.2 string instructions
+  kSimdAvx2    // 32 bytes at a time with AVX2 comparisons
+};
+
+// Hand-written alternative to the flex scanner in flex_lexer.l.
+// Returns the same tokens, values and locations as hsql_lex, so that the bison
+// grammar can use either of them. Whitespace, comments, identifiers and quoted
+// literals are scanned in blocks of 16 or 32 bytes if the CPU supports it.
+class SimdLexer {
+ public:
+  // Scans the length characters at input. Like flex, the lexer temporarily
+  // writes null bytes into the input to convert numbers.
+  // Identifiers and string literals are created through the given parse state. If state
+  // is nullptr, their values are not created and sval is set to nullptr.
+  SimdLexer(char* input, size_t length, ParseState* state, SimdLevel level);
+
+  // Returns the next token and stores its value and location, 0 at the end of the input or on an error.
+  int next(HSQL_STYPE* value, HSQL_LTYPE* location);
+
+  // Returns the offset of the first character of the last token. Unlike its location, the
+  // text of a string literal starts at its opening quote.
+  size_t tokenOffset() const;
+
+  // Returns true if the lexer found an invalid character, an unterminated string or an
+  // integer that does not fit into 64 bits.
+  bool hasError() const;
+
+  // Returns the best instruction set that is supported by the CPU.
+  static SimdLevel detectSimdLevel();
+
+ private:
+  // Scanning functions of one instruction set. Each returns the first character in
+  // [begin, end) that ends the respective run of characters, or end.
+  struct Kernels {
+    const char* (*skipWhitespace)(const char* begin, const char* end);
+    const char* (*skipIdentifier)(const char* begin, const char* end);
+    const char* (*findQuote)(const char* begin, const char* end);
+    const char* (*findNewline)(const char* begin, const char* end);
+    const char* (*findQuotedIdentifierEnd)(const char* begin, const char* end);
+  };
+
+  static const Kernels& kernels(SimdLevel level);
+
+  // Advances the location over length characters that the flex scanner matches with one rule.
+  void advance(HSQL_LTYPE* location, size_t length);
+
+  int scanIdentifier(HSQL_STYPE* value, HSQL_LTYPE* location);
+  int scanNumber(HSQL_STYPE* value, HSQL_LTYPE* location);
+  int scanString(HSQL_STYPE* value, HSQL_LTYPE* location);
+  int unknownCharacter(HSQL_LTYPE* location);
+
+  char* const input_;
+  const char* const end_;
+  char* current_;
+  const char* tokenBegin_;
+  bool hasError_;
+  ParseState* const state_;
+  const Kernels& kernels_;
+};
+
+}  // namespace hsql
+
+#endif
@@ -0,0 +1,309 @@
+// Generated by keywordlist_generator.py from sql_keywords.txt. Do not edit.
+#ifndef __SQLPARSER__SQL_KEYWORDS_H__
+#define __SQLPARSER__SQL_KEYWORDS_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include "bison_parser.h"
+
+namespace hsql {
+
+struct KeywordEntry {
+  // Keyword with all characters folded by `| 0x20`.
+  char name[16];
+  uint8_t length;
+  int16_t token;
+};
+
+static const size_t kMaxKeywordLength = 11;
+
+static const uint16_t kKeywordDisplacements[64] = {
+    0, 0, 1, 1, 0, 4, 0, 0, 2, 2, 0, 0, 1, 4, 5, 0,
+    1, 0, 0, 2, 1, 3, 2, 1, 17, 0, 0, 2, 0, 1, 2, 6,
+    0, 0, 0, 1, 0, 0, 3, 0, 1, 0, 3, 2, 3, 0, 4, 9,
+    4, 3, 8, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0};
+
+static const KeywordEntry kKeywordSlots[256] = {
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"values", 6, SQL_VALUES},
+    {"table", 5, SQL_TABLE},
+    {"second", 6, SQL_SECOND},
+    {"", 0, 0},
+    {"hash", 4, SQL_HASH},
+    {"transaction", 11, SQL_TRANSACTION},
+    {"format", 6, SQL_FORMAT},
+    {"index", 5, SQL_INDEX},
+    {"", 0, 0},
+    {"rename", 6, SQL_RENAME},
+    {"cascade", 7, SQL_CASCADE},
+    {"", 0, 0},
+    {"true", 4, SQL_TRUE},
+    {"hour", 4, SQL_HOUR},
+    {"", 0, 0},
+    {"explain", 7, SQL_EXPLAIN},
+    {"between", 7, SQL_BETWEEN},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"before", 6, SQL_BEFORE},
+    {"virtual", 7, SQL_VIRTUAL},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"all", 3, SQL_ALL},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"union", 5, SQL_UNION},
+    {"", 0, 0},
+    {"temporary", 9, SQL_TEMPORARY},
+    {"is", 2, SQL_IS},
+    {"on", 2, SQL_ON},
+    {"restrict", 8, SQL_RESTRICT},
+    {"unique", 6, SQL_UNIQUE},
+    {"", 0, 0},
+    {"right", 5, SQL_RIGHT},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"using", 5, SQL_USING},
+    {"as", 2, SQL_AS},
+    {"set", 3, SQL_SET},
+    {"", 0, 0},
+    {"isnull", 6, SQL_ISNULL},
+    {"", 0, 0},
+    {"ilike", 5, SQL_ILIKE},
+    {"local", 5, SQL_LOCAL},
+    {"of", 2, SQL_OF},
+    {"null", 4, SQL_NULL},
+    {"columns", 7, SQL_COLUMNS},
+    {"insert", 6, SQL_INSERT},
+    {"text", 4, SQL_TEXT},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"char", 4, SQL_CHAR},
+    {"where", 5, SQL_WHERE},
+    {"", 0, 0},
+    {"hours", 5, SQL_HOURS},
+    {"smallint", 8, SQL_SMALLINT},
+    {"", 0, 0},
+    {"like", 4, SQL_LIKE},
+    {"group", 5, SQL_GROUP},
+    {"plan", 4, SQL_PLAN},
+    {"merge", 5, SQL_MERGE},
+    {"", 0, 0},
+    {"to", 2, SQL_TO},
+    {"intersect", 9, SQL_INTERSECT},
+    {"minutes", 7, SQL_MINUTES},
+    {"parameters", 10, SQL_PARAMETERS},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"create", 6, SQL_CREATE},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"time", 4, SQL_TIME},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"exists", 6, SQL_EXISTS},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"limit", 5, SQL_LIMIT},
+    {"", 0, 0},
+    {"default", 7, SQL_DEFAULT},
+    {"call", 4, SQL_CALL},
+    {"alter", 5, SQL_ALTER},
+    {"decimal", 7, SQL_DECIMAL},
+    {"spatial", 7, SQL_SPATIAL},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"begin", 5, SQL_BEGIN},
+    {"control", 7, SQL_CONTROL},
+    {"with", 4, SQL_WITH},
+    {"in", 2, SQL_IN},
+    {"file", 4, SQL_FILE},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"minus", 5, SQL_MINUS},
+    {"", 0, 0},
+    {"for", 3, SQL_FOR},
+    {"escape", 6, SQL_ESCAPE},
+    {"", 0, 0},
+    {"date", 4, SQL_DATE},
+    {"", 0, 0},
+    {"left", 4, SQL_LEFT},
+    {"", 0, 0},
+    {"seconds", 7, SQL_SECONDS},
+    {"offset", 6, SQL_OFFSET},
+    {"interval", 8, SQL_INTERVAL},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"add", 3, SQL_ADD},
+    {"or", 2, SQL_OR},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"after", 5, SQL_AFTER},
+    {"truncate", 8, SQL_TRUNCATE},
+    {"timestamp", 9, SQL_TIMESTAMP},
+    {"datetime", 8, SQL_DATETIME},
+    {"asc", 3, SQL_ASC},
+    {"view", 4, SQL_VIEW},
+    {"integer", 7, SQL_INTEGER},
+    {"then", 4, SQL_THEN},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"update", 6, SQL_UPDATE},
+    {"nvarchar", 8, SQL_NVARCHAR},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"import", 6, SQL_IMPORT},
+    {"cross", 5, SQL_CROSS},
+    {"", 0, 0},
+    {"if", 2, SQL_IF},
+    {"not", 3, SQL_NOT},
+    {"natural", 7, SQL_NATURAL},
+    {"", 0, 0},
+    {"end", 3, SQL_END},
+    {"hint", 4, SQL_HINT},
+    {"order", 5, SQL_ORDER},
+    {"array", 5, SQL_ARRAY},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"outer", 5, SQL_OUTER},
+    {"", 0, 0},
+    {"into", 4, SQL_INTO},
+    {"global", 6, SQL_GLOBAL},
+    {"tables", 6, SQL_TABLES},
+    {"load", 4, SQL_LOAD},
+    {"", 0, 0},
+    {"when", 4, SQL_WHEN},
+    {"copy", 4, SQL_COPY},
+    {"show", 4, SQL_SHOW},
+    {"join", 4, SQL_JOIN},
+    {"having", 6, SQL_HAVING},
+    {"year", 4, SQL_YEAR},
+    {"minute", 6, SQL_MINUTE},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"analyze", 7, SQL_ANALYZE},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"full", 4, SQL_FULL},
+    {"long", 4, SQL_LONG},
+    {"", 0, 0},
+    {"day", 3, SQL_DAY},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"delta", 5, SQL_DELTA},
+    {"", 0, 0},
+    {"false", 5, SQL_FALSE},
+    {"commit", 6, SQL_COMMIT},
+    {"years", 5, SQL_YEARS},
+    {"", 0, 0},
+    {"except", 6, SQL_EXCEPT},
+    {"", 0, 0},
+    {"describe", 8, SQL_DESCRIBE},
+    {"schema", 6, SQL_SCHEMA},
+    {"", 0, 0},
+    {"double", 6, SQL_DOUBLE},
+    {"", 0, 0},
+    {"direct", 6, SQL_DIRECT},
+    {"execute", 7, SQL_EXECUTE},
+    {"desc", 4, SQL_DESC},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"primary", 7, SQL_PRIMARY},
+    {"prepare", 7, SQL_PREPARE},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"days", 4, SQL_DAYS},
+    {"by", 2, SQL_BY},
+    {"cast", 4, SQL_CAST},
+    {"rollback", 8, SQL_ROLLBACK},
+    {"float", 5, SQL_FLOAT},
+    {"top", 3, SQL_TOP},
+    {"key", 3, SQL_KEY},
+    {"", 0, 0},
+    {"months", 6, SQL_MONTHS},
+    {"", 0, 0},
+    {"varchar", 7, SQL_VARCHAR},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"month", 5, SQL_MONTH},
+    {"and", 3, SQL_AND},
+    {"", 0, 0},
+    {"off", 3, SQL_OFF},
+    {"select", 6, SQL_SELECT},
+    {"column", 6, SQL_COLUMN},
+    {"from", 4, SQL_FROM},
+    {"case", 4, SQL_CASE},
+    {"delete", 6, SQL_DELETE},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"extract", 7, SQL_EXTRACT},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"int", 3, SQL_INT},
+    {"", 0, 0},
+    {"inner", 5, SQL_INNER},
+    {"", 0, 0},
+    {"deallocate", 10, SQL_DEALLOCATE},
+    {"sorted", 6, SQL_SORTED},
+    {"real", 4, SQL_REAL},
+    {"", 0, 0},
+    {"", 0, 0},
+    {"unload", 6, SQL_UNLOAD},
+    {"drop", 4, SQL_DROP},
+    {"schemas", 7, SQL_SCHEMAS},
+    {"", 0, 0},
+    {"else", 4, SQL_ELSE},
+    {"distinct", 8, SQL_DISTINCT},
+    {"", 0, 0},
+};
+
+// Returns the token of the keyword text[0..length) (case-insensitive) or 0 if it is no keyword.
+// text may only contain letters, digits and underscores; folding them by `| 0x20` maps exactly
+// the upper and lower case variant of a letter to the same character.
+inline int lookupKeyword(const char* text, size_t length) {
+  if (length > kMaxKeywordLength) return 0;
+
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; ++i) {
+    hash = (hash ^ (static_cast<unsigned char>(text[i]) | 0x20)) * 16777619u;
+  }
+
+  const uint32_t displacement = kKeywordDisplacements[hash & 63];
+  const KeywordEntry& entry = kKeywordSlots[((hash ^ displacement) * 0x9E3779B1u) >> 24];
+  if (entry.length != length) return 0;
+
+  unsigned char difference = 0;
+  for (size_t i = 0; i < length; ++i) {
+    difference |= (static_cast<unsigned char>(text[i]) | 0x20) ^ static_cast<unsigned char>(entry.name[i]);
+  }
+  return difference == 0 ? entry.token : 0;
+}
+
+}  // namespace hsql
+
+#endif
@@ -10,7 +10,7 @@ enum ActionType {
   DropColumn,
 };
 
-struct AlterAction {
+struct AlterAction : ArenaAllocated {
   AlterAction(ActionType type);
   ActionType type;
   virtual ~AlterAction();
@@ -0,0 +1,99 @@
+#include "CompactExpr.h"
+#include <string.h>
+#include <vector>
+
+namespace hsql {
+
+static_assert(sizeof(CompactExpr) == sizeof(uint64_t), "the header must fit into one word");
+static_assert(sizeof(ColumnType) % sizeof(uint64_t) == 0, "fields must stay aligned to words");
+static_assert(kExprCast < 32 && kOpExists < 32 && kDatetimeYear < 8, "enums must fit into the header");
+static_assert(7 + sizeof(ColumnType) / sizeof(uint64_t) < 16, "the operand offset must fit into the header");
+
+CompactExpr* CompactExpr::makeNode(const Expr* expr, Arena* arena) {
+  uint32_t fields = 0;
+  if (expr->name != nullptr) fields |= 1u << kName;
+  if (expr->table != nullptr) fields |= 1u << kTable;
+  if (expr->alias != nullptr) fields |= 1u << kAlias;
+  if (expr->select != nullptr) fields |= 1u << kSelect;
+  if (expr->ival != 0) fields |= 1u << kIval;
+  if (expr->fval != 0) fields |= 1u << kFval;
+  if (expr->ival2 != 0) fields |= 1u << kIval2;
+  if (expr->columnType.data_type != DataType::UNKNOWN) fields |= 1u << kColumnType;
+  if (expr->expr != nullptr) fields |= 1u << kExpr;
+  if (expr->expr2 != nullptr) fields |= 1u << kExpr2;
+  if (expr->exprList != nullptr) fields |= 1u << kExprList;
+  if (expr->distinct) fields |= 1u << kDistinct;
+  if (expr->isBoolLiteral) fields |= 1u << kBoolLiteral;
+
+  const size_t numOperands =
+      (expr->expr != nullptr) + (expr->expr2 != nullptr) + (expr->exprList != nullptr ? expr->exprList->size() : 0);
+  const size_t operandOffset =
+      __builtin_popcount(fields & ((1u << kExpr) - 1)) + ((fields >> kColumnType) & 1 ? kColumnTypeWords - 1 : 0);
+  const size_t numWords = operandOffset + numOperands;
+
+  CompactExpr* node = ::new (arena->allocate(sizeof(CompactExpr) + numWords * sizeof(uint64_t), alignof(uint64_t)))
+      CompactExpr();
+  node->type_ = expr->type;
+  node->opType_ = expr->opType;
+  node->datetimeField_ = expr->datetimeField;
+  node->fields_ = fields;
+  node->operandOffset_ = operandOffset;
+  node->numOperands_ = numOperands;
+
+  uint64_t* data = reinterpret_cast<uint64_t*>(node + 1);
+  auto copyString = [arena](const char* source) { return arena->copyString(source, strlen(source)); };
+  if (expr->name != nullptr) *reinterpret_cast<const char**>(data + node->offset(kName)) = copyString(expr->name);
+  if (expr->table != nullptr) *reinterpret_cast<const char**>(data + node->offset(kTable)) = copyString(expr->table);
+  if (expr->alias != nullptr) *reinterpret_cast<const char**>(data + node->offset(kAlias)) = copyString(expr->alias);
+  if (expr->select != nullptr) *reinterpret_cast<const SelectStatement**>(data + node->offset(kSelect)) = expr->select;
+  if (expr->ival != 0) *reinterpret_cast<int64_t*>(data + node->offset(kIval)) = expr->ival;
+  if (expr->fval != 0) *reinterpret_cast<double*>(data + node->offset(kFval)) = expr->fval;
+  if (expr->ival2 != 0) *reinterpret_cast<int64_t*>(data + node->offset(kIval2)) = expr->ival2;
+  if (node->has(kColumnType)) {
+    ::new (data + node->offset(kColumnType)) ColumnType(expr->columnType);
+  }
+  return node;
+}
+
+const CompactExpr* CompactExpr::make(const Expr* expr, Arena* arena) {
+  if (expr == nullptr) return nullptr;
+
+  // The tree is copied from an explicit stack instead of recursively, like Expr::~Expr. A node is
+  // allocated before its operands, so the copy is laid out in depth-first order.
+  struct Task {
+    const Expr* expr;
+    const CompactExpr** target;
+  };
+  const CompactExpr* root = nullptr;
+  std::vector<Task> tasks = {{expr, &root}};
+  std::vector<const Expr*> operands;
+  while (!tasks.empty()) {
+    const Task task = tasks.back();
+    tasks.pop_back();
+    if (task.expr == nullptr) {
+      *task.target = nullptr;
+      continue;
+    }
+
+    CompactExpr* node = makeNode(task.expr, arena);
+    *task.target = node;
+
+    operands.clear();
+    if (task.expr->expr != nullptr) operands.push_back(task.expr->expr);
+    if (task.expr->expr2 != nullptr) operands.push_back(task.expr->expr2);
+    if (task.expr->exprList != nullptr) {
+      operands.insert(operands.end(), task.expr->exprList->begin(), task.expr->exprList->end());
+    }
+    // The first operand is copied first.
+    const CompactExpr** targets = const_cast<const CompactExpr**>(node->operands());
+    for (size_t i = operands.size(); i-- > 0;) tasks.push_back({operands[i], &targets[i]});
+  }
+  return root;
+}
+
+bool CompactExpr::isLiteral() const {
+  return isType(kExprLiteralInt) || isType(kExprLiteralFloat) || isType(kExprLiteralString) || isType(kExprParameter) ||
+         isType(kExprLiteralNull) || isType(kExprLiteralDate) || isType(kExprLiteralInterval);
+}
+
+}  // namespace hsql
@@ -0,0 +1,145 @@
+#ifndef SQLPARSER_COMPACT_EXPR_H
+#define SQLPARSER_COMPACT_EXPR_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../util/Arena.h"
+#include "ColumnType.h"
+#include "Expr.h"
+
+namespace hsql {
+
+struct CompactExpr;
+
+// Operands of a CompactExpr, the counterpart of Expr::exprList.
+class CompactExprList {
+ public:
+  CompactExprList(const CompactExpr* const* begin, size_t size) : begin_(begin), size_(size) {}
+
+  const CompactExpr* const* begin() const { return begin_; }
+  const CompactExpr* const* end() const { return begin_ + size_; }
+  const CompactExpr* operator[](size_t i) const { return begin_[i]; }
+  const CompactExpr* at(size_t i) const { return begin_[i]; }
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+ private:
+  const CompactExpr* const* begin_;
+  size_t size_;
+};
+
+// Read-only copy of an Expr tree in an arena, for consumers that keep or repeatedly walk large
+// expressions. Every Expr carries all fields of all kinds of expressions and a vtable pointer.
+// A CompactExpr is an 8 byte header followed by only the fields the node uses, e.g. 16 bytes for
+// an integer literal and 24 bytes for a binary operator. Fields that are null or zero are left out.
+// Nodes are laid out in depth-first order, so traversals touch consecutive memory.
+//
+// The accessors mirror the fields of Expr and return nullptr or zero for absent fields.
+// Subqueries are not copied: select() points to the SelectStatement of the source tree.
+struct CompactExpr {
+  // Copies the tree into the arena, which owns the copy. Returns nullptr if expr is nullptr.
+  static const CompactExpr* make(const Expr* expr, Arena* arena);
+
+  CompactExpr(const CompactExpr&) = delete;
+  CompactExpr& operator=(const CompactExpr&) = delete;
+
+  ExprType type() const { return static_cast<ExprType>(type_); }
+  OperatorType opType() const { return static_cast<OperatorType>(opType_); }
+  DatetimeField datetimeField() const { return static_cast<DatetimeField>(datetimeField_); }
+  bool isBoolLiteral() const { return has(kBoolLiteral); }
+  bool distinct() const { return has(kDistinct); }
+
+  const CompactExpr* expr() const { return has(kExpr) ? operands()[0] : nullptr; }
+  const CompactExpr* expr2() const { return has(kExpr2) ? operands()[has(kExpr)] : nullptr; }
+  // Empty if the source has no exprList, see hasExprList().
+  CompactExprList exprList() const {
+    const size_t numInline = has(kExpr) + has(kExpr2);
+    return CompactExprList(operands() + numInline, numOperands_ - numInline);
+  }
+  bool hasExprList() const { return has(kExprList); }
+
+  const SelectStatement* select() const { return has(kSelect) ? field<const SelectStatement*>(kSelect) : nullptr; }
+  const char* name() const { return has(kName) ? field<const char*>(kName) : nullptr; }
+  const char* table() const { return has(kTable) ? field<const char*>(kTable) : nullptr; }
+  const char* alias() const { return has(kAlias) ? field<const char*>(kAlias) : nullptr; }
+  double fval() const { return has(kFval) ? field<double>(kFval) : 0; }
+  int64_t ival() const { return has(kIval) ? field<int64_t>(kIval) : 0; }
+  int64_t ival2() const { return has(kIval2) ? field<int64_t>(kIval2) : 0; }
+  ColumnType columnType() const {
+    return has(kColumnType) ? field<ColumnType>(kColumnType) : ColumnType(DataType::UNKNOWN, 0);
+  }
+
+  // Same as the methods of Expr.
+
+  bool isType(ExprType exprType) const { return type() == exprType; }
+
+  bool isLiteral() const;
+
+  bool hasAlias() const { return has(kAlias); }
+
+  bool hasTable() const { return has(kTable); }
+
+  const char* getName() const { return alias() != nullptr ? alias() : name(); }
+
+  bool isNaryOperator(OperatorType op) const {
+    return type() == kExprOperator && opType() == op && !has(kExpr) && has(kExprList);
+  }
+
+ private:
+  // Optional fields in the order they follow the header. Each takes 8 bytes, except for the
+  // column type, which takes sizeof(ColumnType). The operands come last: expr, expr2 and the
+  // elements of exprList, as far as they exist.
+  enum Field {
+    kName,
+    kTable,
+    kAlias,
+    kSelect,
+    kIval,
+    kFval,
+    kIval2,
+    kColumnType,
+    kExpr,
+    kExpr2,
+    kExprList,
+    // Flags without data.
+    kDistinct,
+    kBoolLiteral,
+    kNumFields
+  };
+
+  static constexpr size_t kColumnTypeWords = sizeof(ColumnType) / sizeof(uint64_t);
+
+  CompactExpr() = default;
+
+  // Allocates the node for expr and copies its fields. The operand pointers are left uninitialized.
+  static CompactExpr* makeNode(const Expr* expr, Arena* arena);
+
+  // The operands are read on every step of a traversal, so their position is stored in the header.
+  const CompactExpr* const* operands() const {
+    return reinterpret_cast<const CompactExpr* const*>(reinterpret_cast<const uint64_t*>(this + 1) + operandOffset_);
+  }
+
+  bool has(Field f) const { return (fields_ >> f) & 1; }
+
+  // Returns the position of the field in 8 byte words after the header.
+  size_t offset(Field f) const {
+    const uint32_t preceding = fields_ & ((1u << f) - 1);
+    return __builtin_popcount(preceding) + ((f > kColumnType && has(kColumnType)) ? kColumnTypeWords - 1 : 0);
+  }
+
+  template <typename T>
+  const T& field(Field f) const {
+    return reinterpret_cast<const T*>(reinterpret_cast<const uint64_t*>(this + 1) + offset(f))[0];
+  }
+
+  uint32_t type_ : 5;
+  uint32_t opType_ : 5;
+  uint32_t datetimeField_ : 3;
+  uint32_t fields_ : kNumFields;
+  uint32_t operandOffset_ : 4;
+  uint32_t numOperands_;
+};
+
+}  // namespace hsql
+
+#endif
@@ -13,7 +13,7 @@ struct SelectStatement;
 enum struct ConstraintType { None, NotNull, Null, PrimaryKey, Unique };
 
 // Superclass for both TableConstraint and Column Definition
-struct TableElement {
+struct TableElement : ArenaAllocated {
   virtual ~TableElement() {}
 };
 
@@ -66,8 +66,8 @@ struct CreateStatement : SQLStatement {
   ~CreateStatement() override;
 
   void setColumnDefsAndConstraints(std::vector<TableElement*>* tableElements) {
-    columns = new std::vector<ColumnDefinition*>();
-    tableConstraints = new std::vector<TableConstraint*>();
+    columns = arenaNew<std::vector<ColumnDefinition*>>();
+    tableConstraints = arenaNew<std::vector<TableConstraint*>>();
 
     for (auto tableElem : *tableElements) {
       if (auto* colDef = dynamic_cast<ColumnDefinition*>(tableElem)) {
@@ -1,6 +1,7 @@
 #include "Expr.h"
 #include <stdio.h>
 #include <string.h>
+#include <vector>
 #include "SelectStatement.h"
 
 namespace hsql {
@@ -23,19 +24,41 @@ Expr::Expr(ExprType type)
       opType(kOpNone),
       distinct(false){};
 
+namespace {
+
+// Moves the operands of expr onto the stack, so that deleting expr does not recurse into them.
+void detachOperands(Expr* expr, std::vector<Expr*>* stack) {
+  if (expr->expr != nullptr) stack->push_back(expr->expr);
+  if (expr->expr2 != nullptr) stack->push_back(expr->expr2);
+  if (expr->exprList != nullptr) {
+    for (Expr* e : *expr->exprList) {
+      if (e != nullptr) stack->push_back(e);
+    }
+    delete expr->exprList;
+  }
+  expr->expr = nullptr;
+  expr->expr2 = nullptr;
+  expr->exprList = nullptr;
+}
+
+}  // namespace
+
 Expr::~Expr() {
-  delete expr;
-  delete expr2;
   delete select;
   free(name);
   free(table);
   free(alias);
 
-  if (exprList != nullptr) {
-    for (Expr* e : *exprList) {
-      delete e;
-    }
-    delete exprList;
+  // Operands are deleted from an explicit stack instead of recursively, so that deep trees (e.g. long
+  // chains of AND) do not overflow the call stack. Leaves do not allocate the stack.
+  if (expr == nullptr && expr2 == nullptr && exprList == nullptr) return;
+  std::vector<Expr*> stack;
+  detachOperands(this, &stack);
+  while (!stack.empty()) {
+    Expr* operand = stack.back();
+    stack.pop_back();
+    detachOperands(operand, &stack);
+    delete operand;
   }
 }
 
@@ -60,11 +83,35 @@ Expr* Expr::makeOpBinary(Expr* expr1, OperatorType op, Expr* expr2) {
   return e;
 }
 
+Expr* Expr::makeOpNary(Expr* expr1, OperatorType op, Expr* expr2) {
+  Expr* e = expr1;
+  if (!expr1->isNaryOperator(op)) {
+    e = new Expr(kExprOperator);
+    e->opType = op;
+    e->exprList = arenaNew<std::vector<Expr*>>();
+    e->exprList->push_back(expr1);
+  }
+
+  if (expr2->isNaryOperator(op)) {
+    // The operands are moved over and the empty node is released.
+    e->exprList->insert(e->exprList->end(), expr2->exprList->begin(), expr2->exprList->end());
+    expr2->exprList->clear();
+    arenaDelete(expr2);
+  } else {
+    e->exprList->push_back(expr2);
+  }
+  return e;
+}
+
+bool Expr::isNaryOperator(OperatorType op) const {
+  return type == kExprOperator && opType == op && expr == nullptr && exprList != nullptr;
+}
+
 Expr* Expr::makeBetween(Expr* expr, Expr* left, Expr* right) {
   Expr* e = new Expr(kExprOperator);
   e->expr = expr;
   e->opType = kOpBetween;
-  e->exprList = new std::vector<Expr*>();
+  e->exprList = arenaNew<std::vector<Expr*>>();
   e->exprList->push_back(left);
   e->exprList->push_back(right);
   return e;
@@ -75,7 +122,7 @@ Expr* Expr::makeCaseList(Expr* caseListElement) {
   // Case list expressions are temporary and will be integrated into the case
   // expressions exprList - thus assign operator type kOpNone
   e->opType = kOpNone;
-  e->exprList = new std::vector<Expr*>();
+  e->exprList = arenaNew<std::vector<Expr*>>();
   e->exprList->push_back(caseListElement);
   return e;
 }
@@ -100,7 +147,7 @@ Expr* Expr::makeCase(Expr* expr, Expr* caseList, Expr* elseExpr) {
   e->expr2 = elseExpr;
   e->exprList = caseList->exprList;
   caseList->exprList = nullptr;
-  delete caseList;
+  arenaDelete(caseList);
   return e;
 }
 
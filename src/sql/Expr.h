@@ -4,6 +4,7 @@
 #include <stdlib.h>
 #include <memory>
 #include <vector>
+#include "../util/Arena.h"
 #include "ColumnType.h"
 
 namespace hsql {
@@ -88,7 +89,7 @@ typedef struct Expr Expr;
 // Represents SQL expressions (i.e. literals, operators, column_refs).
 // TODO: When destructing a placeholder expression, we might need to alter the
 // placeholder_list.
-struct Expr {
+struct Expr : ArenaAllocated {
   Expr(ExprType type);
   virtual ~Expr();
 
@@ -132,6 +133,13 @@ struct Expr {
 
   static Expr* makeOpBinary(Expr* expr1, OperatorType op, Expr* expr2);
 
+  // Combines the operands into a flat AND or OR node, whose operands are in exprList (expr and
+  // expr2 are nullptr). Operands that are flat nodes of the same operator are merged into it.
+  static Expr* makeOpNary(Expr* expr1, OperatorType op, Expr* expr2);
+
+  // Returns true if this is a flat node created by makeOpNary() with the given operator.
+  bool isNaryOperator(OperatorType op) const;
+
   static Expr* makeBetween(Expr* expr, Expr* left, Expr* right);
 
   static Expr* makeCaseList(Expr* caseListElement);
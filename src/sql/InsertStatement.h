@@ -7,6 +7,109 @@
 namespace hsql {
 enum InsertType { kInsertValues, kInsertSelect };
 
+// Literal of a multi-row VALUES list before it is stored in its column.
+// Strings, dates, intervals and parameters are owned by the cell until it is appended.
+struct ValuesCell {
+  // kExprLiteralInt, kExprLiteralFloat, kExprLiteralString, kExprLiteralNull,
+  // kExprLiteralDate, kExprLiteralInterval or kExprParameter.
+  ExprType type;
+  bool isBool;
+  union {
+    int64_t ival;
+    double fval;
+    char* sval;
+    Expr* expr;
+  };
+};
+
+// Values of one column of a multi-row VALUES list, stored in the array of the column type.
+// Rows with NULL values are marked in the null bitmap and hold a default value in that array.
+// The parser does not know the types of the table, so values of different types are neither
+// converted nor rejected: such columns keep each value as a literal expression instead.
+struct ValuesColumn {
+  ValuesColumn();
+
+  // Appends the value and takes ownership of its string or expression. If its type differs from
+  // that of the previous values, the column switches to storing expressions (hasMixedTypes).
+  void append(const ValuesCell& value);
+
+  bool isNull(size_t row) const;
+  int64_t intValue(size_t row) const;
+  double floatValue(size_t row) const;
+  const char* stringValue(size_t row) const;
+  Expr* exprValue(size_t row) const;
+
+  // True if the values are read with exprValue(): intervals, parameters and mixed types.
+  bool hasExpressions() const;
+
+  // Type of the non-NULL values, kExprLiteralNull if all values are NULL. The type of the first
+  // non-NULL value if the column has mixed types.
+  ExprType type;
+
+  // True if all non-NULL values of a kExprLiteralInt column are TRUE or FALSE. TRUE and 1 count
+  // as different types.
+  bool isBool;
+
+  // True if the non-NULL values have different types, e.g. integers and floats. Each value is
+  // then a literal, interval or parameter expression in exprs, nullptr for NULL.
+  bool hasMixedTypes;
+
+  size_t size;
+
+  // kExprLiteralInt
+  std::vector<int64_t> ints;
+
+  // kExprLiteralFloat
+  std::vector<double> floats;
+
+  // kExprLiteralString and kExprLiteralDate: the null-terminated value of row i starts at chars[offsets[i]].
+  std::vector<size_t> offsets;
+  std::vector<char> chars;
+
+  // kExprLiteralInterval, kExprParameter and mixed types. The expressions are deleted by the
+  // owner of the list.
+  std::vector<Expr*> exprs;
+
+  // Bit i % 64 of word i / 64 is set if row i is NULL.
+  std::vector<uint64_t> nulls;
+
+ private:
+  void appendDefault();
+
+  // Moves the values into expressions when the column gets a value of another type.
+  void storeAsExpressions();
+};
+
+// Rows of a multi-row VALUES list, stored by column instead of as one expression per value.
+// Example: "INSERT INTO students VALUES ('Max', 1112233), ('Erika', 1112234)"
+struct ValuesList {
+  ValuesList();
+
+  // Appends a value to the current row, see ValuesColumn::append. Returns false (and frees
+  // the value) if the row already has as many values as the first row.
+  bool append(const ValuesCell& value);
+
+  // Appends the literal expressions (see the literal rule of the grammar) to the current row
+  // and deletes them, except for intervals and parameters, which are moved into the columns.
+  bool appendLiterals(std::vector<Expr*>* literals);
+
+  // Completes the current row. Returns false if it has fewer values than the first row.
+  bool endRow();
+
+  // True if the current row has as many values as the first row.
+  bool isRowComplete() const;
+
+  // Deletes the interval and parameter expressions of the columns. They are released with the
+  // arena in arena mode, where this must not be called.
+  void deleteExpressions();
+
+  std::vector<ValuesColumn> columns;
+  size_t numRows;
+
+ private:
+  size_t nextColumn_;
+};
+
 // Represents SQL Insert statements.
 // Example: "INSERT INTO students VALUES ('Max', 1112233, 'Musterhausen', 2.3)"
 struct InsertStatement : SQLStatement {
@@ -17,7 +120,13 @@ struct InsertStatement : SQLStatement {
   char* schema;
   char* tableName;
   std::vector<char*>* columns;
+
+  // Values of a single-row VALUES list, nullptr if the list has multiple rows.
   std::vector<Expr*>* values;
+
+  // Values of a VALUES list with multiple rows, nullptr if it has a single row.
+  ValuesList* rows;
+
   SelectStatement* select;
 };
 
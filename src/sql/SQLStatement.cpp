@@ -4,7 +4,7 @@
 namespace hsql {
 
 // SQLStatement
-SQLStatement::SQLStatement(StatementType type) : hints(nullptr), type_(type){};
+SQLStatement::SQLStatement(StatementType type) : stringLength(0), hints(nullptr), type_(type){};
 
 SQLStatement::~SQLStatement() {
   if (hints != nullptr) {
@@ -25,7 +25,7 @@ enum StatementType {
 };
 
 // Base struct for every SQL statement
-struct SQLStatement {
+struct SQLStatement : ArenaAllocated {
   SQLStatement(StatementType type);
 
   virtual ~SQLStatement();
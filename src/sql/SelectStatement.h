@@ -11,7 +11,7 @@ enum OrderType { kOrderAsc, kOrderDesc };
 enum SetType { kSetUnion, kSetIntersect, kSetExcept };
 
 // Description of the order by clause within a select statement.
-struct OrderDescription {
+struct OrderDescription : ArenaAllocated {
   OrderDescription(OrderType type, Expr* expr);
   virtual ~OrderDescription();
 
@@ -20,7 +20,7 @@ struct OrderDescription {
 };
 
 // Description of the limit clause within a select statement.
-struct LimitDescription {
+struct LimitDescription : ArenaAllocated {
   LimitDescription(Expr* limit, Expr* offset);
   virtual ~LimitDescription();
 
@@ -29,7 +29,7 @@ struct LimitDescription {
 };
 
 // Description of the group-by clause within a select statement.
-struct GroupByDescription {
+struct GroupByDescription : ArenaAllocated {
   GroupByDescription();
   virtual ~GroupByDescription();
 
@@ -37,14 +37,14 @@ struct GroupByDescription {
   Expr* having;
 };
 
-struct WithDescription {
+struct WithDescription : ArenaAllocated {
   ~WithDescription();
 
   char* alias;
   SelectStatement* select;
 };
 
-struct SetOperation {
+struct SetOperation : ArenaAllocated {
   SetOperation();
   virtual ~SetOperation();
 
@@ -19,7 +19,7 @@ struct TableName {
   char* name;
 };
 
-struct Alias {
+struct Alias : ArenaAllocated {
   Alias(char* name, std::vector<char*>* columns = nullptr);
   ~Alias();
 
@@ -28,7 +28,7 @@ struct Alias {
 };
 
 // Holds reference to tables. Can be either table names or a select statement.
-struct TableRef {
+struct TableRef : ArenaAllocated {
   TableRef(TableRefType type);
   virtual ~TableRef();
 
@@ -53,7 +53,7 @@ struct TableRef {
 enum JoinType { kJoinInner, kJoinFull, kJoinLeft, kJoinRight, kJoinCross, kJoinNatural };
 
 // Definition of a join construct.
-struct JoinDefinition {
+struct JoinDefinition : ArenaAllocated {
   JoinDefinition();
   virtual ~JoinDefinition();
 
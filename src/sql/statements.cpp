@@ -1,4 +1,5 @@
 #include "statements.h"
+#include <string.h>
 #include "AlterStatement.h"
 
 namespace hsql {
@@ -219,6 +220,7 @@ InsertStatement::InsertStatement(InsertType type)
       tableName(nullptr),
       columns(nullptr),
       values(nullptr),
+      rows(nullptr),
       select(nullptr) {}
 
 InsertStatement::~InsertStatement() {
@@ -239,6 +241,222 @@ InsertStatement::~InsertStatement() {
     }
     delete values;
   }
+
+  if (rows != nullptr) {
+    rows->deleteExpressions();
+    delete rows;
+  }
+}
+
+// ValuesColumn
+namespace {
+
+void freeValue(const ValuesCell& value) {
+  if (value.type == kExprLiteralString || value.type == kExprLiteralDate) {
+    arenaFree(value.sval);
+  } else if (value.type == kExprLiteralInterval || value.type == kExprParameter) {
+    arenaDelete(value.expr);
+  }
+}
+
+// Takes ownership of the string or expression of the value.
+Expr* makeExpr(const ValuesCell& value) {
+  switch (value.type) {
+    case kExprLiteralInt:
+      return value.isBool ? Expr::makeLiteral(value.ival != 0) : Expr::makeLiteral(value.ival);
+    case kExprLiteralFloat:
+      return Expr::makeLiteral(value.fval);
+    case kExprLiteralString:
+      return Expr::makeLiteral(value.sval);
+    case kExprLiteralDate:
+      return Expr::makeDateLiteral(value.sval);
+    default:
+      return value.expr;
+  }
+}
+
+}  // namespace
+
+ValuesColumn::ValuesColumn() : type(kExprLiteralNull), isBool(false), hasMixedTypes(false), size(0) {}
+
+void ValuesColumn::append(const ValuesCell& value) {
+  if (value.type != kExprLiteralNull && !hasMixedTypes) {
+    if (type == kExprLiteralNull) {
+      // The first non-NULL value determines the type of the column.
+      type = value.type;
+      isBool = value.isBool;
+      for (size_t row = 0; row < size; ++row) {
+        appendDefault();
+      }
+    } else if (value.type != type || value.isBool != isBool) {
+      storeAsExpressions();
+    }
+  }
+
+  if (size % 64 == 0) nulls.push_back(0);
+
+  if (value.type == kExprLiteralNull) {
+    nulls[size / 64] |= uint64_t{1} << (size % 64);
+    appendDefault();
+  } else if (hasMixedTypes) {
+    exprs.push_back(makeExpr(value));
+  } else {
+    switch (value.type) {
+      case kExprLiteralInt:
+        ints.push_back(value.ival);
+        break;
+      case kExprLiteralFloat:
+        floats.push_back(value.fval);
+        break;
+      case kExprLiteralString:
+      case kExprLiteralDate:
+        offsets.push_back(chars.size());
+        chars.insert(chars.end(), value.sval, value.sval + strlen(value.sval) + 1);
+        arenaFree(value.sval);
+        break;
+      default:
+        exprs.push_back(value.expr);
+        break;
+    }
+  }
+  ++size;
+}
+
+void ValuesColumn::storeAsExpressions() {
+  std::vector<Expr*> values(size, nullptr);
+  for (size_t row = 0; row < size; ++row) {
+    if (isNull(row)) continue;
+    ValuesCell value;
+    value.type = type;
+    value.isBool = isBool;
+    switch (type) {
+      case kExprLiteralInt:
+        value.ival = ints[row];
+        break;
+      case kExprLiteralFloat:
+        value.fval = floats[row];
+        break;
+      case kExprLiteralString:
+      case kExprLiteralDate:
+        value.sval = arenaStrdup(stringValue(row));
+        break;
+      default:
+        value.expr = exprs[row];
+        break;
+    }
+    values[row] = makeExpr(value);
+  }
+
+  exprs.swap(values);
+  std::vector<int64_t>().swap(ints);
+  std::vector<double>().swap(floats);
+  std::vector<size_t>().swap(offsets);
+  std::vector<char>().swap(chars);
+  isBool = false;
+  hasMixedTypes = true;
+}
+
+void ValuesColumn::appendDefault() {
+  if (hasMixedTypes) {
+    exprs.push_back(nullptr);
+    return;
+  }
+  switch (type) {
+    case kExprLiteralNull:
+      // Added once the type of the column is known.
+      break;
+    case kExprLiteralInt:
+      ints.push_back(0);
+      break;
+    case kExprLiteralFloat:
+      floats.push_back(0);
+      break;
+    case kExprLiteralString:
+    case kExprLiteralDate:
+      offsets.push_back(chars.size());
+      chars.push_back('\0');
+      break;
+    default:
+      exprs.push_back(nullptr);
+      break;
+  }
+}
+
+bool ValuesColumn::isNull(size_t row) const { return (nulls[row / 64] >> (row % 64)) & 1; }
+
+int64_t ValuesColumn::intValue(size_t row) const { return ints[row]; }
+
+double ValuesColumn::floatValue(size_t row) const { return floats[row]; }
+
+const char* ValuesColumn::stringValue(size_t row) const { return chars.data() + offsets[row]; }
+
+Expr* ValuesColumn::exprValue(size_t row) const { return exprs[row]; }
+
+bool ValuesColumn::hasExpressions() const {
+  return hasMixedTypes || type == kExprLiteralInterval || type == kExprParameter;
+}
+
+// ValuesList
+ValuesList::ValuesList() : numRows(0), nextColumn_(0) {}
+
+bool ValuesList::append(const ValuesCell& value) {
+  if (isRowComplete()) {
+    freeValue(value);
+    return false;
+  }
+  if (numRows == 0) columns.emplace_back();
+  columns[nextColumn_++].append(value);
+  return true;
+}
+
+bool ValuesList::appendLiterals(std::vector<Expr*>* literals) {
+  bool success = true;
+  for (Expr* literal : *literals) {
+    ValuesCell value;
+    value.type = literal->type;
+    value.isBool = literal->isBoolLiteral;
+    switch (literal->type) {
+      case kExprLiteralInt:
+        value.ival = literal->ival;
+        break;
+      case kExprLiteralFloat:
+        value.fval = literal->fval;
+        break;
+      case kExprLiteralString:
+      case kExprLiteralDate:
+        value.sval = literal->name;
+        literal->name = nullptr;
+        break;
+      case kExprLiteralInterval:
+      case kExprParameter:
+        value.expr = literal;
+        break;
+      default:
+        break;
+    }
+    if (value.type != kExprLiteralInterval && value.type != kExprParameter) arenaDelete(literal);
+    success = append(value) && success;
+  }
+  arenaDelete(literals);
+  return success;
+}
+
+bool ValuesList::endRow() {
+  if (numRows > 0 && nextColumn_ < columns.size()) return false;
+  ++numRows;
+  nextColumn_ = 0;
+  return true;
+}
+
+bool ValuesList::isRowComplete() const { return numRows > 0 && nextColumn_ == columns.size(); }
+
+void ValuesList::deleteExpressions() {
+  for (ValuesColumn& column : columns) {
+    for (Expr* expr : column.exprs) {
+      delete expr;
+    }
+    column.exprs.clear();
+  }
 }
 
 // ShowStatament
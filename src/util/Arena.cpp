@@ -0,0 +1,184 @@
+#include "Arena.h"
+#include <string.h>
+#include <algorithm>
+
+namespace hsql {
+
+namespace {
+thread_local Arena* currentArena = nullptr;
+}
+
+struct alignas(std::max_align_t) Arena::Block {
+  Block* next;
+  size_t size;
+
+  char* data() { return reinterpret_cast<char*>(this + 1); }
+};
+
+struct Arena::Cleanup {
+  void (*cleanup)(void*);
+  void* object;
+  Cleanup* next;
+};
+
+Arena::Arena(size_t initialBlockSize)
+    : head_(nullptr),
+      cursor_(nullptr),
+      end_(nullptr),
+      cleanups_(nullptr),
+      nextBlockSize_(std::max(initialBlockSize, sizeof(Block))),
+      bytesReserved_(0),
+      bytesUsed_(0) {}
+
+Arena::~Arena() {
+  reset();
+  ::operator delete(head_);
+}
+
+void* Arena::allocateSlow(size_t size, size_t alignment) {
+  const size_t needed = size + alignment;
+
+  // Large allocations get a dedicated block that is linked behind the current one,
+  // so the remainder of the current block is still used for small allocations.
+  const bool dedicated = needed > nextBlockSize_ / 2;
+  const size_t blockSize = dedicated ? needed : nextBlockSize_;
+
+  Block* block = static_cast<Block*>(::operator new(sizeof(Block) + blockSize));
+  block->size = blockSize;
+  bytesReserved_ += blockSize;
+
+  if (dedicated && head_ != nullptr) {
+    block->next = head_->next;
+    head_->next = block;
+    const uintptr_t aligned = (reinterpret_cast<uintptr_t>(block->data()) + alignment - 1) & ~(alignment - 1);
+    bytesUsed_ += size;
+    return reinterpret_cast<void*>(aligned);
+  }
+
+  if (!dedicated) nextBlockSize_ = std::min(nextBlockSize_ * 2, kMaxBlockSize);
+  block->next = head_;
+  head_ = block;
+  cursor_ = block->data();
+  end_ = cursor_ + blockSize;
+  return allocate(size, alignment);
+}
+
+char* Arena::copyString(const char* source, size_t length) {
+  char* copy = static_cast<char*>(allocate(length + 1, 1));
+  memcpy(copy, source, length);
+  copy[length] = '\0';
+  return copy;
+}
+
+void Arena::addCleanup(void (*cleanup)(void*), void* object) {
+  Cleanup* entry = static_cast<Cleanup*>(allocate(sizeof(Cleanup), alignof(Cleanup)));
+  entry->cleanup = cleanup;
+  entry->object = object;
+  entry->next = cleanups_;
+  cleanups_ = entry;
+}
+
+void Arena::splice(Arena* other) {
+  if (other == this || other->head_ == nullptr) return;
+
+  // The blocks of other are linked behind the current block, which keeps serving allocations.
+  Block* last = other->head_;
+  while (last->next != nullptr) last = last->next;
+  if (head_ == nullptr) {
+    head_ = other->head_;
+    cursor_ = other->cursor_;
+    end_ = other->end_;
+  } else {
+    last->next = head_->next;
+    head_->next = other->head_;
+  }
+
+  if (other->cleanups_ != nullptr) {
+    Cleanup* lastCleanup = other->cleanups_;
+    while (lastCleanup->next != nullptr) lastCleanup = lastCleanup->next;
+    lastCleanup->next = cleanups_;
+    cleanups_ = other->cleanups_;
+  }
+
+  bytesReserved_ += other->bytesReserved_;
+  bytesUsed_ += other->bytesUsed_;
+
+  other->head_ = nullptr;
+  other->cursor_ = nullptr;
+  other->end_ = nullptr;
+  other->cleanups_ = nullptr;
+  other->bytesReserved_ = 0;
+  other->bytesUsed_ = 0;
+}
+
+bool Arena::owns(const void* ptr) const {
+  const char* p = static_cast<const char*>(ptr);
+  for (Block* block = head_; block != nullptr; block = block->next) {
+    if (p >= block->data() && p < block->data() + block->size) return true;
+  }
+  return false;
+}
+
+void Arena::reset() {
+  for (Cleanup* entry = cleanups_; entry != nullptr; entry = entry->next) {
+    entry->cleanup(entry->object);
+  }
+  cleanups_ = nullptr;
+
+  if (head_ == nullptr) return;
+
+  Block* block = head_->next;
+  while (block != nullptr) {
+    Block* next = block->next;
+    ::operator delete(block);
+    block = next;
+  }
+
+  head_->next = nullptr;
+  cursor_ = head_->data();
+  end_ = cursor_ + head_->size;
+  bytesReserved_ = head_->size;
+  bytesUsed_ = 0;
+}
+
+size_t Arena::bytesReserved() const { return bytesReserved_; }
+
+size_t Arena::bytesUsed() const { return bytesUsed_; }
+
+Arena* Arena::current() { return currentArena; }
+
+// ArenaScope
+ArenaScope::ArenaScope(Arena* arena) : previous_(currentArena) { currentArena = arena; }
+
+ArenaScope::~ArenaScope() { currentArena = previous_; }
+
+// ArenaAllocated
+void* ArenaAllocated::operator new(size_t size) {
+  if (currentArena != nullptr) return currentArena->allocate(size);
+  return ::operator new(size);
+}
+
+void ArenaAllocated::operator delete(void* ptr) {
+  if (currentArena != nullptr && currentArena->owns(ptr)) return;
+  ::operator delete(ptr);
+}
+
+char* arenaStringBuffer(size_t length) {
+  if (currentArena != nullptr) return static_cast<char*>(currentArena->allocate(length + 1, 1));
+  return static_cast<char*>(malloc(length + 1));
+}
+
+char* arenaStrndup(const char* source, size_t length) {
+  char* copy = arenaStringBuffer(length);
+  memcpy(copy, source, length);
+  copy[length] = '\0';
+  return copy;
+}
+
+char* arenaStrdup(const char* source) { return arenaStrndup(source, strlen(source)); }
+
+void arenaFree(void* ptr) {
+  if (currentArena == nullptr) free(ptr);
+}
+
+}  // namespace hsql
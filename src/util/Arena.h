@@ -0,0 +1,146 @@
+#ifndef SQLPARSER_ARENA_H
+#define SQLPARSER_ARENA_H
+
+#include <stdlib.h>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace hsql {
+
+// Bump allocator that backs the AST of a SQLParserResult in arena mode.
+// Memory is handed out from a chain of blocks and is only released as a whole,
+// either by reset() or when the arena is destroyed.
+class Arena {
+ public:
+  static constexpr size_t kDefaultBlockSize = 4096;
+  static constexpr size_t kMaxBlockSize = 1 << 20;
+
+  explicit Arena(size_t initialBlockSize = kDefaultBlockSize);
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+
+  // Runs all registered destructors and frees all blocks.
+  ~Arena();
+
+  // Returns size bytes with the given alignment (a power of two). Never returns nullptr.
+  void* allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+    const uintptr_t aligned = (reinterpret_cast<uintptr_t>(cursor_) + alignment - 1) & ~(alignment - 1);
+    if (cursor_ != nullptr && aligned + size <= reinterpret_cast<uintptr_t>(end_)) {
+      bytesUsed_ += aligned + size - reinterpret_cast<uintptr_t>(cursor_);
+      cursor_ = reinterpret_cast<char*>(aligned + size);
+      return reinterpret_cast<void*>(aligned);
+    }
+    return allocateSlow(size, alignment);
+  }
+
+  // Copies length characters of source into the arena and null-terminates the copy.
+  char* copyString(const char* source, size_t length);
+
+  // Constructs a T in the arena. If T is not trivially destructible, its destructor
+  // is registered and run by reset(). Used for std::vector, whose buffer lives on the heap.
+  template <typename T, typename... Args>
+  T* create(Args&&... args) {
+    T* object = ::new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    if (!std::is_trivially_destructible<T>::value) {
+      addCleanup([](void* ptr) { static_cast<T*>(ptr)->~T(); }, object);
+    }
+    return object;
+  }
+
+  // Registers a function that is called with object when the arena is reset.
+  void addCleanup(void (*cleanup)(void*), void* object);
+
+  // Takes over the blocks and registered destructors of other, which is left empty.
+  // Objects allocated from other stay valid and are released with this arena.
+  void splice(Arena* other);
+
+  // Returns true if ptr points into memory handed out by this arena.
+  bool owns(const void* ptr) const;
+
+  // Runs all registered destructors and releases all memory.
+  // The most recently used block is kept to serve subsequent allocations.
+  void reset();
+
+  // Number of bytes currently reserved from the system allocator.
+  size_t bytesReserved() const;
+
+  // Number of bytes handed out since the last reset.
+  size_t bytesUsed() const;
+
+  // Returns the arena that AST allocations of the calling thread are routed to, or nullptr.
+  static Arena* current();
+
+ private:
+  struct Block;
+  struct Cleanup;
+
+  void* allocateSlow(size_t size, size_t alignment);
+
+  // Chain of blocks, most recent first. head_ is the block allocations are bumped from.
+  Block* head_;
+  char* cursor_;
+  char* end_;
+
+  // Registered destructors, most recent first. Stored inside the arena itself.
+  Cleanup* cleanups_;
+
+  size_t nextBlockSize_;
+  size_t bytesReserved_;
+  size_t bytesUsed_;
+};
+
+// Routes AST allocations of the calling thread to the given arena for the lifetime of the scope.
+// Scopes nest; passing nullptr temporarily disables arena allocation.
+class ArenaScope {
+ public:
+  explicit ArenaScope(Arena* arena);
+  ~ArenaScope();
+
+  ArenaScope(const ArenaScope&) = delete;
+  ArenaScope& operator=(const ArenaScope&) = delete;
+
+ private:
+  Arena* previous_;
+};
+
+// Base of all AST structs. While an arena is active on the calling thread,
+// `new` allocates from it. Arena-allocated nodes are never destructed individually;
+// their memory is reclaimed when the owning arena is reset.
+struct ArenaAllocated {
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr);
+};
+
+// Allocation helpers used by the lexer and the parser. They allocate from the active arena
+// if there is one and from the heap (new / malloc) otherwise.
+
+template <typename T, typename... Args>
+T* arenaNew(Args&&... args) {
+  Arena* arena = Arena::current();
+  if (arena != nullptr) return arena->create<T>(std::forward<Args>(args)...);
+  return new T(std::forward<Args>(args)...);
+}
+
+// Deletes an object created by arenaNew() or an AST node. No-op while an arena is active.
+template <typename T>
+void arenaDelete(T* object) {
+  if (Arena::current() == nullptr) delete object;
+}
+
+// Returns uninitialized space for a string of length characters and its terminator.
+// Free with arenaFree().
+char* arenaStringBuffer(size_t length);
+
+char* arenaStrndup(const char* source, size_t length);
+
+char* arenaStrdup(const char* source);
+
+// Frees a string created by arenaStrdup(). No-op while an arena is active.
+void arenaFree(void* ptr);
+
+}  // namespace hsql
+
+#endif
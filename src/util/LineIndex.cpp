@@ -0,0 +1,23 @@
+#include "LineIndex.h"
+#include <string.h>
+#include <algorithm>
+
+namespace hsql {
+
+LineIndex::LineIndex(const char* text, size_t length) : lineStarts_{0} {
+  const char* end = text + length;
+  for (const char* newline = text; (newline = static_cast<const char*>(memchr(newline, '\n', end - newline)));) {
+    ++newline;
+    lineStarts_.push_back(newline - text);
+  }
+}
+
+int LineIndex::line(size_t offset) const {
+  return std::upper_bound(lineStarts_.begin(), lineStarts_.end(), offset) - lineStarts_.begin() - 1;
+}
+
+int LineIndex::column(size_t offset) const { return offset - lineStarts_[line(offset)]; }
+
+size_t LineIndex::numLines() const { return lineStarts_.size(); }
+
+}  // namespace hsql
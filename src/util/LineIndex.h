@@ -0,0 +1,33 @@
+#ifndef SQLPARSER_LINE_INDEX_H
+#define SQLPARSER_LINE_INDEX_H
+
+#include <stddef.h>
+#include <vector>
+
+namespace hsql {
+
+// Maps byte offsets in a query string to zero-based line and column numbers.
+// The parser tracks locations as offsets only; the start of each line is
+// collected once on construction, when a line or column is actually needed.
+class LineIndex {
+ public:
+  // Indexes the first length characters of text.
+  LineIndex(const char* text, size_t length);
+
+  // Returns the line of the character at offset.
+  int line(size_t offset) const;
+
+  // Returns the column of the character at offset within its line.
+  int column(size_t offset) const;
+
+  // Returns the number of lines in the indexed text.
+  size_t numLines() const;
+
+ private:
+  // Offsets of the first character of each line.
+  std::vector<size_t> lineStarts_;
+};
+
+}  // namespace hsql
+
+#endif
@@ -0,0 +1,147 @@
+#include "StatementSplitter.h"
+#include <string.h>
+
+namespace hsql {
+
+namespace {
+
+// Characters that end or change the state of a statement once it has content, or at which the
+// lexer may stop: all characters but whitespace, letters, digits and single character tokens
+// (see flex_lexer.l).
+struct SpecialCharacters {
+  bool table[256];
+
+  SpecialCharacters() {
+    for (bool& special : table) special = true;
+    for (const char* c = " \t\n+*/(){},.<>=^%:?[]|"; *c; ++c) table[static_cast<unsigned char>(*c)] = false;
+    for (int c = 0; c < 26; ++c) {
+      table['A' + c] = false;
+      table['a' + c] = false;
+    }
+    for (int c = '0'; c <= '9'; ++c) table[c] = false;
+  }
+};
+
+const SpecialCharacters kSpecialCharacters;
+
+bool isLetter(char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+
+bool isIdentifierChar(char c) { return isLetter(c) || (c >= '0' && c <= '9') || c == '_'; }
+
+}  // namespace
+
+StatementSplitter::StatementSplitter() : state_(kCode), hasContent_(false), mayStopLexer_(false), begin_(0) {}
+
+bool StatementSplitter::scan(const char* data, size_t* position, size_t size) {
+  size_t i = *position;
+  while (i < size) {
+    const char c = data[i];
+    switch (state_) {
+      case kCode:
+        if (hasContent_ && !kSpecialCharacters.table[static_cast<unsigned char>(c)]) {
+          // Skip ahead to the next character that matters.
+          while (++i < size && !kSpecialCharacters.table[static_cast<unsigned char>(data[i])]) {
+          }
+          continue;
+        }
+        if (c == ';') {
+          *position = i + 1;
+          return true;
+        }
+        if (c == '-') {
+          // Either a minus or the start of a comment, decided by the next character.
+          state_ = kDash;
+          if (!hasContent_) begin_ = i;
+        } else if (c != ' ' && c != '\t' && c != '\n') {
+          if (!hasContent_) {
+            hasContent_ = true;
+            begin_ = i;
+          }
+          if (c == '\'') {
+            state_ = kString;
+          } else if (c == '"') {
+            state_ = kIdentifierStart;
+          } else if (c == '!') {
+            // Only accepted as part of !=.
+            state_ = kBang;
+          } else if (c == '_') {
+            // Underscores only continue identifiers, which start with a letter. Digits in front
+            // of the first letter are a number.
+            size_t j = i;
+            while (j > begin_ && isIdentifierChar(data[j - 1]) && !isLetter(data[j - 1])) --j;
+            if (j == begin_ || !isLetter(data[j - 1])) mayStopLexer_ = true;
+          } else if (kSpecialCharacters.table[static_cast<unsigned char>(c)]) {
+            mayStopLexer_ = true;
+          }
+        }
+        break;
+      case kDash:
+        if (c == '-') {
+          state_ = kComment;
+          break;
+        }
+        // begin_ already points to the minus if it starts the statement.
+        hasContent_ = true;
+        // Scan the character again as code.
+        state_ = kCode;
+        continue;
+      case kString: {
+        // Escaped quotes ('') end the literal and start a new one, which does not change the result.
+        const char* quote = static_cast<const char*>(memchr(data + i, '\'', size - i));
+        if (quote == nullptr) {
+          i = size;
+          continue;
+        }
+        i = quote - data;
+        state_ = kCode;
+        break;
+      }
+      case kBang:
+        if (c != '=') mayStopLexer_ = true;
+        state_ = kCode;
+        continue;
+      case kIdentifierStart:
+      case kIdentifier:
+        // Quoted identifiers are not empty and cannot span lines (see flex_lexer.l).
+        if (c == '"' || c == '\n') {
+          if (state_ == kIdentifierStart || c == '\n') mayStopLexer_ = true;
+          state_ = kCode;
+        } else {
+          state_ = kIdentifier;
+        }
+        break;
+      case kComment:
+        if (c == '\n') state_ = kCode;
+        break;
+    }
+    ++i;
+  }
+  *position = size;
+  return false;
+}
+
+bool StatementSplitter::finish() {
+  if (state_ == kDash) hasContent_ = true;
+  if (state_ == kString || state_ == kIdentifierStart || state_ == kIdentifier || state_ == kBang) {
+    mayStopLexer_ = true;
+  }
+  return hasContent_;
+}
+
+bool StatementSplitter::hasContent() const { return hasContent_; }
+
+bool StatementSplitter::mayStopLexer() const { return mayStopLexer_; }
+
+bool StatementSplitter::hasStarted() const { return hasContent_ || state_ == kDash; }
+
+size_t StatementSplitter::begin() const { return begin_; }
+
+void StatementSplitter::reset() {
+  state_ = kCode;
+  hasContent_ = false;
+  mayStopLexer_ = false;
+}
+
+void StatementSplitter::shift(size_t count) { begin_ -= count; }
+
+}  // namespace hsql
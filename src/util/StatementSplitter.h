@@ -0,0 +1,56 @@
+#ifndef SQLPARSER_STATEMENT_SPLITTER_H
+#define SQLPARSER_STATEMENT_SPLITTER_H
+
+#include <stddef.h>
+
+namespace hsql {
+
+// Finds the statements of a SQL script without tokenizing it: statements end at semicolons
+// outside of string literals, quoted identifiers and comments, as recognized by the lexer.
+// The state is kept between calls, so a script can be scanned in chunks.
+class StatementSplitter {
+ public:
+  StatementSplitter();
+
+  // Scans data[*position, size) and advances *position. Returns true if a semicolon ends the
+  // current statement; *position is then behind the semicolon. The statement may be empty,
+  // i.e. consist of whitespace and comments only (see hasContent()).
+  bool scan(const char* data, size_t* position, size_t size);
+
+  // Ends the script after the scanned data. Returns true if its last statement, which is not
+  // terminated by a semicolon, has content.
+  bool finish();
+
+  // Returns true if the current statement contains anything but whitespace and comments.
+  bool hasContent() const;
+
+  // Returns true if the lexer may stop reading the script in the current statement, as it does
+  // at characters that it does not accept and at unterminated strings and quoted identifiers.
+  // A sequential parse treats this like the end of the script and ignores the statements behind.
+  bool mayStopLexer() const;
+
+  // Returns true if the current statement has content or a minus that may start it.
+  bool hasStarted() const;
+
+  // Position of the first character of the current statement that is not whitespace or part of
+  // a comment. Only valid if hasStarted().
+  size_t begin() const;
+
+  // Starts the next statement after scan() returned true.
+  void reset();
+
+  // Adjusts the positions after the first count characters of the scanned data were removed.
+  void shift(size_t count);
+
+ private:
+  enum State { kCode, kDash, kBang, kString, kIdentifierStart, kIdentifier, kComment };
+
+  State state_;
+  bool hasContent_;
+  bool mayStopLexer_;
+  size_t begin_;
+};
+
+}  // namespace hsql
+
+#endif
@@ -3,10 +3,10 @@
 #include <iostream>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace hsql {
 
-void printOperatorExpression(Expr* expr, uintmax_t numIndent);
 void printAlias(Alias* alias, uintmax_t numIndent);
 
 std::ostream& operator<<(std::ostream& os, const OperatorType& op);
@@ -68,93 +68,124 @@ void printAlias(Alias* alias, uintmax_t numIndent) {
   }
 }
 
-void printOperatorExpression(Expr* expr, uintmax_t numIndent) {
-  if (expr == nullptr) {
-    inprint("null", numIndent);
-    return;
-  }
+namespace {
 
-  inprint(expr->opType, numIndent);
+// Pending output of printExpression(): an expression, or a part of it that is printed after its operands.
+struct PrintTask {
+  enum Kind { kExpression, kArrayIndex, kAlias };
 
-  printExpression(expr->expr, numIndent + 1);
-  if (expr->expr2 != nullptr) {
-    printExpression(expr->expr2, numIndent + 1);
-  } else if (expr->exprList != nullptr) {
-    for (Expr* e : *expr->exprList) printExpression(e, numIndent + 1);
+  Kind kind;
+  Expr* expr;
+  uintmax_t numIndent;
+};
+
+// Schedules the operands, which are printed in order before the tasks already on the stack.
+void pushOperands(std::vector<PrintTask>* tasks, const std::vector<Expr*>& operands, uintmax_t numIndent) {
+  for (auto operand = operands.rbegin(); operand != operands.rend(); ++operand) {
+    tasks->push_back({PrintTask::kExpression, *operand, numIndent});
   }
 }
 
+}  // namespace
+
 void printExpression(Expr* expr, uintmax_t numIndent) {
-  if (!expr) return;
-  switch (expr->type) {
-    case kExprStar:
-      inprint("*", numIndent);
-      break;
-    case kExprColumnRef:
-      inprint(expr->name, numIndent);
-      if (expr->table) {
-        inprint("Table:", numIndent + 1);
-        inprint(expr->table, numIndent + 2);
-      }
-      break;
-    // case kExprTableColumnRef: inprint(expr->table, expr->name, numIndent); break;
-    case kExprLiteralFloat:
-      inprint(expr->fval, numIndent);
-      break;
-    case kExprLiteralInt:
-      inprint(expr->ival, numIndent);
-      break;
-    case kExprLiteralString:
-      inprint(expr->name, numIndent);
-      break;
-    case kExprLiteralDate:
-      inprint(expr->name, numIndent);
-      break;
-    case kExprLiteralNull:
-      inprint("NULL", numIndent);
-      break;
-    case kExprLiteralInterval:
-      inprint("INTERVAL", numIndent);
-      inprint(expr->ival, numIndent + 1);
-      inprint(expr->datetimeField, numIndent + 1);
-      break;
-    case kExprFunctionRef:
-      inprint(expr->name, numIndent);
-      for (Expr* e : *expr->exprList) printExpression(e, numIndent + 1);
-      break;
-    case kExprExtract:
-      inprint("EXTRACT", numIndent);
-      inprint(expr->datetimeField, numIndent + 1);
-      printExpression(expr->expr, numIndent + 1);
-      break;
-    case kExprCast:
-      inprint("CAST", numIndent);
-      inprint(expr->columnType, numIndent + 1);
-      printExpression(expr->expr, numIndent + 1);
-      break;
-    case kExprOperator:
-      printOperatorExpression(expr, numIndent);
-      break;
-    case kExprSelect:
-      printSelectStatementInfo(expr->select, numIndent);
-      break;
-    case kExprParameter:
-      inprint(expr->ival, numIndent);
-      break;
-    case kExprArray:
-      for (Expr* e : *expr->exprList) printExpression(e, numIndent + 1);
-      break;
-    case kExprArrayIndex:
-      printExpression(expr->expr, numIndent + 1);
+  // Operands are printed from an explicit stack instead of recursively, so that deep trees (e.g. long
+  // chains of AND) do not overflow the call stack.
+  std::vector<PrintTask> tasks = {{PrintTask::kExpression, expr, numIndent}};
+  while (!tasks.empty()) {
+    const PrintTask task = tasks.back();
+    tasks.pop_back();
+    expr = task.expr;
+    numIndent = task.numIndent;
+
+    if (task.kind == PrintTask::kArrayIndex) {
       inprint(expr->ival, numIndent);
-      break;
-    default:
-      std::cerr << "Unrecognized expression type " << expr->type << std::endl;
-      return;
-  }
-  if (expr->alias != nullptr) {
-    inprint("Alias", numIndent + 1);
-    inprint(expr->alias, numIndent + 2);
+      continue;
+    }
+    if (task.kind == PrintTask::kAlias) {
+      inprint("Alias", numIndent + 1);
+      inprint(expr->alias, numIndent + 2);
+      continue;
+    }
+    if (!expr) continue;
+
+    // The alias is printed after the operands, which are pushed behind it.
+    const size_t numTasks = tasks.size();
+    if (expr->alias != nullptr) tasks.push_back({PrintTask::kAlias, expr, numIndent});
+
+    switch (expr->type) {
+      case kExprStar:
+        inprint("*", numIndent);
+        break;
+      case kExprColumnRef:
+        inprint(expr->name, numIndent);
+        if (expr->table) {
+          inprint("Table:", numIndent + 1);
+          inprint(expr->table, numIndent + 2);
+        }
+        break;
+      // case kExprTableColumnRef: inprint(expr->table, expr->name, numIndent); break;
+      case kExprLiteralFloat:
+        inprint(expr->fval, numIndent);
+        break;
+      case kExprLiteralInt:
+        inprint(expr->ival, numIndent);
+        break;
+      case kExprLiteralString:
+        inprint(expr->name, numIndent);
+        break;
+      case kExprLiteralDate:
+        inprint(expr->name, numIndent);
+        break;
+      case kExprLiteralNull:
+        inprint("NULL", numIndent);
+        break;
+      case kExprLiteralInterval:
+        inprint("INTERVAL", numIndent);
+        inprint(expr->ival, numIndent + 1);
+        inprint(expr->datetimeField, numIndent + 1);
+        break;
+      case kExprFunctionRef:
+        inprint(expr->name, numIndent);
+        pushOperands(&tasks, *expr->exprList, numIndent + 1);
+        break;
+      case kExprExtract:
+        inprint("EXTRACT", numIndent);
+        inprint(expr->datetimeField, numIndent + 1);
+        tasks.push_back({PrintTask::kExpression, expr->expr, numIndent + 1});
+        break;
+      case kExprCast:
+        inprint("CAST", numIndent);
+        inprint(expr->columnType, numIndent + 1);
+        tasks.push_back({PrintTask::kExpression, expr->expr, numIndent + 1});
+        break;
+      case kExprOperator:
+        inprint(expr->opType, numIndent);
+        if (expr->expr2 != nullptr) {
+          tasks.push_back({PrintTask::kExpression, expr->expr2, numIndent + 1});
+        } else if (expr->exprList != nullptr) {
+          pushOperands(&tasks, *expr->exprList, numIndent + 1);
+        }
+        tasks.push_back({PrintTask::kExpression, expr->expr, numIndent + 1});
+        break;
+      case kExprSelect:
+        printSelectStatementInfo(expr->select, numIndent);
+        break;
+      case kExprParameter:
+        inprint(expr->ival, numIndent);
+        break;
+      case kExprArray:
+        pushOperands(&tasks, *expr->exprList, numIndent + 1);
+        break;
+      case kExprArrayIndex:
+        tasks.push_back({PrintTask::kArrayIndex, expr, numIndent});
+        tasks.push_back({PrintTask::kExpression, expr->expr, numIndent + 1});
+        break;
+      default:
+        std::cerr << "Unrecognized expression type " << expr->type << std::endl;
+        tasks.resize(numTasks);
+        break;
+    }
   }
 }
 
@@ -291,6 +322,31 @@ void printCreateStatementInfo(const CreateStatement* stmt, uintmax_t numIndent)
   if (stmt->filePath) inprint(stmt->filePath, numIndent + 1);
 }
 
+void printValue(const ValuesColumn& column, size_t row, uintmax_t numIndent) {
+  if (column.isNull(row)) {
+    inprint("NULL", numIndent);
+    return;
+  }
+  if (column.hasExpressions()) {
+    printExpression(column.exprValue(row), numIndent);
+    return;
+  }
+  switch (column.type) {
+    case kExprLiteralInt:
+      inprint(column.intValue(row), numIndent);
+      break;
+    case kExprLiteralFloat:
+      inprint(column.floatValue(row), numIndent);
+      break;
+    case kExprLiteralString:
+    case kExprLiteralDate:
+      inprint(column.stringValue(row), numIndent);
+      break;
+    default:
+      break;
+  }
+}
+
 void printInsertStatementInfo(const InsertStatement* stmt, uintmax_t numIndent) {
   inprint("InsertStatement", numIndent);
   inprint(stmt->tableName, numIndent + 1);
@@ -303,8 +359,17 @@ void printInsertStatementInfo(const InsertStatement* stmt, uintmax_t numIndent)
   switch (stmt->type) {
     case kInsertValues:
       inprint("Values", numIndent + 1);
-      for (Expr* expr : *stmt->values) {
-        printExpression(expr, numIndent + 2);
+      if (stmt->values != nullptr) {
+        for (Expr* expr : *stmt->values) {
+          printExpression(expr, numIndent + 2);
+        }
+        break;
+      }
+      for (size_t row = 0; row < stmt->rows->numRows; ++row) {
+        inprint("Row", numIndent + 2);
+        for (const ValuesColumn& column : stmt->rows->columns) {
+          printValue(column, row, numIndent + 3);
+        }
       }
       break;
     case kInsertSelect:
@@ -34,6 +34,10 @@ TEST(AutoQueryFileTest) {
     lines.insert(lines.end(), tmp.begin(), tmp.end());
   }
 
+  // Queries are also parsed with the hand-written lexer.
+  hsql::ParserContext simd_context;
+  simd_context.setLexer(hsql::kLexerSimd);
+
   // Execute queries.
   size_t num_executed = 0;
   size_t num_failed = 0;
@@ -59,7 +63,19 @@ TEST(AutoQueryFileTest) {
     std::chrono::duration<double> elapsed_seconds = end - start;
     double us = elapsed_seconds.count() * 1000 * 1000;
 
-    if (expected_result == result.isValid()) {
+    // Parsing in arena mode has to yield the same outcome.
+    hsql::SQLParserResult arena_result;
+    arena_result.setUseArena(true);
+    hsql::SQLParser::parse(query, &arena_result);
+
+    // The hand-written lexer has to yield the same outcome and error location.
+    hsql::SQLParserResult simd_result;
+    simd_context.parse(query, &simd_result);
+
+    if (expected_result == result.isValid() && expected_result == arena_result.isValid() &&
+        result.size() == arena_result.size() && simd_result.isValid() == result.isValid() &&
+        simd_result.size() == result.size() && simd_result.errorLine() == result.errorLine() &&
+        simd_result.errorColumn() == result.errorColumn()) {
       printf("\033[0;32m{      ok} (%.1fus)\033[0m %s\n", us, line.c_str());
     } else {
       printf("\033[0;31m{  failed}\033[0m\n");
@@ -0,0 +1,136 @@
+#include "thirdparty/microtest/microtest.h"
+
+#include <string.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ParserContext.h"
+#include "SQLParser.h"
+#include "sql/CompactExpr.h"
+
+using namespace hsql;
+
+namespace {
+
+// Checks that the copy has the same fields and operands as the source, and returns the number of nodes.
+size_t assertSameTree(const Expr* expr, const CompactExpr* compact) {
+  size_t numNodes = 0;
+  std::vector<std::pair<const Expr*, const CompactExpr*>> stack = {{expr, compact}};
+  while (!stack.empty()) {
+    expr = stack.back().first;
+    compact = stack.back().second;
+    stack.pop_back();
+    if (expr == nullptr) {
+      ASSERT_NULL(compact);
+      continue;
+    }
+    ++numNodes;
+
+    ASSERT_EQ(compact->type(), expr->type);
+    ASSERT_EQ(compact->opType(), expr->opType);
+    ASSERT_EQ(compact->datetimeField(), expr->datetimeField);
+    ASSERT_EQ(compact->isBoolLiteral(), expr->isBoolLiteral);
+    ASSERT_EQ(compact->distinct(), expr->distinct);
+    ASSERT_EQ(compact->ival(), expr->ival);
+    ASSERT_EQ(compact->ival2(), expr->ival2);
+    ASSERT_EQ(compact->fval(), expr->fval);
+    ASSERT_EQ(compact->select(), expr->select);
+    const bool sameColumnType = compact->columnType() == expr->columnType;
+    ASSERT(sameColumnType);
+    ASSERT_EQ(compact->isLiteral(), expr->isLiteral());
+    ASSERT_EQ(compact->hasAlias(), expr->hasAlias());
+    ASSERT_EQ(compact->hasTable(), expr->hasTable());
+    for (const auto& names : {std::make_pair(compact->name(), expr->name), std::make_pair(compact->table(), expr->table),
+                              std::make_pair(compact->alias(), expr->alias)}) {
+      ASSERT((names.first == nullptr) == (names.second == nullptr));
+      if (names.first != nullptr) ASSERT_STREQ(names.first, names.second);
+    }
+
+    ASSERT((compact->expr() == nullptr) == (expr->expr == nullptr));
+    ASSERT((compact->expr2() == nullptr) == (expr->expr2 == nullptr));
+    stack.push_back({expr->expr, compact->expr()});
+    stack.push_back({expr->expr2, compact->expr2()});
+    ASSERT(compact->hasExprList() == (expr->exprList != nullptr));
+    if (expr->exprList != nullptr) {
+      ASSERT_EQ(compact->exprList().size(), expr->exprList->size());
+      for (size_t i = 0; i < expr->exprList->size(); ++i) stack.push_back({expr->exprList->at(i), compact->exprList()[i]});
+    } else {
+      ASSERT(compact->exprList().empty());
+    }
+  }
+  return numNodes;
+}
+
+const Expr* whereClause(const SQLParserResult& result) {
+  return static_cast<const SelectStatement*>(result.getStatement(0))->whereClause;
+}
+
+}  // namespace
+
+TEST(CompactExprTest) {
+  SQLParserResult result;
+  SQLParser::parse(
+      "SELECT t.a AS x, COUNT(DISTINCT b), CAST(c AS VARCHAR(10)), EXTRACT(YEAR FROM d), e[2], * FROM t "
+      "WHERE a BETWEEN 1.5 AND ? AND b IN (1, 2, 3) AND c IN (SELECT c FROM u) AND NOT d IS NULL "
+      "AND e = CASE WHEN f = 'x' THEN TRUE ELSE FALSE END AND g > DATE '2000-01-01' + INTERVAL '3' DAY;",
+      &result);
+  ASSERT(result.isValid());
+  const SelectStatement* select = static_cast<const SelectStatement*>(result.getStatement(0));
+
+  Arena arena;
+  for (const Expr* expr : *select->selectList) assertSameTree(expr, CompactExpr::make(expr, &arena));
+  const CompactExpr* where = CompactExpr::make(select->whereClause, &arena);
+  assertSameTree(select->whereClause, where);
+  ASSERT_NULL(CompactExpr::make(nullptr, &arena));
+
+  // Strings are copied, subqueries are shared with the source.
+  ASSERT_STREQ(where->expr2()->expr()->name(), "g");
+  ASSERT(arena.owns(where->expr2()->expr()->name()));
+  const CompactExpr* inSelect = where->expr()->expr()->expr()->expr2();
+  ASSERT_EQ(inSelect->opType(), kOpIn);
+  ASSERT_NOTNULL(inSelect->select());
+  ASSERT_FALSE(arena.owns(inSelect->select()));
+
+  // Absent fields read as zero.
+  const CompactExpr* arrayIndex = CompactExpr::make(select->selectList->at(4), &arena);
+  ASSERT_EQ(arrayIndex->ival(), 2);
+  ASSERT_NULL(arrayIndex->name());
+  ASSERT_STREQ(arrayIndex->expr()->name(), "e");
+  ASSERT_EQ(arrayIndex->expr()->ival(), 0);
+  ASSERT_EQ(arrayIndex->expr()->fval(), 0);
+}
+
+TEST(CompactExprSizeTest) {
+  std::string query = "SELECT * FROM t WHERE a0 = 0";
+  for (int i = 1; i < 1000; ++i) query += " AND a" + std::to_string(i) + " = " + std::to_string(i);
+  for (bool flatten : {false, true}) {
+    ParserContext context;
+    context.setFlattenLogicalOperators(flatten);
+    SQLParserResult result;
+    context.parse(query, &result);
+    ASSERT(result.isValid());
+
+    Arena arena;
+    const CompactExpr* where = CompactExpr::make(whereClause(result), &arena);
+    const size_t numNodes = assertSameTree(whereClause(result), where);
+    ASSERT(where->isNaryOperator(kOpAnd) == flatten);
+
+    // The copy takes a fraction of the memory of the nodes alone.
+    const size_t compactBytes = arena.bytesUsed();
+    ASSERT(compactBytes * 4 < numNodes * sizeof(Expr));
+  }
+}
+
+TEST(CompactExprDeepTest) {
+  Expr* deep = Expr::makeColumnRef(strdup("a"));
+  for (int i = 0; i < 1000000; ++i) deep = Expr::makeOpBinary(deep, kOpPlus, Expr::makeLiteral(static_cast<int64_t>(i)));
+
+  Arena arena;
+  const CompactExpr* compact = CompactExpr::make(deep, &arena);
+  size_t depth = 0;
+  for (const CompactExpr* e = compact; e->expr() != nullptr; e = e->expr()) ++depth;
+  ASSERT_EQ(depth, 1000000u);
+  ASSERT_EQ(compact->expr2()->ival(), 999999);
+  delete deep;
+}
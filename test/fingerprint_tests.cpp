@@ -0,0 +1,130 @@
+#include "thirdparty/microtest/microtest.h"
+
+#include <string>
+
+#include "SQLParser.h"
+#include "parser/bison_parser.h"
+
+using namespace hsql;
+
+QueryFingerprint fingerprint(const std::string& query) {
+  QueryFingerprint fingerprint;
+  SQLParser::fingerprint(query, &fingerprint);
+  return fingerprint;
+}
+
+TEST(FingerprintNormalizationTest) {
+  const QueryFingerprint result = fingerprint("select  Name,COUNT( * )\n from Students s where s.id = 42 -- comment");
+  ASSERT(result.isValid());
+  ASSERT_STREQ(result.text(), "SELECT Name, COUNT(*) FROM Students s WHERE s.id = ?");
+
+  // Keyword case, whitespace, comments and literal values do not change the fingerprint.
+  const QueryFingerprint other = fingerprint("SELECT Name, COUNT(*) FROM Students s\nWHERE s.id = 7");
+  ASSERT_STREQ(other.text(), result.text());
+  ASSERT_EQ(other.hash(), result.hash());
+
+  // Identifiers do.
+  ASSERT_NEQ(fingerprint("SELECT name, COUNT(*) FROM Students s WHERE s.id = 7").hash(), result.hash());
+
+  ASSERT_STREQ(fingerprint("SELECT CAST(a AS CHARACTER\tVARYING(5)) FROM t WHERE b <> 1 AND c = 'x';").text(),
+               "SELECT CAST (a AS CHARACTER VARYING (5)) FROM t WHERE b != ? AND c = ?;");
+  ASSERT_STREQ(fingerprint("SELECT a[2], ARRAY[1, 2], CAST(b AS DECIMAL(10, 2)) FROM t").text(),
+               "SELECT a[2], ARRAY[?, ?], CAST (b AS DECIMAL (10, 2)) FROM t");
+  ASSERT_STREQ(fingerprint("SELECT \"Select\" FROM t").text(), "SELECT \"Select\" FROM t");
+}
+
+TEST(FingerprintPositionTest) {
+  // Integers that are whole items of ORDER BY and GROUP BY lists are column positions.
+  const QueryFingerprint result =
+      fingerprint("SELECT a, 1, COUNT(*) FROM t GROUP BY 1, a + 2 HAVING COUNT(*) > 3 ORDER BY 3 DESC, 2 LIMIT 4");
+  ASSERT(result.isValid());
+  ASSERT_STREQ(result.text(),
+               "SELECT a, ?, COUNT(*) FROM t GROUP BY 1, a + ? HAVING COUNT(*) > ? ORDER BY 3 DESC, 2 LIMIT ?");
+  ASSERT_EQ(result.literals().size(), 4);
+  ASSERT_NEQ(fingerprint("SELECT a, b FROM t ORDER BY 1").hash(), fingerprint("SELECT a, b FROM t ORDER BY 2").hash());
+
+  // The lists end with their query.
+  ASSERT_STREQ(fingerprint("SELECT * FROM t WHERE a IN (SELECT b FROM u ORDER BY 1) AND c IN (f(1, 2), 3)").text(),
+               "SELECT * FROM t WHERE a IN (SELECT b FROM u ORDER BY 1) AND c IN (f(?, ?), ?)");
+  ASSERT_STREQ(fingerprint("SELECT a FROM t ORDER BY f(1, 2), (SELECT 3), 4; SELECT 5, 6").text(),
+               "SELECT a FROM t ORDER BY f(?, ?), (SELECT ?), 4; SELECT ?, ?");
+}
+
+TEST(FingerprintLiteralTest) {
+  const QueryFingerprint result = fingerprint(
+      "SELECT * FROM t WHERE a = 1 AND b = 2.5 AND c = 'it''s' AND d = DATE '2024-01-31' AND e = ? "
+      "AND f > INTERVAL '3 days' AND g > INTERVAL '4' HOUR AND h > 5 MINUTES");
+  ASSERT(result.isValid());
+  ASSERT_STREQ(result.text(),
+               "SELECT * FROM t WHERE a = ? AND b = ? AND c = ? AND d = ? AND e = ? AND f > ? AND g > ? AND h > ?");
+
+  const std::vector<FingerprintLiteral>& literals = result.literals();
+  ASSERT_EQ(literals.size(), 8);
+  ASSERT_EQ(literals[0].type, kExprLiteralInt);
+  ASSERT_EQ(literals[0].ival, 1);
+  ASSERT_EQ(literals[1].type, kExprLiteralFloat);
+  ASSERT_EQ(literals[1].fval, 2.5);
+  ASSERT_EQ(literals[2].type, kExprLiteralString);
+  ASSERT_STREQ(literals[2].sval, "it's");
+  ASSERT_EQ(literals[3].type, kExprLiteralDate);
+  ASSERT_STREQ(literals[3].sval, "2024-01-31");
+  ASSERT_EQ(literals[4].type, kExprParameter);
+  ASSERT_EQ(literals[5].type, kExprLiteralInterval);
+  ASSERT_EQ(literals[5].ival, 3);
+  ASSERT_EQ(literals[5].datetimeField, kDatetimeDay);
+  ASSERT_EQ(literals[6].type, kExprLiteralInterval);
+  ASSERT_EQ(literals[6].ival, 4);
+  ASSERT_EQ(literals[6].datetimeField, kDatetimeHour);
+  ASSERT_EQ(literals[7].type, kExprLiteralInterval);
+  ASSERT_EQ(literals[7].ival, 5);
+  ASSERT_EQ(literals[7].datetimeField, kDatetimeMinute);
+
+  // Literals know their position in the query.
+  ASSERT_EQ(literals[2].offset, 48);
+  ASSERT_EQ(literals[2].length, 7);
+  ASSERT_EQ(literals[3].length, 17);
+}
+
+TEST(FingerprintInListTest) {
+  const QueryFingerprint result = fingerprint("SELECT * FROM t WHERE a IN (1, 2, 3) AND b IN ('x') AND c IN (SELECT d FROM u)");
+  ASSERT(result.isValid());
+  ASSERT_STREQ(result.text(), "SELECT * FROM t WHERE a IN (...) AND b IN (...) AND c IN (SELECT d FROM u)");
+  ASSERT_EQ(result.literals().size(), 4);
+  ASSERT_EQ(result.literals()[2].ival, 3);
+  ASSERT_STREQ(result.literals()[3].sval, "x");
+
+  // The length of the list does not change the fingerprint.
+  ASSERT_EQ(fingerprint("SELECT * FROM t WHERE a IN (7) AND b IN ('y', 'z') AND c IN (SELECT d FROM u)").hash(),
+            result.hash());
+
+  // Lists with other expressions are kept.
+  ASSERT_STREQ(fingerprint("SELECT * FROM t WHERE a IN (1, b)").text(), "SELECT * FROM t WHERE a IN (?, b)");
+}
+
+TEST(FingerprintInvalidTest) {
+  ASSERT_FALSE(fingerprint("SELECT $ FROM t").isValid());
+  ASSERT_FALSE(fingerprint("SELECT 'unterminated").isValid());
+  ASSERT_FALSE(fingerprint("SELECT DATE '2024-1-1x'").isValid());
+  ASSERT_FALSE(fingerprint("SELECT INTERVAL '2 weeks'").isValid());
+  ASSERT_FALSE(fingerprint("SELECT INTERVAL 'x' DAY").isValid());
+
+  // Integers that do not fit into 64 bits cannot be parsed, not even when they are replaced.
+  ASSERT_FALSE(fingerprint("SELECT 99999999999999999999 FROM t").isValid());
+  ASSERT_FALSE(fingerprint("SELECT * FROM t WHERE a IN (1, 99999999999999999999)").isValid());
+  TokenStream tokens;
+  tokens.add(SQL_SELECT, 0, 6, TokenValue());
+  tokens.add(SQL_HSQL_UNDEF, 7, 1, TokenValue());
+  QueryFingerprint fromTokens;
+  fromTokens.compute("SELECT 9", tokens);
+  ASSERT_FALSE(fromTokens.isValid());
+
+  // A context reuses the fingerprint and its tokens.
+  ParserContext context;
+  QueryFingerprint result;
+  ASSERT(context.fingerprint("SELECT 'unterminated", &result));
+  ASSERT_FALSE(result.isValid());
+  ASSERT(context.fingerprint("SELECT 1", &result));
+  ASSERT(result.isValid());
+  ASSERT_STREQ(result.text(), "SELECT ?");
+  ASSERT_EQ(result.literals().size(), 1);
+}
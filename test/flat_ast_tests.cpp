@@ -0,0 +1,246 @@
+#include "thirdparty/microtest/microtest.h"
+
+#include <string>
+#include <vector>
+
+#include "FlatAst.h"
+#include "SQLParser.h"
+
+using namespace hsql;
+
+namespace {
+
+// Records the nodes in the order they are entered and left.
+class RecordingVisitor : public FlatAstVisitor {
+ public:
+  bool enter(const FlatAst& ast, FlatNodeId node) override {
+    entered.push_back(node);
+    // Subqueries are skipped.
+    return !(ast.kind(node) == kFlatStatement && ast.role(node) == kRoleSubquery);
+  }
+
+  void leave(const FlatAst&, FlatNodeId node) override { left.push_back(node); }
+
+  std::vector<FlatNodeId> entered;
+  std::vector<FlatNodeId> left;
+};
+
+// Returns the child of the node with the given role, or FlatAst::kNone.
+FlatNodeId child(const FlatAst& ast, FlatNodeId node, FlatNodeRole role) {
+  for (FlatNodeId c = ast.firstChild(node); c < ast.firstChild(node) + ast.numChildren(node); ++c) {
+    if (ast.role(c) == role) return c;
+  }
+  return FlatAst::kNone;
+}
+
+}  // namespace
+
+TEST(FlatAstSelectTest) {
+  SQLParserResult result;
+  SQLParser::parse(
+      "SELECT DISTINCT t.a AS x, SUM(b) FROM t JOIN u ON t.id = u.id "
+      "WHERE c > 1.5 AND d IN (SELECT d FROM v) GROUP BY a HAVING SUM(b) > ? ORDER BY x DESC LIMIT 10; "
+      "DELETE FROM s.w WHERE e = 'x';",
+      &result);
+  ASSERT(result.isValid());
+
+  FlatAst ast;
+  ASSERT(ast.build(result));
+  ASSERT_EQ(ast.numStatements(), 2);
+  ASSERT_EQ(ast.kind(0), kFlatStatement);
+  ASSERT_EQ(ast.type(0), kStmtSelect);
+  ASSERT(ast.hasFlag(0, kFlatDistinct));
+  ASSERT_EQ(ast.type(1), kStmtDelete);
+  ASSERT_STREQ(ast.name(1), "w");
+  ASSERT_STREQ(ast.qualifier(1), "s");
+
+  // Children are consecutive and point back to their parent.
+  for (FlatNodeId node = 0; node < ast.size(); ++node) {
+    for (FlatNodeId c = ast.firstChild(node); c < ast.firstChild(node) + ast.numChildren(node); ++c) {
+      ASSERT_EQ(ast.parent(c), node);
+    }
+  }
+
+  const FlatNodeId column = ast.firstChild(0);
+  ASSERT_EQ(ast.role(column), kRoleSelectList);
+  ASSERT(ast.isExpr(column, kExprColumnRef));
+  ASSERT_STREQ(ast.name(column), "a");
+  ASSERT_STREQ(ast.qualifier(column), "t");
+  ASSERT_STREQ(ast.alias(column), "x");
+
+  const FlatNodeId from = child(ast, 0, kRoleFrom);
+  ASSERT_EQ(ast.type(from), kTableJoin);
+  const FlatNodeId join = child(ast, from, kRoleJoin);
+  ASSERT_EQ(ast.type(join), kJoinInner);
+  ASSERT_STREQ(ast.name(child(ast, join, kRoleJoinRight)), "u");
+  ASSERT_EQ(ast.detail(child(ast, join, kRoleJoinCondition)), kOpEquals);
+
+  const FlatNodeId where = child(ast, 0, kRoleWhere);
+  ASSERT_EQ(ast.detail(where), kOpAnd);
+  const FlatNodeId greater = child(ast, where, kRoleExpr);
+  ASSERT_EQ(ast.floatValue(child(ast, greater, kRoleExpr2)), 1.5);
+  const FlatNodeId in = child(ast, where, kRoleExpr2);
+  ASSERT_EQ(ast.detail(in), kOpIn);
+  ASSERT_EQ(ast.type(child(ast, in, kRoleSubquery)), kStmtSelect);
+
+  const FlatNodeId having = child(ast, child(ast, 0, kRoleGroupBy), kRoleHaving);
+  const FlatNodeId parameter = child(ast, having, kRoleExpr2);
+  ASSERT(ast.isExpr(parameter, kExprParameter));
+  ASSERT_EQ(ast.intValue(parameter, 1), 0);
+
+  const FlatNodeId order = child(ast, 0, kRoleOrderBy);
+  ASSERT_EQ(ast.type(order), kOrderDesc);
+  ASSERT_EQ(ast.intValue(child(ast, child(ast, 0, kRoleLimit), kRoleLimit)), 10);
+  ASSERT_STREQ(ast.name(child(ast, child(ast, 1, kRoleWhere), kRoleExpr2)), "x");
+
+  // The arrays hold no pointers, so a copy is equivalent.
+  const FlatAst copy = ast;
+  ASSERT_STREQ(copy.name(column), "a");
+  ASSERT_EQ(copy.firstChild(from), ast.firstChild(from));
+
+  // The visitor walks depth-first, the subquery of the IN is entered but not descended into.
+  RecordingVisitor visitor;
+  ast.accept(&visitor);
+  ASSERT_EQ(visitor.entered.size(), visitor.left.size());
+  ASSERT_EQ(visitor.entered[0], 0u);
+  ASSERT_EQ(visitor.entered[1], column);
+  ASSERT_EQ(visitor.left.back(), 1u);
+  const FlatNodeId subquery = child(ast, in, kRoleSubquery);
+  size_t numVisited = 0;
+  for (FlatNodeId node : visitor.entered) {
+    if (ast.parent(node) == subquery) ++numVisited;
+  }
+  ASSERT_EQ(numVisited, 0u);
+}
+
+TEST(FlatAstInsertUpdateTest) {
+  SQLParserResult result;
+  SQLParser::parse(
+      "INSERT INTO t (a, b) VALUES (1, 'x'), (NULL, 'y'); UPDATE t SET a = a + 1 WHERE b = 'x'; "
+      "INSERT INTO t SELECT * FROM u; DROP TABLE t;",
+      &result);
+  ASSERT(result.isValid());
+
+  FlatAst ast;
+  ASSERT(ast.build(result));
+  ASSERT_EQ(ast.numStatements(), 4);
+
+  ASSERT_EQ(ast.detail(0), kInsertValues);
+  ASSERT_STREQ(ast.name(0), "t");
+  const FlatNodeId columns = child(ast, 0, kRoleColumn);
+  ASSERT_STREQ(ast.name(columns), "a");
+  ASSERT_STREQ(ast.name(columns + 1), "b");
+  const FlatNodeId row = child(ast, 0, kRoleRow);
+  ASSERT_EQ(ast.numChildren(row), 2);
+  ASSERT_EQ(ast.numChildren(row + 1), 2);
+  ASSERT_EQ(ast.intValue(ast.firstChild(row)), 1);
+  ASSERT_STREQ(ast.name(ast.firstChild(row) + 1), "x");
+  ASSERT(ast.isExpr(ast.firstChild(row + 1), kExprLiteralNull));
+  ASSERT_STREQ(ast.name(ast.firstChild(row + 1) + 1), "y");
+
+  const FlatNodeId update = child(ast, 1, kRoleUpdate);
+  ASSERT_STREQ(ast.name(update), "a");
+  ASSERT_EQ(ast.detail(child(ast, update, kRoleValue)), kOpPlus);
+  ASSERT_STREQ(ast.name(child(ast, 1, kRoleTable)), "t");
+
+  ASSERT_EQ(ast.detail(2), kInsertSelect);
+  ASSERT_EQ(ast.type(child(ast, 2, kRoleSubquery)), kStmtSelect);
+  ASSERT_EQ(ast.type(3), kStmtDrop);
+  ASSERT_EQ(ast.numChildren(3), 0);
+
+  // Invalid results leave the table empty.
+  result.reset();
+  SQLParser::parse("SELECT * FROM;", &result);
+  ASSERT_FALSE(ast.build(result));
+  ASSERT_EQ(ast.size(), 0);
+}
+
+TEST(FlatAstOtherStatementsTest) {
+  SQLParserResult result;
+  SQLParser::parse(
+      "CREATE TABLE IF NOT EXISTS s.t (a VARCHAR(30) NOT NULL, b DOUBLE PRIMARY KEY UNIQUE, c INT NULL, UNIQUE (a, c)); "
+      "CREATE VIEW v (x) AS SELECT a FROM t; CREATE INDEX i ON t (a, b); DROP TABLE IF EXISTS s.t; DROP INDEX i; "
+      "ALTER TABLE t DROP COLUMN IF EXISTS a; PREPARE p FROM 'SELECT ?'; EXECUTE p(1, 'x'); SHOW COLUMNS t; "
+      "IMPORT FROM CSV FILE 'f.csv' INTO t; COPY t TO 'f.tbl'; COMMIT; SELECT * FROM t WITH HINT(NO_CACHE);",
+      &result);
+  ASSERT(result.isValid());
+
+  FlatAst ast;
+  ASSERT(ast.build(result));
+  ASSERT_EQ(ast.numStatements(), 13);
+
+  ASSERT_EQ(ast.type(0), kStmtCreate);
+  ASSERT_EQ(ast.detail(0), kCreateTable);
+  ASSERT(ast.hasFlag(0, kFlatIfExists));
+  ASSERT_STREQ(ast.name(0), "t");
+  ASSERT_STREQ(ast.qualifier(0), "s");
+  ASSERT_EQ(ast.numChildren(0), 4);
+  const FlatNodeId column = child(ast, 0, kRoleColumn);
+  ASSERT_EQ(ast.kind(column), kFlatColumnDefinition);
+  ASSERT_STREQ(ast.name(column), "a");
+  ASSERT_EQ(ast.type(column), static_cast<uint8_t>(DataType::VARCHAR));
+  ASSERT_EQ(ast.intValue(column), 30);
+  ASSERT_FALSE(ast.hasFlag(column, kFlatNullable));
+  ASSERT(ast.hasFlag(column + 2, kFlatNullable));
+  ASSERT_EQ(ast.numChildren(column + 1), 2);
+  ASSERT_EQ(ast.type(ast.firstChild(column + 1)), static_cast<uint8_t>(ConstraintType::PrimaryKey));
+  ASSERT_EQ(ast.type(ast.firstChild(column + 1) + 1), static_cast<uint8_t>(ConstraintType::Unique));
+  const FlatNodeId constraint = child(ast, 0, kRoleConstraint);
+  ASSERT_EQ(ast.type(constraint), static_cast<uint8_t>(ConstraintType::Unique));
+  ASSERT_EQ(ast.numChildren(constraint), 2);
+  ASSERT_STREQ(ast.name(ast.firstChild(constraint) + 1), "c");
+
+  ASSERT_EQ(ast.detail(1), kCreateView);
+  ASSERT_STREQ(ast.name(child(ast, 1, kRoleColumn)), "x");
+  ASSERT_EQ(ast.type(child(ast, 1, kRoleSubquery)), kStmtSelect);
+  ASSERT_EQ(ast.detail(2), kCreateIndex);
+  ASSERT_STREQ(ast.text(2), "i");
+  ASSERT_EQ(ast.numChildren(2), 2);
+
+  // The table name of DROP is kept.
+  ASSERT_EQ(ast.detail(3), kDropTable);
+  ASSERT(ast.hasFlag(3, kFlatIfExists));
+  ASSERT_STREQ(ast.name(3), "t");
+  ASSERT_STREQ(ast.qualifier(3), "s");
+  ASSERT_EQ(ast.detail(4), kDropIndex);
+  ASSERT_STREQ(ast.text(4), "i");
+
+  const FlatNodeId action = child(ast, 5, kRoleAction);
+  ASSERT_EQ(ast.type(action), DropColumn);
+  ASSERT_STREQ(ast.name(action), "a");
+  ASSERT(ast.hasFlag(action, kFlatIfExists));
+
+  ASSERT_STREQ(ast.name(6), "p");
+  ASSERT_STREQ(ast.text(6), "SELECT ?");
+  ASSERT_STREQ(ast.name(7), "p");
+  ASSERT_EQ(ast.numChildren(7), 2);
+  ASSERT_EQ(ast.intValue(child(ast, 7, kRoleValue)), 1);
+
+  ASSERT_EQ(ast.detail(8), kShowColumns);
+  ASSERT_STREQ(ast.name(8), "t");
+  ASSERT_EQ(ast.type(9), kStmtImport);
+  ASSERT_EQ(ast.detail(9), kImportCSV);
+  ASSERT_STREQ(ast.text(9), "f.csv");
+  ASSERT_EQ(ast.type(10), kStmtExport);
+  ASSERT_STREQ(ast.name(10), "t");
+  ASSERT_STREQ(ast.text(10), "f.tbl");
+  ASSERT_EQ(ast.detail(11), kCommitTransaction);
+
+  const FlatNodeId hint = child(ast, 12, kRoleHint);
+  ASSERT(ast.isExpr(hint, kExprHint));
+  ASSERT_STREQ(ast.name(hint), "NO_CACHE");
+}
+
+TEST(FlatAstDeepTest) {
+  SQLParserResult result;
+  std::string query = "SELECT * FROM t WHERE a";
+  for (int i = 0; i < 10000; ++i) query += " AND a";
+  SQLParser::parse(query, &result);
+  ASSERT(result.isValid());
+
+  FlatAst ast;
+  ASSERT(ast.build(result));
+  RecordingVisitor visitor;
+  ast.accept(&visitor);
+  ASSERT_EQ(visitor.entered.size(), ast.size());
+}
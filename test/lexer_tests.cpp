@@ -0,0 +1,154 @@
+#include "thirdparty/microtest/microtest.h"
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "ParserContext.h"
+#include "parser/bison_parser.h"
+#include "parser/flex_lexer.h"
+#include "parser/simd_lexer.h"
+
+// Defined in the user code section of flex_lexer.l.
+void hsql_reset_start_condition(yyscan_t yyscanner);
+
+using hsql::ParseState;
+using hsql::SimdLevel;
+
+// Describes all tokens of the query with their locations and values.
+// Scans with flex if level is negative, with the SimdLexer otherwise.
+std::vector<std::string> lex(const std::string& query, int level) {
+  std::vector<char> buffer(query.begin(), query.end());
+  buffer.resize(query.size() + 2, '\0');
+  ParseState state = {buffer.data(), nullptr, nullptr, 0, nullptr, false};
+  hsql::SimdLexer simd_lexer(buffer.data(), query.size(), &state, static_cast<SimdLevel>(level < 0 ? 0 : level));
+
+  yyscan_t scanner;
+  hsql_lex_init(&scanner);
+  hsql_set_extra(&state, scanner);
+  hsql_reset_start_condition(scanner);
+  YY_BUFFER_STATE flex_buffer = hsql__scan_buffer(buffer.data(), buffer.size(), scanner);
+
+  std::vector<std::string> tokens;
+  HSQL_STYPE value;
+  HSQL_LTYPE location = {0, 0};
+  int token;
+  while ((token = level < 0 ? hsql_lex(&value, &location, scanner) : simd_lexer.next(&value, &location)) != 0) {
+    std::stringstream description;
+    description << token << "@" << location.first_offset << "-" << location.last_offset;
+    if (token == SQL_IDENTIFIER || token == SQL_STRING) {
+      description << " " << value.sval;
+      free(value.sval);
+    } else if (token == SQL_INTVAL) {
+      description << " " << value.ival;
+    } else if (token == SQL_FLOATVAL) {
+      description << " " << value.fval;
+    }
+    tokens.push_back(description.str());
+  }
+
+  std::stringstream end;
+  end << "end@" << location.first_offset << "-" << location.last_offset;
+  tokens.push_back(end.str());
+
+  hsql__delete_buffer(flex_buffer, scanner);
+  hsql_lex_destroy(scanner);
+  return tokens;
+}
+
+// Checks that all instruction sets of the SimdLexer that the CPU supports produce the same tokens as flex.
+void test_lexers(const std::string& query) {
+  const std::vector<std::string> expected = lex(query, -1);
+  for (int level = hsql::kSimdNone; level <= hsql::SimdLexer::detectSimdLevel(); ++level) {
+    const std::vector<std::string> tokens = lex(query, level);
+    ASSERT_EQ(tokens.size(), expected.size());
+    for (size_t i = 0; i < tokens.size(); ++i) {
+      ASSERT_STREQ(tokens[i], expected[i]);
+    }
+  }
+}
+
+TEST(SimdLexerQueryFileTest) {
+  DIR* directory = opendir("test/queries");
+  ASSERT_NOTNULL(directory);
+
+  size_t num_files = 0;
+  while (dirent* entry = readdir(directory)) {
+    const std::string name = entry->d_name;
+    if (name.size() < 4 || name.substr(name.size() - 4) != ".sql") continue;
+
+    std::ifstream file("test/queries/" + name);
+    std::stringstream content;
+    content << file.rdbuf();
+    test_lexers(content.str());
+
+    std::string line;
+    while (std::getline(content, line)) test_lexers(line);
+    ++num_files;
+  }
+  closedir(directory);
+  ASSERT(num_files > 0);
+}
+
+TEST(SimdLexerEdgeCaseTest) {
+  const std::string long_identifier(100, 'x');
+  const std::string long_whitespace = std::string(40, ' ') + "\t\n" + std::string(40, ' ');
+
+  const std::vector<std::string> queries = {
+      "",
+      "SELECT a --\n  FROM t -- trailing",
+      "-- comment only",
+      "character varying CHARACTER\n\tVARYING(10) character varyingx character",
+      "SELECT " + long_identifier + " FROM " + long_identifier + "_1;",
+      long_whitespace + "SELECT" + long_whitespace,
+      "SELECT '" + long_identifier + "''" + long_identifier + "', '', '''', 'a''b' FROM t",
+      "SELECT 'unterminated " + long_identifier,
+      "SELECT 'unterminated''",
+      "SELECT \"" + long_identifier + "\", \"\", \"a\nb\" FROM t",
+      "SELECT -9223372036854775808, -9223372036854775807, 9223372036854775808, 012, 09",
+      "SELECT 1.5.3, ..5, .5, 5., 1e5 FROM t",
+      "SELECT a==b, a!=b, a<>b, a<=b, a>=b, a||b, a!b",
+      std::string("SELECT a\0b", 10),
+      "SELECT \xc3\xa4 FROM t",
+      "SELECT _a, a_ FROM t\r\n",
+  };
+  for (const std::string& query : queries) test_lexers(query);
+}
+
+TEST(StringLiteralTest) {
+  // Literals are single tokens that span both quotes.
+  const std::vector<std::string> tokens = lex("SELECT 'it''s', '', 'a\nb';", -1);
+  const std::string string_token = std::to_string(SQL_STRING);
+  ASSERT_EQ(tokens.size(), 8);
+  ASSERT_STREQ(tokens[1], string_token + "@7-14 it's");
+  ASSERT_STREQ(tokens[3], string_token + "@16-18 ");
+  ASSERT_STREQ(tokens[5], string_token + "@20-25 a\nb");
+  test_lexers("SELECT 'it''s', '', 'a\nb';");
+
+  // Unterminated literals extend to the end of the input.
+  const std::vector<std::string> unterminated = lex("SELECT 'a''", -1);
+  ASSERT_EQ(unterminated.size(), 2);
+  ASSERT_STREQ(unterminated[1], "end@7-11");
+}
+
+TEST(IntegerOutOfRangeTest) {
+  // Integers that do not fit into 64 bits are invalid tokens, which the parser rejects even behind
+  // a complete statement.
+  const std::vector<std::string> tokens = lex("SELECT 99999999999999999999 FROM t", -1);
+  ASSERT_EQ(tokens.size(), 5);
+  ASSERT_STREQ(tokens[1], std::to_string(SQL_HSQL_UNDEF) + "@7-27");
+  test_lexers("SELECT 99999999999999999999 FROM t");
+
+  for (hsql::LexerType lexer : {hsql::kLexerFlex, hsql::kLexerSimd, hsql::kLexerScalar}) {
+    hsql::ParserContext context;
+    context.setLexer(lexer);
+    hsql::SQLParserResult result;
+    context.parse("SELECT 1 FROM t; 99999999999999999999", &result);
+    ASSERT_FALSE(result.isValid());
+    ASSERT_EQ(result.errorColumn(), 17);
+  }
+}
@@ -0,0 +1,138 @@
+#include "thirdparty/microtest/microtest.h"
+
+#include <string>
+
+#include "ParallelParser.h"
+#include "SQLParser.h"
+
+using namespace hsql;
+
+namespace {
+
+std::string makeScript(size_t numStatements) {
+  std::string script = "-- migration\n";
+  for (size_t i = 0; i < numStatements; ++i) {
+    const std::string n = std::to_string(i);
+    switch (i % 4) {
+      case 0:
+        script += "SELECT a, 'x;" + n + "' FROM t WHERE b = ? AND c = ?;\n";
+        break;
+      case 1:
+        script += "INSERT INTO \"t;1\" VALUES (?, 'it''s;'), (?, NULL); -- done;\n";
+        break;
+      case 2:
+        script += "UPDATE t SET a = -" + n + " WHERE b = ?;  ";
+        break;
+      default:
+        script += "DELETE FROM t WHERE a = " + n + ";\n\n";
+        break;
+    }
+  }
+  return script + "SELECT 1";
+}
+
+// Checks that the results of the parallel and the sequential parse are the same.
+void assertSameResult(const SQLParserResult& parallel, const SQLParserResult& sequential) {
+  ASSERT_EQ(parallel.isValid(), sequential.isValid());
+  ASSERT_EQ(parallel.size(), sequential.size());
+  for (size_t i = 0; i < sequential.size(); ++i) {
+    ASSERT_EQ(parallel.getStatement(i)->type(), sequential.getStatement(i)->type());
+    ASSERT_EQ(parallel.getStatement(i)->stringLength, sequential.getStatement(i)->stringLength);
+  }
+  ASSERT_EQ(parallel.parameters().size(), sequential.parameters().size());
+  for (size_t i = 0; i < parallel.parameters().size(); ++i) {
+    const Expr* parameter = parallel.parameters()[i];
+    ASSERT(parameter->ival == static_cast<int64_t>(i) && parameter->ival2 == static_cast<int64_t>(i));
+  }
+}
+
+}  // namespace
+
+TEST(ParallelParserTest) {
+  const std::string script = makeScript(1000);
+  SQLParserResult sequential;
+  SQLParser::parse(script, &sequential);
+  ASSERT(sequential.isValid());
+  ASSERT_EQ(sequential.size(), 1001);
+
+  ParallelParser parser(4);
+  parser.setLexer(kLexerSimd);
+  SQLParserResult parallel;
+  ASSERT(parser.parse(script, &parallel));
+  assertSameResult(parallel, sequential);
+
+  const InsertStatement* insert = (const InsertStatement*)parallel.getStatement(1);
+  ASSERT_STREQ(insert->tableName, "t;1");
+  ASSERT_STREQ(insert->rows->columns[1].stringValue(0), "it's;");
+  ASSERT(insert->rows->columns[0].exprValue(1) == parallel.parameters()[3]);
+
+  // In arena mode, the statements are moved into the arena of the result.
+  SQLParserResult arenaResult;
+  arenaResult.setUseArena(true);
+  ASSERT(parser.parse(script, &arenaResult));
+  assertSameResult(arenaResult, sequential);
+  ASSERT(arenaResult.arena()->owns(arenaResult.getStatement(0)));
+  ASSERT(arenaResult.arena()->owns(arenaResult.getStatement(1000)));
+}
+
+TEST(ParallelParserErrorTest) {
+  // The first invalid statement is reported with its location in the script.
+  std::string script = makeScript(500);
+  const size_t position = script.find("DELETE FROM t WHERE a = 203;");
+  script.insert(position + 20, "WHERE ");
+  script.insert(script.find("SELECT a, 'x;400'"), "SELECT * FROM;");
+
+  SQLParserResult sequential;
+  SQLParser::parse(script, &sequential);
+  ASSERT_FALSE(sequential.isValid());
+
+  ParallelParser parser(8);
+  SQLParserResult parallel;
+  ASSERT(parser.parse(script, &parallel));
+  ASSERT_FALSE(parallel.isValid());
+  ASSERT_EQ(parallel.size(), 0);
+  ASSERT_STREQ(parallel.errorMsg(), sequential.errorMsg());
+  ASSERT_EQ(parallel.errorLine(), sequential.errorLine());
+  ASSERT_EQ(parallel.errorColumn(), sequential.errorColumn());
+
+  // Empty statements are errors of the sequential parse.
+  script = makeScript(500) + ";;";
+  SQLParserResult empty;
+  ASSERT(parser.parse(script, &empty));
+  ASSERT_FALSE(empty.isValid());
+}
+
+TEST(ParallelParserLexerStopTest) {
+  // The lexer ends a sequential parse at characters it does not accept and at unterminated strings
+  // and quoted identifiers, so the statements behind them are not parsed.
+  const std::string base = makeScript(500);
+  const size_t position = base.find("DELETE FROM t WHERE a = 203;") + 28;
+  for (const char* insertion : {"@", "\r\n", " _a", " 1_", "\"\"", " \"a\nb\" ", " ! ", "!", "'"}) {
+    std::string script = base;
+    script.insert(position, insertion);
+    for (LexerType lexer : {kLexerFlex, kLexerSimd}) {
+      ParserContext context;
+      context.setLexer(lexer);
+      SQLParserResult sequential;
+      context.parse(script, &sequential);
+
+      ParallelParser parser(4);
+      parser.setLexer(lexer);
+      SQLParserResult parallel;
+      ASSERT(parser.parse(script, &parallel));
+      assertSameResult(parallel, sequential);
+    }
+  }
+
+  // Underscores in identifiers and != are accepted.
+  std::string script = base;
+  script.insert(position, " SELECT a_1 FROM t_2 WHERE b != 1;");
+  SQLParserResult sequential;
+  SQLParser::parse(script, &sequential);
+  ASSERT(sequential.isValid());
+  ASSERT_EQ(sequential.size(), 502);
+  ParallelParser parser(4);
+  SQLParserResult parallel;
+  ASSERT(parser.parse(script, &parallel));
+  assertSameResult(parallel, sequential);
+}
@@ -0,0 +1,119 @@
+#include "thirdparty/microtest/microtest.h"
+
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "ParseBatch.h"
+#include "SQLParser.h"
+
+using namespace hsql;
+
+namespace {
+
+std::vector<std::string> makeQueries(size_t numQueries) {
+  std::vector<std::string> queries;
+  for (size_t i = 0; i < numQueries; ++i) {
+    const std::string n = std::to_string(i);
+    switch (i % 4) {
+      case 0:
+        queries.push_back("SELECT a, 'x" + n + "' FROM t" + n + " WHERE b = ? AND c = ?;");
+        break;
+      case 1:
+        queries.push_back("INSERT INTO t VALUES (" + n + ", 'it''s'), (?, NULL);");
+        break;
+      case 2:
+        queries.push_back("SELECT * FROM WHERE a = " + n + ";");
+        break;
+      default:
+        queries.push_back("UPDATE t SET a = -" + n + " WHERE b = ?; DELETE FROM t;");
+        break;
+    }
+  }
+  return queries;
+}
+
+std::vector<std::string_view> views(const std::vector<std::string>& queries) {
+  return std::vector<std::string_view>(queries.begin(), queries.end());
+}
+
+// Checks that the batch holds the same results as separate parses of the queries.
+void assertSameResults(const ParseBatch& batch, const std::vector<std::string>& queries) {
+  ASSERT_EQ(batch.size(), queries.size());
+  for (size_t i = 0; i < queries.size(); ++i) {
+    SQLParserResult expected;
+    SQLParser::parse(queries[i], &expected);
+    const SQLParserResult& result = batch[i];
+    ASSERT_EQ(result.isValid(), expected.isValid());
+    ASSERT_EQ(result.size(), expected.size());
+    ASSERT_EQ(result.parameters().size(), expected.parameters().size());
+    ASSERT_EQ(result.errorLine(), expected.errorLine());
+    ASSERT_EQ(result.errorColumn(), expected.errorColumn());
+    for (size_t s = 0; s < expected.size(); ++s) {
+      ASSERT_EQ(result.getStatement(s)->type(), expected.getStatement(s)->type());
+      ASSERT_EQ(result.getStatement(s)->stringLength, expected.getStatement(s)->stringLength);
+    }
+    if (expected.isValid() && expected.getStatement(0)->isType(kStmtSelect)) {
+      const SelectStatement* select = static_cast<const SelectStatement*>(result.getStatement(0));
+      ASSERT_STREQ(select->fromTable->name, "t" + std::to_string(i));
+    }
+  }
+}
+
+}  // namespace
+
+TEST(ParseBatchTest) {
+  const std::vector<std::string> queries = makeQueries(100);
+  ParseBatch batch;
+  ASSERT(batch.parse(views(queries)));
+  assertSameResults(batch, queries);
+  ASSERT_STREQ(batch[2].errorMsg(), "syntax error, unexpected WHERE, expecting IDENTIFIER or '('");
+  ASSERT(batch.bytesReserved() > 0);
+
+  // Once the arena has grown to the size of a batch, later batches reuse its memory.
+  for (int i = 0; i < 5; ++i) ASSERT(batch.parse(views(queries)));
+  const size_t bytesReserved = batch.bytesReserved();
+  ASSERT(batch.parse(views(queries)));
+  assertSameResults(batch, queries);
+  ASSERT_EQ(batch.bytesReserved(), bytesReserved);
+
+  // The results share the arena of their worker, which owns their statements.
+  ASSERT(batch[0].usesArena());
+  ASSERT_EQ(batch[0].arena(), batch[1].arena());
+  ASSERT(batch[0].arena()->owns(batch[0].getStatement(0)));
+
+  // Queries can be slices of one buffer, which are not followed by null bytes.
+  std::string log;
+  std::vector<std::pair<size_t, size_t>> lines;
+  for (const std::string& query : queries) {
+    lines.emplace_back(log.size(), query.size());
+    log += query + "\n";
+  }
+  std::vector<std::string_view> slices;
+  for (const auto& line : lines) slices.push_back(std::string_view(log).substr(line.first, line.second));
+  ASSERT(batch.parse(slices));
+  assertSameResults(batch, queries);
+
+  batch.clear();
+  ASSERT_EQ(batch.size(), 0);
+  ASSERT(batch.parse({}));
+  ASSERT_EQ(batch.size(), 0);
+}
+
+TEST(ParseBatchParallelTest) {
+  for (size_t numThreads : {2, 4, 8}) {
+    const std::vector<std::string> queries = makeQueries(numThreads * ParseBatch::kMinQueriesPerThread + 7);
+    ParseBatch batch(numThreads);
+    batch.setLexer(kLexerSimd);
+    ASSERT_EQ(batch.numThreads(), numThreads);
+    ASSERT(batch.parse(views(queries)));
+    assertSameResults(batch, queries);
+
+    // Smaller batches use fewer threads.
+    const std::vector<std::string> small = makeQueries(10);
+    ASSERT(batch.parse(views(small)));
+    assertSameResults(batch, small);
+  }
+}
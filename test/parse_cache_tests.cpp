@@ -0,0 +1,91 @@
+#include "thirdparty/microtest/microtest.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ParseCache.h"
+
+using namespace hsql;
+
+TEST(ParseCacheHitTest) {
+  ParseCache cache(1 << 20);
+  std::shared_ptr<const SQLParserResult> result = cache.parse("SELECT * FROM students WHERE id = ?;");
+  ASSERT(result->isValid());
+  ASSERT_EQ(result->size(), 1);
+  ASSERT_EQ(result->parameters().size(), 1);
+
+  // Byte-identical queries share the result.
+  std::shared_ptr<const SQLParserResult> hit = cache.parse("SELECT * FROM students WHERE id = ?;");
+  ASSERT(hit == result);
+  std::shared_ptr<const SQLParserResult> miss = cache.parse("SELECT * FROM students WHERE id = ?; ");
+  ASSERT(miss != result);
+
+  ParseCacheStatistics statistics = cache.statistics();
+  ASSERT_EQ(statistics.hits, 1);
+  ASSERT_EQ(statistics.misses, 2);
+  ASSERT_EQ(statistics.evictions, 0);
+  ASSERT_EQ(statistics.size, 2);
+  ASSERT(statistics.memoryUsage > 0);
+  ASSERT(statistics.memoryUsage <= cache.memoryBudget());
+
+  // Errors are cached as well.
+  std::shared_ptr<const SQLParserResult> error = cache.parse("SELECT * FROM;");
+  ASSERT_FALSE(error->isValid());
+  ASSERT_NOTNULL(error->errorMsg());
+  ASSERT(cache.parse("SELECT * FROM;") == error);
+
+  // Results stay valid after they are removed from the cache.
+  cache.clear();
+  statistics = cache.statistics();
+  ASSERT_EQ(statistics.size, 0);
+  ASSERT_EQ(statistics.memoryUsage, 0);
+  ASSERT_EQ(result->getStatement(0)->type(), kStmtSelect);
+  ASSERT(cache.parse("SELECT * FROM students WHERE id = ?;") != result);
+}
+
+TEST(ParseCacheEvictionTest) {
+  // Each shard fits a single small result.
+  ParseCache cache(ParseCache::kNumShards * 8192);
+  std::vector<std::shared_ptr<const SQLParserResult>> results;
+  for (int i = 0; i < 200; ++i) {
+    results.push_back(cache.parse("SELECT " + std::to_string(i) + ";"));
+  }
+
+  ParseCacheStatistics statistics = cache.statistics();
+  ASSERT_EQ(statistics.misses, 200);
+  ASSERT(statistics.evictions > 0);
+  ASSERT_EQ(statistics.size + statistics.evictions, 200);
+  ASSERT(statistics.size <= ParseCache::kNumShards);
+  ASSERT(statistics.memoryUsage <= cache.memoryBudget());
+
+  // The most recent query of its shard is still cached.
+  ASSERT(cache.parse("SELECT 199;") == results.back());
+  ASSERT(results.front()->isValid());
+
+  // Results that exceed the budget of a shard are not cached.
+  std::string large = "SELECT 1";
+  for (int i = 0; i < 1000; ++i) large += " + 1";
+  std::shared_ptr<const SQLParserResult> result = cache.parse(large);
+  ASSERT(result->isValid());
+  ASSERT(cache.parse(large) != result);
+}
+
+TEST(ParseCacheConcurrencyTest) {
+  ParseCache cache(1 << 20);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&cache]() {
+      for (int i = 0; i < 1000; ++i) {
+        const std::string query = "SELECT a FROM t WHERE b = " + std::to_string(i % 50) + ";";
+        std::shared_ptr<const SQLParserResult> result = cache.parse(query);
+        if (!result->isValid() || result->size() != 1) abort();
+      }
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+
+  ParseCacheStatistics statistics = cache.statistics();
+  ASSERT_EQ(statistics.hits + statistics.misses, 4000);
+  ASSERT_EQ(statistics.size, 50);
+}
@@ -0,0 +1,147 @@
+#include "thirdparty/microtest/microtest.h"
+
+#include <atomic>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ParserService.h"
+
+using namespace hsql;
+
+namespace {
+
+// Blocks the worker that runs its callback until release() is called.
+class Gate {
+ public:
+  Gate() : released_(promise_.get_future().share()) {}
+
+  ParserService::Callback callback() {
+    std::shared_future<void> released = released_;
+    return [released](SQLParserResult&&) { released.wait(); };
+  }
+
+  void release() { promise_.set_value(); }
+
+ private:
+  std::promise<void> promise_;
+  std::shared_future<void> released_;
+};
+
+void waitForActive(const ParserService& service, size_t numActive) {
+  while (service.statistics().numActive != numActive) std::this_thread::yield();
+}
+
+}  // namespace
+
+TEST(ParserServiceFutureTest) {
+  ParserService service(2);
+  ASSERT_EQ(service.numThreads(), 2);
+  service.setLexer(kLexerSimd);
+
+  std::vector<std::future<SQLParserResult>> futures;
+  for (int i = 0; i < 100; ++i) {
+    futures.push_back(service.submit(i % 10 == 0 ? "SELECT * FROM;" : "SELECT a FROM t WHERE b = ?;"));
+  }
+  for (int i = 0; i < 100; ++i) {
+    SQLParserResult result = futures[i].get();
+    const bool isValid = i % 10 != 0;
+    ASSERT_EQ(result.isValid(), isValid);
+    if (result.isValid()) {
+      ASSERT_EQ(result.size(), 1);
+      ASSERT_EQ(result.parameters().size(), 1);
+    } else {
+      ASSERT_NOTNULL(result.errorMsg());
+    }
+  }
+
+  ParserServiceStatistics statistics = service.statistics();
+  ASSERT_EQ(statistics.submitted, 100);
+  ASSERT_EQ(statistics.completed, 100);
+  ASSERT_EQ(statistics.queueDepth, 0);
+  ASSERT_EQ(statistics.rejected, 0);
+}
+
+TEST(ParserServiceCallbackTest) {
+  ParserService service(2);
+  std::atomic<int> numValid(0);
+  for (int i = 0; i < 100; ++i) {
+    const ParseRequestId id = service.submit("INSERT INTO t VALUES (" + std::to_string(i) + ");",
+                                             [&numValid](SQLParserResult&& result) {
+                                               if (result.isValid()) ++numValid;
+                                             });
+    ASSERT(id != 0);
+  }
+  while (service.statistics().completed != 100) std::this_thread::yield();
+  ASSERT_EQ(numValid.load(), 100);
+}
+
+TEST(ParserServiceBackPressureTest) {
+  // At least two workers are started.
+  ParserService service(1, 2);
+  ASSERT_EQ(service.numThreads(), 2);
+  Gate gate;
+  ASSERT(service.submit("SELECT 1;", gate.callback()) != 0);
+  ASSERT(service.submit("SELECT 1;", gate.callback()) != 0);
+  waitForActive(service, 2);
+
+  // The workers are busy, so the queue fills up.
+  ParseRequestId first = 0;
+  ParseRequestId second = 0;
+  std::future<SQLParserResult> cancelled = service.submit("SELECT 2;", &first);
+  std::future<SQLParserResult> queued = service.submit("SELECT 3;", &second);
+  ParseRequestId rejectedId = 1;
+  std::future<SQLParserResult> rejected = service.submit("SELECT 4;", &rejectedId);
+  ASSERT(first != 0 && second != 0);
+  ASSERT_EQ(rejectedId, 0);
+  ASSERT_FALSE(rejected.get().isValid());
+
+  ParserServiceStatistics statistics = service.statistics();
+  ASSERT_EQ(statistics.queueDepth, 2);
+  ASSERT_EQ(statistics.peakQueueDepth, 2);
+  ASSERT_EQ(statistics.rejected, 1);
+
+  // Cancelled requests complete immediately.
+  ASSERT(service.cancel(first));
+  ASSERT_FALSE(service.cancel(first));
+  SQLParserResult result = cancelled.get();
+  ASSERT_FALSE(result.isValid());
+  ASSERT_STREQ(result.errorMsg(), "Parse request was cancelled.");
+  ASSERT_EQ(service.statistics().queueDepth, 1);
+
+  gate.release();
+  ASSERT(queued.get().isValid());
+  ASSERT_FALSE(service.cancel(second));
+
+  statistics = service.statistics();
+  ASSERT_EQ(statistics.submitted, 4);
+  ASSERT_EQ(statistics.completed, 3);
+  ASSERT_EQ(statistics.cancelled, 1);
+}
+
+TEST(ParserServiceLargeQueryTest) {
+  ParserService service(1);
+  std::string large = "SELECT a";
+  while (large.size() < ParserService::kLargeQuerySize) large += ", a";
+  large += " FROM t;";
+
+  // One worker parses a large query, the other one is kept for short queries.
+  Gate gate;
+  ASSERT(service.submit(large, gate.callback()) != 0);
+  waitForActive(service, 1);
+  std::future<SQLParserResult> queuedLarge = service.submit(large);
+  for (int i = 0; i < 10; ++i) ASSERT(service.submit("SELECT a FROM t;").get().isValid());
+  ASSERT_EQ(service.statistics().queueDepth, 1);
+
+  // Cancelled requests leave their queue, also behind the front.
+  ParseRequestId cancelledId = 0;
+  std::future<SQLParserResult> cancelled = service.submit(large, &cancelledId);
+  ASSERT(service.cancel(cancelledId));
+  ASSERT_FALSE(cancelled.get().isValid());
+  ASSERT_EQ(service.statistics().queueDepth, 1);
+
+  gate.release();
+  ASSERT(queuedLarge.get().isValid());
+  ASSERT_EQ(service.statistics().cancelled, 1);
+}
@@ -1,4 +1,5 @@
 
+#include "PreparedStatementRegistry.h"
 #include "SQLParser.h"
 #include "sql_asserts.h"
 #include "thirdparty/microtest/microtest.h"
@@ -82,3 +83,102 @@ TEST(ExecuteStatementTestNoParamList) {
   ASSERT_STREQ(stmt->name, "test");
   ASSERT_EQ(stmt->parameters, 0);
 }
+
+TEST(PreparedStatementRegistryTest) {
+  hsql::PreparedStatementRegistry registry;
+
+  TEST_PARSE_SINGLE_SQL("PREPARE ins FROM 'INSERT INTO students VALUES (?, ?, ?)';", kStmtPrepare, PrepareStatement,
+                        prepare_result, prepare);
+  std::shared_ptr<const hsql::PreparedQuery> query = registry.prepare(*prepare);
+  ASSERT(query->result().isValid());
+  ASSERT_STREQ(query->name(), "ins");
+  ASSERT_EQ(query->numParameters(), 3);
+  ASSERT_EQ(registry.size(), 1);
+  ASSERT(registry.find("ins") == query);
+  ASSERT_NULL(registry.find("other").get());
+
+  TEST_PARSE_SINGLE_SQL("EXECUTE ins(1, 'Max', 2.5);", kStmtExecute, ExecuteStatement, execute_result, execute);
+  hsql::BoundStatement bound;
+  ASSERT(registry.bind(*execute, &bound));
+  ASSERT(bound.query == query);
+  ASSERT_EQ(bound.statements().size(), 1);
+
+  // The parameters of the prepared statements resolve to the arguments of EXECUTE.
+  const InsertStatement* insert = (const InsertStatement*)bound.statements()[0];
+  ASSERT_EQ(insert->values->size(), 3);
+  ASSERT_EQ(bound.argument(insert->values->at(0))->ival, 1);
+  ASSERT_STREQ(bound.argument(insert->values->at(1))->name, "Max");
+  ASSERT_EQ(bound.argument(insert->values->at(2))->fval, 2.5);
+  for (const hsql::Expr* parameter : query->result().parameters()) {
+    ASSERT(bound.argument(parameter) == execute->parameters->at(parameter->ival));
+  }
+
+  // The number of arguments has to match. A failed bind keeps the previous arguments.
+  TEST_PARSE_SINGLE_SQL("EXECUTE ins(1, 'Max');", kStmtExecute, ExecuteStatement, short_result, short_execute);
+  ASSERT_FALSE(registry.bind(*short_execute, &bound));
+  ASSERT_EQ(bound.arguments.size(), 3);
+
+  // Parameters without an argument resolve to nullptr.
+  hsql::BoundStatement unbound;
+  unbound.query = query;
+  unbound.arguments.assign(short_execute->parameters->begin(), short_execute->parameters->end());
+  ASSERT_STREQ(unbound.argument(insert->values->at(1))->name, "Max");
+  ASSERT_NULL(unbound.argument(insert->values->at(2)));
+  ASSERT_NULL(unbound.argument(short_execute->parameters->at(0)));
+  TEST_PARSE_SINGLE_SQL("EXECUTE other(1);", kStmtExecute, ExecuteStatement, other_result, other_execute);
+  ASSERT_FALSE(registry.bind(*other_execute, &bound));
+
+  // Queries without parameters are executed without an argument list.
+  registry.prepare("list", "SELECT * FROM students;");
+  TEST_PARSE_SINGLE_SQL("EXECUTE list;", kStmtExecute, ExecuteStatement, all_result, all_execute);
+  ASSERT(registry.bind(*all_execute, &bound));
+  ASSERT_EQ(bound.arguments.size(), 0);
+  ASSERT_EQ(bound.statements()[0]->type(), kStmtSelect);
+
+  // Invalid queries are not registered and keep the previous query.
+  std::shared_ptr<const hsql::PreparedQuery> invalid = registry.prepare("ins", "INSERT INTO;");
+  ASSERT_FALSE(invalid->result().isValid());
+  ASSERT(registry.find("ins") == query);
+
+  ASSERT(registry.deallocate("ins"));
+  ASSERT_FALSE(registry.deallocate("ins"));
+  ASSERT_EQ(registry.size(), 1);
+
+  // Bound statements keep their query alive.
+  ASSERT_STREQ(bound.query->name(), "list");
+  ASSERT_EQ(query->numParameters(), 3);
+}
+
+TEST(ManyParametersTest) {
+  std::string query = "INSERT INTO test VALUES (?";
+  for (int i = 1; i < 10000; ++i) query += ", ?";
+  query += ");";
+
+  TEST_PARSE_SINGLE_SQL(query, kStmtInsert, InsertStatement, result, insert);
+  ASSERT_EQ(result.parameters().size(), 10000);
+  for (size_t i = 0; i < result.parameters().size(); ++i) {
+    ASSERT_EQ(result.parameters()[i]->ival, (int64_t)i);
+    ASSERT(result.parameters()[i] == insert->values->at(i));
+  }
+
+  // Parameters added out of order are kept ordered by their id.
+  hsql::SQLParserResult manual;
+  hsql::Expr* third = hsql::Expr::makeParameter(0);
+  third->ival = 2;
+  hsql::Expr* first = hsql::Expr::makeParameter(0);
+  first->ival = 0;
+  hsql::Expr* second = hsql::Expr::makeParameter(0);
+  second->ival = 1;
+  manual.addParameter(third);
+  manual.addParameter(first);
+  manual.addParameter(second);
+  ASSERT(manual.parameters()[0] == first);
+  ASSERT(manual.parameters()[1] == second);
+  ASSERT(manual.parameters()[2] == third);
+
+  manual.reset();
+  ASSERT_EQ(manual.parameters().size(), 0);
+  delete first;
+  delete second;
+  delete third;
+}
@@ -7,6 +7,8 @@
 !CREATE TABLE "table" FROM TBL FILE 'students.tbl';gibberish
 !CREATE TABLE "table" FROM TBL FILE 'students.tbl';1
 !INSERT INTO test_table VALUESd (1, 2, 'test');
+!INSERT INTO test_table VALUES (1, 2), (3);
+!INSERT INTO test_table VALUES (1, 2),;
 !SELECT * FROM t WHERE a = ? AND b = ?;gibberish;
 !SHOW COLUMNS;
 !DESCRIBE;
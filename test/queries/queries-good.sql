@@ -37,6 +37,9 @@ CREATE TABLE "table" FROM TBL FILE 'students.tbl'; SELECT * FROM "table";
 # INSERT
 INSERT INTO test_table VALUES (1, 2, 'test');
 INSERT INTO test_table (id, value, name) VALUES (1, 2, 'test');
+INSERT INTO test_table VALUES (1, 2, 'test', ?), (3, 4.5, NULL, ?), (5, 6, 'test', ?);
+INSERT INTO test_table (id, created) VALUES (1, DATE '2000-01-01'), (2, NULL), (3, DATE '2000-01-03');
+INSERT INTO test_table VALUES (1, 2), (3, 'test'), (TRUE, DATE '2000-01-01'), (NULL, ?);
 INSERT INTO test_table SELECT * FROM students;
 INSERT INTO some_schema.test_table SELECT * FROM another_schema.students;
 # DELETE
@@ -0,0 +1,214 @@
+#include "thirdparty/microtest/microtest.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "ResultSerializer.h"
+#include "SQLParser.h"
+
+using namespace hsql;
+
+namespace {
+
+// Serializes the result of the query, reads it back and checks that the copy serializes to the
+// same data, i.e. that it holds the same statements.
+void assertRoundTrip(const std::string& query) {
+  SQLParserResult result;
+  SQLParser::parse(query, &result);
+  std::string data;
+  ResultSerializer::serialize(result, &data);
+
+  SQLParserResult copy;
+  ASSERT(ResultSerializer::deserialize(data.data(), data.size(), &copy));
+  ASSERT(copy.usesArena());
+  ASSERT_EQ(copy.isValid(), result.isValid());
+  ASSERT_EQ(copy.size(), result.size());
+  ASSERT_EQ(copy.parameters().size(), result.parameters().size());
+  ASSERT_EQ(copy.errorLine(), result.errorLine());
+  ASSERT_EQ(copy.errorColumn(), result.errorColumn());
+
+  std::string copyData;
+  ResultSerializer::serialize(copy, &copyData);
+  ASSERT(copyData == data);
+}
+
+// Serializes a multi-row INSERT after corrupting its columns (integers, floats, strings and
+// parameters) and checks that the data is rejected.
+template <typename Corrupt>
+void assertCorruptValuesRejected(Corrupt corrupt) {
+  SQLParserResult result;
+  SQLParser::parse("INSERT INTO t VALUES (1, 1.5, 'a', ?), (2, 2.5, 'bc', ?);", &result);
+  InsertStatement* insert = static_cast<InsertStatement*>(result.getMutableStatement(0));
+  corrupt(&insert->rows->columns);
+  std::string data;
+  ResultSerializer::serialize(result, &data);
+
+  SQLParserResult copy;
+  ASSERT_FALSE(ResultSerializer::deserialize(data.data(), data.size(), &copy));
+  ASSERT_EQ(copy.size(), 0);
+}
+
+}  // namespace
+
+TEST(ResultSerializerQueryFileTest) {
+  DIR* directory = opendir("test/queries");
+  ASSERT_NOTNULL(directory);
+
+  size_t numFiles = 0;
+  while (dirent* entry = readdir(directory)) {
+    const std::string name = entry->d_name;
+    if (name.size() < 4 || name.substr(name.size() - 4) != ".sql") continue;
+
+    std::ifstream file("test/queries/" + name);
+    std::stringstream content;
+    content << file.rdbuf();
+    assertRoundTrip(content.str());
+
+    std::string line;
+    while (std::getline(content, line)) {
+      if (!line.empty() && line[0] != '#') assertRoundTrip(line[0] == '!' ? line.substr(1) : line);
+    }
+    ++numFiles;
+  }
+  closedir(directory);
+  ASSERT(numFiles > 0);
+}
+
+TEST(ResultSerializerTest) {
+  SQLParserResult result;
+  SQLParser::parse("SELECT name AS n FROM students WHERE grade > ? AND city IN ('Berlin', 'Potsdam');", &result);
+  std::string data;
+  ResultSerializer::serialize(result, &data);
+
+  // Strings point into the data.
+  SQLParserResult copy;
+  ASSERT(ResultSerializer::deserialize(data.data(), data.size(), &copy));
+  const SelectStatement* select = static_cast<const SelectStatement*>(copy.getStatement(0));
+  ASSERT_STREQ(select->selectList->at(0)->alias, "n");
+  ASSERT_STREQ(select->fromTable->name, "students");
+  const char* name = select->fromTable->name;
+  ASSERT(name > data.data() && name < data.data() + data.size());
+  ASSERT_EQ(select->whereClause->expr2->exprList->size(), 2);
+  ASSERT_EQ(copy.parameters().size(), 1);
+  ASSERT_EQ(copy.parameters()[0], select->whereClause->expr->expr2);
+
+  // Errors are kept.
+  result.reset();
+  SQLParser::parse("SELECT * FROM;", &result);
+  std::string error;
+  ResultSerializer::serialize(result, &error);
+  ASSERT(ResultSerializer::deserialize(error.data(), error.size(), &copy));
+  ASSERT_FALSE(copy.isValid());
+  ASSERT_STREQ(copy.errorMsg(), result.errorMsg());
+
+  // Truncated data, trailing data and other versions are rejected.
+  for (size_t size = 0; size < data.size(); ++size) {
+    ASSERT_FALSE(ResultSerializer::deserialize(data.data(), size, &copy));
+    ASSERT_EQ(copy.size(), 0);
+    ASSERT_FALSE(copy.isValid());
+  }
+  const std::string trailing = data + '\0';
+  ASSERT_FALSE(ResultSerializer::deserialize(trailing.data(), trailing.size(), &copy));
+  std::string otherVersion = data;
+  otherVersion[4] = static_cast<char>(ResultSerializer::kFormatVersion + 1);
+  ASSERT_FALSE(ResultSerializer::deserialize(otherVersion.data(), otherVersion.size(), &copy));
+}
+
+TEST(ResultSerializerNegativeZeroTest) {
+  SQLParserResult result;
+  SQLParser::parse("SELECT 0.0, 1.5 FROM t;", &result);
+  SelectStatement* select = static_cast<SelectStatement*>(result.getMutableStatement(0));
+  select->selectList->at(0)->fval = -0.0;
+  std::string data;
+  ResultSerializer::serialize(result, &data);
+
+  SQLParserResult copy;
+  ASSERT(ResultSerializer::deserialize(data.data(), data.size(), &copy));
+  const SelectStatement* copySelect = static_cast<const SelectStatement*>(copy.getStatement(0));
+  ASSERT_EQ(copySelect->selectList->at(0)->fval, 0.0);
+  ASSERT(signbit(copySelect->selectList->at(0)->fval));
+  ASSERT_EQ(copySelect->selectList->at(1)->fval, 1.5);
+}
+
+TEST(ResultSerializerCorruptExprListTest) {
+  // The lengths of the argument lists are the first difference between the data of the queries,
+  // which have the same length.
+  SQLParserResult result;
+  SQLParser::parse("SELECT f(bbb) FROM t;", &result);
+  std::string data;
+  ResultSerializer::serialize(result, &data);
+  result.reset();
+  SQLParser::parse("SELECT f(b,b) FROM t;", &result);
+  std::string other;
+  ResultSerializer::serialize(result, &other);
+  size_t position = 0;
+  while (data[position] == other[position]) ++position;
+  ASSERT_EQ(data[position], 1);
+  ASSERT_EQ(other[position], 2);
+
+  // A list that is marked as present but has the length of a missing one is rejected.
+  const uint32_t missing = UINT32_MAX;
+  memcpy(&data[position], &missing, sizeof(missing));
+  SQLParserResult copy;
+  ASSERT_FALSE(ResultSerializer::deserialize(data.data(), data.size(), &copy));
+  ASSERT_EQ(copy.size(), 0);
+  ASSERT_FALSE(copy.isValid());
+}
+
+TEST(ResultSerializerCorruptValuesTest) {
+  using Columns = std::vector<ValuesColumn>;
+  assertCorruptValuesRejected([](Columns* columns) { (*columns)[0].ints.pop_back(); });
+  assertCorruptValuesRejected([](Columns* columns) { (*columns)[1].floats.pop_back(); });
+  assertCorruptValuesRejected([](Columns* columns) { (*columns)[0].floats.push_back(1.5); });
+  assertCorruptValuesRejected([](Columns* columns) { (*columns)[2].offsets.pop_back(); });
+  assertCorruptValuesRejected([](Columns* columns) { (*columns)[2].offsets[1] = (*columns)[2].chars.size(); });
+  assertCorruptValuesRejected([](Columns* columns) { (*columns)[2].chars.back() = 'x'; });
+  assertCorruptValuesRejected([](Columns* columns) { (*columns)[3].exprs.push_back(nullptr); });
+  assertCorruptValuesRejected([](Columns* columns) { (*columns)[3].type = kExprLiteralString; });
+  assertCorruptValuesRejected([](Columns* columns) { (*columns)[0].type = kExprColumnRef; });
+}
+
+TEST(ResultSerializerMappedFileTest) {
+  SQLParserResult result;
+  SQLParser::parse("INSERT INTO t VALUES (1, 'a', NULL), (2, 'b', 1.5); UPDATE t SET a = ? WHERE b = 'a';", &result);
+  std::string data;
+  ResultSerializer::serialize(result, &data);
+
+  // A read-only mapping of a cache file at an unaligned offset.
+  char path[] = "/tmp/sqlparser_serializer_XXXXXX";
+  const int fd = mkstemp(path);
+  ASSERT(fd >= 0);
+  const std::string file = "x" + data;
+  ASSERT_EQ(write(fd, file.data(), file.size()), static_cast<ssize_t>(file.size()));
+  void* mapping = mmap(nullptr, file.size(), PROT_READ, MAP_SHARED, fd, 0);
+  ASSERT(mapping != MAP_FAILED);
+
+  SQLParserResult copy;
+  ASSERT(ResultSerializer::deserialize(static_cast<const char*>(mapping) + 1, data.size(), &copy));
+  ASSERT_EQ(copy.size(), 2);
+  const InsertStatement* insert = static_cast<const InsertStatement*>(copy.getStatement(0));
+  ASSERT_EQ(insert->rows->numRows, 2);
+  ASSERT_STREQ(insert->rows->columns[1].stringValue(1), "b");
+  ASSERT(insert->rows->columns[2].isNull(0));
+  ASSERT_EQ(insert->rows->columns[2].floatValue(1), 1.5);
+  ASSERT_EQ(copy.parameters().size(), 1);
+
+  copy.reset();
+  munmap(mapping, file.size());
+  close(fd);
+  unlink(path);
+}
+
+TEST(ResultSerializerDeepTest) {
+  std::string query = "SELECT * FROM t WHERE a";
+  for (int i = 0; i < 10000; ++i) query += " AND a";
+  assertRoundTrip(query);
+}
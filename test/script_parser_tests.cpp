@@ -0,0 +1,111 @@
+#include "thirdparty/microtest/microtest.h"
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "ScriptParser.h"
+#include "sql/statements.h"
+
+using namespace hsql;
+
+namespace {
+
+// Parses the script with the given chunk size and returns the offsets of its statements.
+std::vector<size_t> parseScript(const std::string& script, size_t chunkSize, std::vector<bool>* valid) {
+  ScriptParser parser(script.data(), script.size(), chunkSize);
+  SQLParserResult result;
+  std::vector<size_t> offsets;
+  while (parser.next(&result)) {
+    offsets.push_back(parser.offset());
+    valid->push_back(result.isValid() && result.size() == 1);
+  }
+  return offsets;
+}
+
+}  // namespace
+
+TEST(ScriptParserTest) {
+  const std::string script =
+      "SELECT 'a;b' FROM t;\n"
+      "-- comment; with semicolons\n"
+      "INSERT INTO t VALUES ('it''s; here', 1);;\n"
+      "SELECT \"x;y\" FROM t WHERE a = -1;\n"
+      "  ;  -- only a comment;\n"
+      "SELECT * FROM t";
+  const std::vector<size_t> expected = {0, 49, 91};
+
+  // Every chunk size splits some statement, string or comment.
+  for (size_t chunkSize = 1; chunkSize <= script.size() + 1; ++chunkSize) {
+    std::vector<bool> valid;
+    std::vector<size_t> offsets = parseScript(script, chunkSize, &valid);
+    ASSERT_EQ(offsets.size(), 4);
+    ASSERT(std::vector<size_t>(offsets.begin(), offsets.begin() + 3) == expected);
+    ASSERT_EQ(offsets[3], script.rfind("SELECT"));
+    ASSERT(valid == std::vector<bool>(4, true));
+  }
+
+  ScriptParser parser(script.data(), script.size(), 8);
+  SQLParserResult result;
+  ASSERT(parser.next(&result));
+  ASSERT_STREQ(((SelectStatement*)result.getStatement(0))->selectList->at(0)->name, "a;b");
+  ASSERT(parser.next(&result));
+  InsertStatement* insert = (InsertStatement*)result.getStatement(0);
+  ASSERT_STREQ(insert->values->at(0)->name, "it's; here");
+}
+
+TEST(ScriptParserErrorTest) {
+  // Invalid statements do not stop the script, their errors are relative to the statement.
+  const std::string script = "SELECT 1;\nSELECT * FROM;\n\nSELECT 2; --";
+  ScriptParser parser(script.data(), script.size(), 4);
+  SQLParserResult result;
+
+  ASSERT(parser.next(&result));
+  ASSERT(result.isValid());
+  ASSERT(parser.next(&result));
+  ASSERT_FALSE(result.isValid());
+  ASSERT_EQ(parser.offset(), 10);
+  ASSERT_EQ(result.errorLine(), 0);
+  ASSERT(parser.next(&result));
+  ASSERT(result.isValid());
+  ASSERT_EQ(parser.offset(), 26);
+  ASSERT_FALSE(parser.next(&result));
+  ASSERT_FALSE(parser.hasReadError());
+
+  // A trailing minus is a statement of its own.
+  const std::string minus = "SELECT 1; -";
+  ScriptParser minusParser(minus.data(), minus.size(), 1);
+  ASSERT(minusParser.next(&result));
+  ASSERT(minusParser.next(&result));
+  ASSERT_FALSE(result.isValid());
+  ASSERT_EQ(minusParser.offset(), 10);
+  ASSERT_FALSE(minusParser.next(&result));
+}
+
+TEST(ScriptParserFileTest) {
+  FILE* file = tmpfile();
+  ASSERT_NOTNULL(file);
+  std::string statement = "INSERT INTO t VALUES (1, 'abc;def');\n";
+  for (int i = 0; i < 10000; ++i) fputs(statement.c_str(), file);
+  fflush(file);
+  rewind(file);
+
+  // Only the current chunk and statement are buffered.
+  ScriptParser parser(fileno(file), 4096);
+  SQLParserResult result;
+  result.setUseArena(true);
+  size_t numStatements = 0;
+  while (parser.next(&result)) {
+    if (!result.isValid() || parser.offset() != numStatements * statement.size()) break;
+    ++numStatements;
+  }
+  ASSERT_EQ(numStatements, 10000);
+  ASSERT_FALSE(parser.hasReadError());
+  ASSERT(parser.bufferCapacity() < 2 * (4096 + statement.size()));
+  const int fd = fileno(file);
+  fclose(file);
+
+  ScriptParser invalid(fd, 4096);
+  ASSERT_FALSE(invalid.next(&result));
+  ASSERT(invalid.hasReadError());
+}
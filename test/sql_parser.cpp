@@ -25,6 +25,17 @@ TEST(SQLParserTokenizeTest) {
   test_tokens("SELECT * FROM test;", {SQL_SELECT, '*', SQL_FROM, SQL_IDENTIFIER, ';'});
   test_tokens("SELECT a, 'b' FROM test WITH HINT;",
               {SQL_SELECT, SQL_IDENTIFIER, ',', SQL_STRING, SQL_FROM, SQL_IDENTIFIER, SQL_WITH, SQL_HINT, ';'});
+  // Comments end at the first newline, even if whitespace follows it.
+  test_tokens("SELECT a --\n  FROM test", {SQL_SELECT, SQL_IDENTIFIER, SQL_FROM, SQL_IDENTIFIER});
+}
+
+TEST(SQLParserTokenizeKeywordTest) {
+  // Keywords are case-insensitive, identifiers that only start or end with a keyword are not keywords.
+  test_tokens("select Distinct tRaNsAcTiOn DEALLOCATE", {SQL_SELECT, SQL_DISTINCT, SQL_TRANSACTION, SQL_DEALLOCATE});
+  test_tokens("selects xselect select_ select1 selec", {SQL_IDENTIFIER, SQL_IDENTIFIER, SQL_IDENTIFIER,
+                                                         SQL_IDENTIFIER, SQL_IDENTIFIER});
+  test_tokens("transactions is_ isnull", {SQL_IDENTIFIER, SQL_IDENTIFIER, SQL_ISNULL});
+  test_tokens("character varying", {SQL_CHARACTER_VARYING});
 }
 
 TEST(SQLParserTokenizeStringifyTest) {
@@ -42,3 +53,174 @@ TEST(SQLParserTokenizeStringifyTest) {
   ASSERT(query == cache[token_string]);
   ASSERT(&query != &cache[token_string]);
 }
+
+TEST(ParserContextReuseTest) {
+  ParserContext context;
+  ASSERT(context.isValid());
+
+  const SQLParserResult& result = context.parse("SELECT * FROM test WHERE id = ?;");
+  ASSERT(result.isValid());
+  ASSERT_EQ(result.size(), 1);
+  ASSERT_EQ(context.result().parameters().size(), 1);
+
+  // A failed parse must not leave state behind for the next one.
+  context.parse("SELECT 'unterminated");
+  ASSERT_FALSE(result.isValid());
+  context.parse("SELECT a FROM t -- trailing comment");
+  ASSERT(result.isValid());
+
+  context.parse("SELECT name FROM students; UPDATE students SET grade = 1.0 WHERE id = ?;");
+  ASSERT(result.isValid());
+  ASSERT_EQ(result.size(), 2);
+  ASSERT_EQ(result.getStatement(1)->type(), kStmtUpdate);
+  ASSERT_EQ(context.result().parameters().size(), 1);
+
+  // Shorter input after a longer one reuses the buffer.
+  context.parse("SELECT 1;");
+  ASSERT(result.isValid());
+  ASSERT_EQ(result.size(), 1);
+
+  context.result().setUseArena(true);
+  context.parse("SELECT a, b FROM t WHERE c > 2;");
+  ASSERT(result.isValid());
+  ASSERT(result.usesArena());
+
+  SQLParserResult external;
+  ASSERT(context.parse("DELETE FROM t;", &external));
+  ASSERT(external.isValid());
+  ASSERT_EQ(external.getStatement(0)->type(), kStmtDelete);
+
+  std::vector<int16_t> tokens;
+  ASSERT(context.tokenize("SELECT * FROM test;", &tokens));
+  ASSERT_EQ(tokens.size(), 5);
+}
+
+TEST(ParserContextLexerTest) {
+  const std::string query = "SELECT name, 'it''s' FROM students -- comment\nWHERE id = ? AND grade >= 1.5;";
+
+  ParserContext flex_context;
+  ASSERT_EQ(flex_context.lexer(), kLexerFlex);
+  std::vector<int16_t> flex_tokens;
+  ASSERT(flex_context.tokenize(query, &flex_tokens));
+  const SQLParserResult& flex_error = flex_context.parse("SELECT * FROM\n  test WHERE;");
+  ASSERT_FALSE(flex_error.isValid());
+
+  for (LexerType lexer : {kLexerSimd, kLexerScalar}) {
+    ParserContext context;
+    context.setLexer(lexer);
+    ASSERT_EQ(context.lexer(), lexer);
+
+    std::vector<int16_t> tokens;
+    ASSERT(context.tokenize(query, &tokens));
+    ASSERT(tokens == flex_tokens);
+
+    const SQLParserResult& result = context.parse(query);
+    ASSERT(result.isValid());
+    ASSERT_EQ(context.result().parameters().size(), 1);
+    ASSERT_EQ(context.result().getStatement(0)->stringLength, query.size());
+
+    context.parse("SELECT * FROM\n  test WHERE;");
+    ASSERT_FALSE(result.isValid());
+    ASSERT_EQ(result.errorLine(), flex_error.errorLine());
+    ASSERT_EQ(result.errorColumn(), flex_error.errorColumn());
+  }
+}
+
+TEST(TokenStreamTest) {
+  const std::string query = "SELECT \"a b\", 'it''s', 42 FROM t WHERE x >= 1.5;";
+  TokenStream tokens;
+  ASSERT(SQLParser::tokenize(query, &tokens));
+  ASSERT(tokens.isComplete());
+
+  const std::vector<int16_t> expected_kinds = {SQL_SELECT, SQL_IDENTIFIER, ',', SQL_STRING,     ',',
+                                               SQL_INTVAL, SQL_FROM,       SQL_IDENTIFIER, SQL_WHERE,
+                                               SQL_IDENTIFIER, SQL_GREATEREQ, SQL_FLOATVAL, ';'};
+  const std::vector<std::string> expected_texts = {"SELECT", "\"a b\"", ",", "'it''s'", ",", "42", "FROM",
+                                                   "t",      "WHERE",   "x", ">=",      "1.5", ";"};
+  ASSERT_EQ(tokens.size(), expected_kinds.size());
+  ASSERT_EQ(tokens.offsets().size(), tokens.size());
+  ASSERT_EQ(tokens.lengths().size(), tokens.size());
+  ASSERT_EQ(tokens.values().size(), tokens.size());
+  for (size_t i = 0; i < tokens.size(); ++i) {
+    ASSERT_EQ(tokens.kinds()[i], expected_kinds[i]);
+    ASSERT_EQ(query.substr(tokens.offsets()[i], tokens.lengths()[i]), expected_texts[i]);
+  }
+  ASSERT_EQ(tokens.values()[5].ival, 42);
+  ASSERT_EQ(tokens.values()[11].fval, 1.5);
+  ASSERT_EQ(tokens.values()[0].ival, 0);
+
+  // The stream keeps its buffers when it is reused.
+  const int16_t* kinds = tokens.kinds().data();
+  ASSERT(SQLParser::tokenize("SELECT 1;", &tokens));
+  ASSERT_EQ(tokens.size(), 3);
+  ASSERT_EQ(tokens.kinds().data(), kinds);
+
+  // The stream contains the tokens in front of an invalid character.
+  ParserContext context;
+  ASSERT(context.tokenize("SELECT a $ b", &tokens));
+  ASSERT_FALSE(tokens.isComplete());
+  ASSERT_EQ(tokens.size(), 2);
+  ASSERT(context.tokenize("SELECT 'unterminated", &tokens));
+  ASSERT_FALSE(tokens.isComplete());
+  ASSERT_EQ(tokens.size(), 1);
+  ASSERT(context.tokenize("SELECT 99999999999999999999 FROM t", &tokens));
+  ASSERT_FALSE(tokens.isComplete());
+  ASSERT_EQ(tokens.size(), 1);
+  ASSERT(context.tokenize("", &tokens));
+  ASSERT(tokens.isComplete());
+  ASSERT_EQ(tokens.size(), 0);
+}
+
+TEST(SQLInputBufferTest) {
+  const std::string query = "SELECT name, 'it''s' FROM students WHERE grade > 2.0;";
+  SQLInputBuffer input(query);
+  ASSERT_EQ(input.size(), query.size());
+  ASSERT_EQ(input.data()[input.size()], '\0');
+  ASSERT_EQ(input.data()[input.size() + 1], '\0');
+
+  SQLParserResult result;
+  ASSERT(SQLParser::parse(input, &result));
+  ASSERT(result.isValid());
+  ASSERT_EQ(result.size(), 1);
+
+  // The lexer restores the buffer after scanning.
+  ASSERT_EQ(std::string(input.data(), input.size()), query);
+
+  // Growing keeps the content and moves the padding.
+  input.resize(query.size() + 10);
+  ASSERT_EQ(std::string(input.data(), query.size()), query);
+  ASSERT_EQ(input.data()[input.size()], '\0');
+
+  // Shrinking the query to its first statement.
+  input.resize(query.size() - 1);
+  result.reset();
+  ParserContext context;
+  ASSERT(context.parse(input, &result));
+  ASSERT(result.isValid());
+
+  SQLInputBuffer file;
+  ASSERT(file.readFile("test/queries/tpc-h-01.sql"));
+  ASSERT(file.size() > 0);
+  result.reset();
+  ASSERT(SQLParser::parse(file, &result));
+  ASSERT(result.isValid());
+  ASSERT_EQ(result.size(), 1);
+
+  ASSERT_FALSE(file.readFile("test/queries/does-not-exist.sql"));
+  ASSERT_EQ(file.size(), 0);
+}
+
+TEST(ParseCallerBufferTest) {
+  char buffer[] = "SELECT * FROM test;\0";
+  const size_t length = sizeof(buffer) - 2;
+  SQLParserResult result;
+  ASSERT(SQLParser::parse(buffer, length, &result));
+  ASSERT(result.isValid());
+  ASSERT_STREQ(((const SelectStatement*)result.getStatement(0))->fromTable->name, "test");
+
+  // Without the padding the buffer can not be scanned in place.
+  char unpadded[] = "SELECT * FROM test;";
+  result.reset();
+  ASSERT_FALSE(SQLParser::parse(unpadded, sizeof(unpadded) - 2, &result));
+  ASSERT_FALSE(result.isValid());
+}
@@ -4,7 +4,15 @@
 
 #include "thirdparty/microtest/microtest.h"
 
+#include <string.h>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "ParserContext.h"
 #include "SQLParser.h"
+#include "util/LineIndex.h"
 #include "util/sqlhelper.h"
 
 #include "sql_asserts.h"
@@ -211,6 +219,153 @@ TEST(InsertStatementTest) {
   // TODO
 }
 
+TEST(InsertMultipleRowsTest) {
+  TEST_PARSE_SINGLE_SQL(
+      "INSERT INTO students (name, id, grade, active, birthday, note) VALUES "
+      "('Max', 1, 2, TRUE, DATE '2000-01-31', ?), (NULL, 2, 1.5, FALSE, NULL, ?), ('Erika', NULL, NULL, NULL, "
+      "DATE '2001-12-01', ?);",
+      kStmtInsert, InsertStatement, result, stmt);
+
+  ASSERT_EQ(stmt->type, kInsertValues);
+  ASSERT_NULL(stmt->values);
+  ASSERT_NOTNULL(stmt->rows);
+  ASSERT_EQ(stmt->rows->numRows, 3);
+  ASSERT_EQ(stmt->rows->columns.size(), 6);
+
+  const ValuesColumn& name = stmt->rows->columns[0];
+  ASSERT_EQ(name.type, kExprLiteralString);
+  ASSERT_EQ(name.size, 3);
+  ASSERT_STREQ(name.stringValue(0), "Max");
+  ASSERT(name.isNull(1));
+  ASSERT_STREQ(name.stringValue(1), "");
+  ASSERT_STREQ(name.stringValue(2), "Erika");
+
+  const ValuesColumn& id = stmt->rows->columns[1];
+  ASSERT_EQ(id.type, kExprLiteralInt);
+  ASSERT_FALSE(id.isBool);
+  ASSERT_EQ(id.intValue(0), 1);
+  ASSERT_EQ(id.intValue(1), 2);
+  ASSERT_FALSE(id.isNull(1));
+  ASSERT(id.isNull(2));
+
+  // Integers and floats are different types, so the values are kept as expressions.
+  const ValuesColumn& grade = stmt->rows->columns[2];
+  ASSERT_EQ(grade.type, kExprLiteralInt);
+  ASSERT(grade.hasMixedTypes);
+  ASSERT(grade.ints.empty());
+  ASSERT_EQ(grade.exprValue(0)->type, kExprLiteralInt);
+  ASSERT_EQ(grade.exprValue(0)->ival, 2);
+  ASSERT_EQ(grade.exprValue(1)->type, kExprLiteralFloat);
+  ASSERT_EQ(grade.exprValue(1)->fval, 1.5);
+  ASSERT(grade.isNull(2));
+  ASSERT_NULL(grade.exprValue(2));
+
+  const ValuesColumn& active = stmt->rows->columns[3];
+  ASSERT_EQ(active.type, kExprLiteralInt);
+  ASSERT(active.isBool);
+  ASSERT_EQ(active.intValue(0), 1);
+  ASSERT_EQ(active.intValue(1), 0);
+
+  const ValuesColumn& birthday = stmt->rows->columns[4];
+  ASSERT_EQ(birthday.type, kExprLiteralDate);
+  ASSERT_STREQ(birthday.stringValue(0), "2000-01-31");
+  ASSERT(birthday.isNull(1));
+  ASSERT_STREQ(birthday.stringValue(2), "2001-12-01");
+
+  // Parameters are numbered in query order.
+  const ValuesColumn& note = stmt->rows->columns[5];
+  ASSERT_EQ(note.type, kExprParameter);
+  ASSERT_EQ(result.parameters().size(), 3);
+  for (int64_t row = 0; row < 3; ++row) {
+    ASSERT(note.exprValue(row) == result.parameters()[row]);
+    ASSERT_EQ(note.exprValue(row)->ival, row);
+  }
+}
+
+TEST(InsertMultipleRowsFirstValueTest) {
+  // Columns that are NULL in the first row take their type from a later value.
+  TEST_PARSE_SINGLE_SQL("INSERT INTO test VALUES (NULL, NULL, NULL, NULL), ('a', 1.5, ?, TRUE), (NULL, 2, ?, NULL);",
+                        kStmtInsert, InsertStatement, result, stmt);
+  const std::vector<ValuesColumn>& columns = stmt->rows->columns;
+  ASSERT_EQ(columns[0].type, kExprLiteralString);
+  ASSERT_FALSE(columns[0].isBool);
+  ASSERT_EQ(columns[1].type, kExprLiteralFloat);
+  ASSERT_FALSE(columns[1].isBool);
+  ASSERT(columns[1].hasMixedTypes);
+  ASSERT_EQ(columns[2].type, kExprParameter);
+  ASSERT_FALSE(columns[2].isBool);
+  ASSERT_EQ(columns[3].type, kExprLiteralInt);
+  ASSERT(columns[3].isBool);
+  ASSERT_FALSE(columns[3].hasMixedTypes);
+}
+
+TEST(InsertMultipleRowsMixedTypesTest) {
+  // Values of different types are neither converted nor rejected.
+  TEST_PARSE_SINGLE_SQL(
+      "INSERT INTO test VALUES (9007199254740993, 1, ?, 'a', 1), (1.5, '2', 1, DATE '2000-01-01', TRUE), "
+      "(NULL, NULL, NULL, NULL, NULL);",
+      kStmtInsert, InsertStatement, result, stmt);
+  const std::vector<ValuesColumn>& columns = stmt->rows->columns;
+  for (const ValuesColumn& column : columns) {
+    ASSERT(column.hasMixedTypes);
+    ASSERT(column.hasExpressions());
+    ASSERT_FALSE(column.isBool);
+    ASSERT_EQ(column.exprs.size(), 3);
+    ASSERT(column.isNull(2));
+    ASSERT_NULL(column.exprValue(2));
+  }
+
+  ASSERT_EQ(columns[0].type, kExprLiteralInt);
+  ASSERT_EQ(columns[0].exprValue(0)->ival, 9007199254740993);
+  ASSERT_EQ(columns[0].exprValue(1)->fval, 1.5);
+  ASSERT_STREQ(columns[1].exprValue(1)->name, "2");
+  ASSERT_EQ(columns[2].exprValue(0)->type, kExprParameter);
+  ASSERT(columns[2].exprValue(0) == result.parameters()[0]);
+  ASSERT_EQ(columns[2].exprValue(1)->ival, 1);
+  ASSERT_EQ(columns[3].exprValue(0)->type, kExprLiteralString);
+  ASSERT_EQ(columns[3].exprValue(1)->type, kExprLiteralDate);
+  ASSERT_STREQ(columns[3].exprValue(1)->name, "2000-01-01");
+  ASSERT_FALSE(columns[4].exprValue(0)->isBoolLiteral);
+  ASSERT(columns[4].exprValue(1)->isBoolLiteral);
+  ASSERT_EQ(columns[4].exprValue(1)->ival, 1);
+}
+
+TEST(InsertMultipleRowsNullBitmapTest) {
+  std::string query = "INSERT INTO test VALUES (NULL)";
+  for (int i = 1; i < 200; ++i) {
+    query += i % 3 == 0 ? ", (" + std::to_string(i) + ")" : ", (NULL)";
+  }
+
+  TEST_PARSE_SINGLE_SQL(query, kStmtInsert, InsertStatement, result, stmt);
+  const ValuesColumn& column = stmt->rows->columns[0];
+  ASSERT_EQ(column.type, kExprLiteralInt);
+  ASSERT_EQ(column.nulls.size(), 4);
+  ASSERT_EQ(column.ints.size(), 200);
+  for (int i = 0; i < 200; ++i) {
+    const bool isNull = i % 3 != 0 || i == 0;
+    ASSERT_EQ(column.isNull(i), isNull);
+    const int64_t value = isNull ? 0 : i;
+    ASSERT_EQ(column.intValue(i), value);
+  }
+}
+
+TEST(InsertMultipleRowsErrorTest) {
+  SQLParserResult result;
+  SQLParser::parse("INSERT INTO test VALUES (1, 'a'), (2);", &result);
+  ASSERT_FALSE(result.isValid());
+  ASSERT_STREQ(result.errorMsg(), "VALUES lists must all be the same length.");
+  ASSERT_EQ(result.errorColumn(), 36);
+
+  result.reset();
+  SQLParser::parse("INSERT INTO test VALUES (1, 'a'), (2, 'b', ?);", &result);
+  ASSERT_FALSE(result.isValid());
+  ASSERT_STREQ(result.errorMsg(), "VALUES lists must all be the same length.");
+
+  result.reset();
+  SQLParser::parse("INSERT INTO test VALUES (1), (DATE '2000-13');", &result);
+  ASSERT_FALSE(result.isValid());
+}
+
 TEST(AlterStatementDropActionTest) {
   SQLParserResult result;
   SQLParser::parse("ALTER TABLE mytable DROP COLUMN IF EXISTS mycolumn", &result);
@@ -616,4 +771,281 @@ TEST(CastAsType) {
   ASSERT_EQ(stmt->selectList->front()->columnType.length, 8);
 }
 
+TEST(ErrorLocationTest) {
+  SQLParserResult result;
+  SQLParser::parse("SELECT 'multi\nline' FROM\n\n t WHERE;", &result);
+  ASSERT_FALSE(result.isValid());
+  ASSERT_EQ(result.errorLine(), 3);
+  ASSERT_EQ(result.errorColumn(), 8);
+
+  result.reset();
+  SQLParser::parse("SELECT * FROM t;\nSELECT ? FROM;", &result);
+  ASSERT_FALSE(result.isValid());
+  ASSERT_EQ(result.errorLine(), 1);
+  ASSERT_EQ(result.errorColumn(), 13);
+
+  LineIndex lines("a\nbc\n\nd", 7);
+  ASSERT_EQ(lines.numLines(), 4u);
+  ASSERT_EQ(lines.line(0), 0);
+  ASSERT_EQ(lines.line(1), 0);
+  ASSERT_EQ(lines.line(3), 1);
+  ASSERT_EQ(lines.column(3), 1);
+  ASSERT_EQ(lines.line(5), 2);
+  ASSERT_EQ(lines.line(6), 3);
+  ASSERT_EQ(lines.column(6), 0);
+}
+
+TEST(DeepExpressionTest) {
+  // Deleting and printing deep trees must not recurse once per level.
+  Expr* leftDeep = Expr::makeColumnRef(strdup("a"));
+  Expr* rightDeep = Expr::makeColumnRef(strdup("a"));
+  for (int i = 0; i < 1000000; ++i) {
+    leftDeep = Expr::makeOpBinary(leftDeep, kOpAnd, Expr::makeColumnRef(strdup("a")));
+    rightDeep = Expr::makeOpBinary(Expr::makeLiteral(static_cast<int64_t>(i)), kOpOr, rightDeep);
+  }
+  delete leftDeep;
+  delete rightDeep;
+
+  SQLParserResult result;
+  std::string query = "SELECT * FROM t WHERE a";
+  for (int i = 0; i < 2000; ++i) query += " AND a";
+  SQLParser::parse(query, &result);
+  ASSERT(result.isValid());
+
+  std::stringstream output;
+  std::streambuf* previous = std::cout.rdbuf(output.rdbuf());
+  printExpression(static_cast<const SelectStatement*>(result.getStatement(0))->whereClause, 0);
+  std::cout.rdbuf(previous);
+
+  size_t numLines = 0;
+  for (std::string line; std::getline(output, line);) ++numLines;
+  ASSERT_EQ(numLines, 2 * 2000 + 1);
+}
+
+TEST(PrintExpressionTest) {
+  SQLParserResult result;
+  SQLParser::parse("SELECT -x[1] AS y, f(a, CAST(b AS INT)) FROM t;", &result);
+  ASSERT(result.isValid());
+
+  std::stringstream output;
+  std::streambuf* previous = std::cout.rdbuf(output.rdbuf());
+  for (Expr* expr : *static_cast<const SelectStatement*>(result.getStatement(0))->selectList) printExpression(expr, 0);
+  std::cout.rdbuf(previous);
+
+  // Operands are printed in order and indented below their expression, the alias follows them.
+  ASSERT_STREQ(output.str(), "-\n\t\tx\n\t1  \n\tAlias\n\t\ty\nf\n\ta\n\tCAST\n\t\tINT\n\t\tb\n");
+}
+
+TEST(FlatLogicalOperatorTest) {
+  const std::string query = "SELECT * FROM t WHERE a AND b AND (c AND d) AND (e OR f OR g) AND x IN (1, 2);";
+  ParserContext context;
+  ASSERT_FALSE(context.flattensLogicalOperators());
+  context.setFlattenLogicalOperators(true);
+
+  for (bool useArena : {false, true}) {
+    SQLParserResult result;
+    result.setUseArena(useArena);
+    context.parse(query, &result);
+    ASSERT(result.isValid());
+
+    // Nested chains of the same operator are merged, other operators stay separate nodes.
+    const Expr* where = static_cast<const SelectStatement*>(result.getStatement(0))->whereClause;
+    ASSERT(where->isNaryOperator(kOpAnd));
+    ASSERT_NULL(where->expr);
+    ASSERT_EQ(where->exprList->size(), 6);
+    ASSERT_STREQ(where->exprList->at(0)->name, "a");
+    ASSERT_STREQ(where->exprList->at(3)->name, "d");
+    const Expr* disjunction = where->exprList->at(4);
+    ASSERT(disjunction->isNaryOperator(kOpOr));
+    ASSERT_EQ(disjunction->exprList->size(), 3);
+    ASSERT_STREQ(disjunction->exprList->at(2)->name, "g");
+    ASSERT_EQ(where->exprList->at(5)->opType, kOpIn);
+    ASSERT_FALSE(where->exprList->at(5)->isNaryOperator(kOpIn));
+
+    result.reset();
+    context.parse("SELECT * FROM t WHERE a AND b OR;", &result);
+    ASSERT_FALSE(result.isValid());
+  }
+
+  // By default, the chain is a tree of binary nodes.
+  SQLParserResult result;
+  SQLParser::parse(query, &result);
+  const Expr* where = static_cast<const SelectStatement*>(result.getStatement(0))->whereClause;
+  ASSERT_FALSE(where->isNaryOperator(kOpAnd));
+  ASSERT_EQ(where->opType, kOpAnd);
+  ASSERT_NOTNULL(where->expr2);
+}
+
+TEST(ArenaResultTest) {
+  SQLParserResult result;
+  result.setUseArena(true);
+  ASSERT(result.usesArena());
+
+  SQLParser::parse("SELECT a AS x, 'str' FROM t JOIN u USING (id) WHERE b IN (1, 2) AND c = ?;", &result);
+  ASSERT(result.isValid());
+  ASSERT_EQ(result.size(), 1);
+  ASSERT_EQ(result.parameters().size(), 1);
+
+  const SelectStatement* stmt = (const SelectStatement*)result.getStatement(0);
+  ASSERT_STREQ(stmt->selectList->at(0)->name, "a");
+  ASSERT_STREQ(stmt->selectList->at(0)->alias, "x");
+  ASSERT_STREQ(stmt->selectList->at(1)->name, "str");
+  ASSERT_STREQ(stmt->fromTable->join->condition->expr->table, "t");
+  ASSERT_EQ(stmt->whereClause->expr->exprList->size(), 2);
+
+  Arena* arena = result.arena();
+  ASSERT(arena->owns(stmt));
+  ASSERT(arena->owns(stmt->selectList->at(0)->name));
+  ASSERT(arena->bytesUsed() > 0);
+
+  // Reparsing into the same result reuses the arena.
+  result.reset();
+  ASSERT_EQ(arena->bytesUsed(), 0u);
+  SQLParser::parse("SELECT * FROM students WHERE grade > 2.0 GROUP BY name;", &result);
+  ASSERT(result.isValid());
+  ASSERT_EQ(result.arena(), arena);
+
+  // Errors are reported as usual, partially built nodes are released with the arena.
+  result.reset();
+  SQLParser::parse("SELECT * FROM t WHERE a = 'x' AND;", &result);
+  ASSERT_FALSE(result.isValid());
+  ASSERT_NOTNULL(result.errorMsg());
+
+  result.setUseArena(false);
+  ASSERT_FALSE(result.usesArena());
+  ASSERT_NULL(result.arena());
+}
+
+TEST(ArenaReleaseTest) {
+  std::unique_ptr<Arena> arena;
+  const SelectStatement* stmt;
+  {
+    SQLParserResult result;
+    result.setUseArena(true);
+    SQLParser::parse("SELECT name FROM students WHERE id = ?;", &result);
+    ASSERT(result.isValid());
+
+    // The statements belong to the arena, so they cannot be released on their own.
+    ASSERT(result.releaseStatements().empty());
+    ASSERT_EQ(result.size(), 1);
+
+    stmt = static_cast<const SelectStatement*>(result.getStatement(0));
+    arena = result.releaseArena();
+    ASSERT_NOTNULL(arena.get());
+    ASSERT(arena->owns(stmt));
+    ASSERT_EQ(result.size(), 0);
+    ASSERT(result.parameters().empty());
+    ASSERT_FALSE(result.usesArena());
+
+    // Results without an arena have none to release.
+    ASSERT_NULL(result.releaseArena().get());
+  }
+
+  // The statements outlive the result.
+  ASSERT_STREQ(stmt->selectList->at(0)->name, "name");
+  ASSERT_STREQ(stmt->fromTable->name, "students");
+}
+
+TEST(ArenaSharedTest) {
+  Arena arena;
+  {
+    // Results without an arena allocate from the heap, also within a scope.
+    ArenaScope scope(&arena);
+    SQLParserResult result;
+    SQLParser::parse("SELECT a FROM t;", &result);
+    ASSERT(result.isValid());
+    ASSERT_FALSE(arena.owns(result.getStatement(0)));
+    ASSERT_EQ(arena.bytesUsed(), 0u);
+  }
+
+  // Results can share an arena that they do not own.
+  SQLParserResult first;
+  SQLParserResult second;
+  first.setArena(&arena);
+  second.setArena(&arena);
+  SQLParser::parse("SELECT a FROM t;", &first);
+  SQLParser::parse("SELECT b FROM u;", &second);
+  ASSERT(first.usesArena());
+  ASSERT_EQ(first.arena(), &arena);
+  ASSERT(arena.owns(first.getStatement(0)));
+  ASSERT(arena.owns(second.getStatement(0)));
+
+  // Resetting a result leaves the memory to the arena, so the other result stays intact.
+  const size_t bytesUsed = arena.bytesUsed();
+  first.reset();
+  ASSERT_EQ(arena.bytesUsed(), bytesUsed);
+  ASSERT_STREQ(static_cast<const SelectStatement*>(second.getStatement(0))->fromTable->name, "u");
+  ASSERT_NULL(second.releaseArena().get());
+  ASSERT_EQ(second.size(), 1);
+
+  second.setArena(nullptr);
+  ASSERT_FALSE(second.usesArena());
+  arena.reset();
+}
+
+TEST(ArenaStringSliceTest) {
+  SQLParserResult result;
+  result.setUseArena(true);
+
+  SQLParser::parse("SELECT \"col\"a, 'it''s', '', 'plain'||'x' FROM t1\"t2\" WHERE name='a''''b';", &result);
+  ASSERT(result.isValid());
+
+  const SelectStatement* stmt = (const SelectStatement*)result.getStatement(0);
+  ASSERT_EQ(stmt->selectList->size(), 4);
+  ASSERT_STREQ(stmt->selectList->at(0)->name, "col");
+  ASSERT_STREQ(stmt->selectList->at(0)->alias, "a");
+  ASSERT_STREQ(stmt->selectList->at(1)->name, "it's");
+  ASSERT_STREQ(stmt->selectList->at(2)->name, "");
+  ASSERT_STREQ(stmt->selectList->at(3)->expr->name, "plain");
+  ASSERT_STREQ(stmt->selectList->at(3)->expr2->name, "x");
+  ASSERT_STREQ(stmt->fromTable->name, "t1");
+  ASSERT_STREQ(stmt->fromTable->alias->name, "t2");
+  ASSERT_STREQ(stmt->whereClause->expr2->name, "a''b");
+
+  // Strings are part of the result's arena.
+  ASSERT(result.arena()->owns(stmt->selectList->at(1)->name));
+  ASSERT(result.arena()->owns(stmt->fromTable->name));
+}
+
+TEST(ArenaBlockTest) {
+  Arena arena(64);
+  void* small = arena.allocate(8);
+  ASSERT(arena.owns(small));
+
+  // Allocations larger than a block get a dedicated one.
+  char* large = arena.copyString(std::string(1000, 'x').c_str(), 1000);
+  ASSERT(arena.owns(large));
+  ASSERT_EQ(std::string(large), std::string(1000, 'x'));
+
+  std::vector<int>* list = arena.create<std::vector<int>>(100, 1);
+  ASSERT_EQ(list->size(), 100u);
+  ASSERT(arena.bytesReserved() >= arena.bytesUsed());
+
+  arena.reset();
+  ASSERT_EQ(arena.bytesUsed(), 0u);
+  ASSERT_FALSE(arena.owns(large));
+}
+
+TEST(ArenaSpliceTest) {
+  Arena arena(64);
+  Arena other(64);
+  std::shared_ptr<int> counter = std::make_shared<int>(0);
+  std::shared_ptr<int>* list = other.create<std::shared_ptr<int>>(counter);
+  char* string = other.copyString("spliced", 7);
+  const size_t bytesReserved = arena.bytesReserved() + other.bytesReserved();
+
+  arena.splice(&other);
+  ASSERT(arena.owns(list));
+  ASSERT(arena.owns(string));
+  ASSERT_FALSE(other.owns(string));
+  ASSERT_EQ(arena.bytesReserved(), bytesReserved);
+  ASSERT_EQ(other.bytesReserved(), 0u);
+  ASSERT_STREQ(string, "spliced");
+
+  // The destructors of other are run by arena.
+  ASSERT_EQ(counter.use_count(), 2);
+  arena.reset();
+  ASSERT_EQ(counter.use_count(), 1);
+}
+
 TEST_MAIN();
@@ -0,0 +1,145 @@
+#include "thirdparty/microtest/microtest.h"
+
+#include <dirent.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "ParserContext.h"
+#include "ResultSerializer.h"
+#include "SQLParser.h"
+#include "SQLUnparser.h"
+
+using namespace hsql;
+
+namespace {
+
+// Serialized statements of the result. The length of the query text is left out, since the
+// unparsed text is written differently.
+std::string serializeStatements(SQLParserResult* result) {
+  for (size_t i = 0; i < result->size(); ++i) result->getMutableStatement(i)->stringLength = 0;
+  std::string data;
+  ResultSerializer::serialize(*result, &data);
+  return data;
+}
+
+std::string unparse(const std::string& query, UnparseMode mode = kUnparseCanonical) {
+  SQLParserResult result;
+  SQLParser::parse(query, &result);
+  std::string text;
+  SQLUnparser::unparse(result, &text, mode);
+  return text;
+}
+
+// Unparses the query in both modes and checks that the text parses to the same statements and
+// that the canonical text unparses to itself.
+void assertRoundTrip(const std::string& query) {
+  SQLParserResult result;
+  SQLParser::parse(query, &result);
+  if (!result.isValid()) return;
+  const std::string data = serializeStatements(&result);
+
+  for (UnparseMode mode : {kUnparseCanonical, kUnparsePretty}) {
+    std::string text;
+    SQLUnparser::unparse(result, &text, mode);
+
+    SQLParserResult reparsed;
+    SQLParser::parse(text, &reparsed);
+    ASSERT(reparsed.isValid());
+    ASSERT(serializeStatements(&reparsed) == data);
+    if (mode == kUnparseCanonical) ASSERT(unparse(text) == text);
+  }
+}
+
+}  // namespace
+
+TEST(UnparserQueryFileTest) {
+  DIR* directory = opendir("test/queries");
+  ASSERT_NOTNULL(directory);
+
+  size_t numFiles = 0;
+  while (dirent* entry = readdir(directory)) {
+    const std::string name = entry->d_name;
+    if (name.size() < 4 || name.substr(name.size() - 4) != ".sql") continue;
+
+    std::ifstream file("test/queries/" + name);
+    std::stringstream content;
+    content << file.rdbuf();
+    assertRoundTrip(content.str());
+
+    std::string line;
+    while (std::getline(content, line)) {
+      if (!line.empty() && line[0] != '#' && line[0] != '!') assertRoundTrip(line);
+    }
+    ++numFiles;
+  }
+  closedir(directory);
+  ASSERT(numFiles > 0);
+}
+
+TEST(UnparserCanonicalTest) {
+  ASSERT_STREQ(unparse("select  Name,count( * ) as n\n from Students s where s.id != 42 -- comment").c_str(),
+               "SELECT Name, count(*) AS n FROM Students AS s WHERE s.id <> 42;");
+
+  // Parentheses are only kept where the precedence requires them.
+  ASSERT_STREQ(unparse("SELECT ((a + b)) * (c - (d - e)), (a * b) + c, NOT (a = 1 OR (b AND c)) FROM t").c_str(),
+               "SELECT (a + b) * (c - (d - e)), a * b + c, NOT (a = 1 OR b AND c) FROM t;");
+  ASSERT_STREQ(unparse("SELECT * FROM t WHERE a NOT IN (1, 2) AND NOT b IS NULL AND NOT EXISTS (SELECT 1)").c_str(),
+               "SELECT * FROM t WHERE a NOT IN (1, 2) AND b IS NOT NULL AND NOT EXISTS (SELECT 1);");
+
+  // Literals and identifiers.
+  ASSERT_STREQ(unparse("SELECT 'it''s', 1.5, 3., .25, TRUE, NULL, DATE '2024-01-31', \"Select\", \"a b\" FROM t").c_str(),
+               "SELECT 'it''s', 1.5, 3.0, 0.25, TRUE, NULL, DATE '2024-01-31', \"Select\", \"a b\" FROM t;");
+  ASSERT_STREQ(unparse("SELECT -9223372036854775808, -1, CAST(a AS decimal(10,2)) FROM t WHERE b > 5 days").c_str(),
+               "SELECT -9223372036854775808, -1, CAST(a AS DECIMAL(10, 2)) FROM t WHERE b > INTERVAL '5' DAY;");
+
+  ASSERT_STREQ(unparse("insert into t (a, b) values (1, 'x'); update t set a = ? where b = 'x'; drop table if exists t")
+                   .c_str(),
+               "INSERT INTO t (a, b) VALUES (1, 'x'); UPDATE t SET a = ? WHERE b = 'x'; DROP TABLE IF EXISTS t;");
+}
+
+TEST(UnparserPrettyTest) {
+  const std::string text = unparse(
+      "SELECT a, b FROM t JOIN u ON t.id = u.id WHERE a > 1 AND (b = 2 OR c = 3) AND d IN (SELECT e FROM v WHERE f = 1) "
+      "ORDER BY a",
+      kUnparsePretty);
+  ASSERT_STREQ(text.c_str(),
+               "SELECT a, b\n"
+               "FROM t\n"
+               "  JOIN u ON t.id = u.id\n"
+               "WHERE a > 1\n"
+               "  AND (b = 2 OR c = 3)\n"
+               "  AND d IN (\n"
+               "    SELECT e\n"
+               "    FROM v\n"
+               "    WHERE f = 1\n"
+               "  )\n"
+               "ORDER BY a;");
+}
+
+TEST(UnparserExprTest) {
+  SQLParserResult result;
+  SQLParser::parse("SELECT a * (b + 1) AS x FROM t", &result);
+  const Expr* expr = static_cast<const SelectStatement*>(result.getStatement(0))->selectList->at(0);
+
+  // Text is appended, and the alias of the expression itself is left out.
+  std::string text = "x = ";
+  SQLUnparser::unparse(expr, &text);
+  ASSERT_STREQ(text.c_str(), "x = a * (b + 1)");
+}
+
+TEST(UnparserDeepTest) {
+  std::string query = "SELECT * FROM t WHERE a";
+  for (int i = 0; i < 10000; ++i) query += " AND a";
+  assertRoundTrip(query);
+
+  // Flat chains are written like nested ones.
+  ParserContext context;
+  context.setFlattenLogicalOperators(true);
+  SQLParserResult flat;
+  context.parse(query, &flat);
+  ASSERT(flat.isValid());
+  std::string text;
+  SQLUnparser::unparse(flat, &text);
+  ASSERT(text == unparse(query));
+}